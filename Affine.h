@@ -0,0 +1,224 @@
+/**
+* GLSL++
+*
+* affine transformation (linear part and translation) of 3D space, stored as the upper 3x4 block of its 4x4 matrix.
+* the constant last row ([0, 0, 0, 1]) is implicit, so composition, inversion and transformation
+* skip the arithmetic a 4x4 matrix spends on it.
+*
+* Dan Israel Malta
+**/
+#pragma once
+#include "common.h"
+#include "VectorBase.h"
+#include "MatrixBase.h"
+#include "MatrixOperations.h"
+#include <cmath>
+#include <limits>
+
+namespace GLSLCPP {
+
+    /**
+    * \brief affine transformation y = L * x + t, held as a column major matrix with 4 columns and 3 rows
+    *        (columns 0..2 are the linear part 'L', column 3 is the translation 't').
+    *
+    * @param {T, in} underlying type
+    **/
+    template<typename T> class Affine3 {
+        static_assert(std::is_floating_point<T>::value, "Affine3<T> - T must be of floating point type.");
+
+        // properties
+    public:
+        MatrixBase<T, 4, 3> m_data;    // [L | t]
+
+        // constructors
+    public:
+
+        // identity transformation
+        constexpr Affine3() noexcept : m_data(T{}) {
+            m_data(0, 0) = m_data(1, 1) = m_data(2, 2) = static_cast<T>(1);
+        }
+
+        // construct from linear part and translation
+        template<typename V = VectorBase<T, 3>, REQUIRE(Is_VectorOfLength_v<V, 3>)>
+        explicit constexpr Affine3(const MatrixBase<T, 3, 3>& xi_linear, const V& xi_translation = V(T{})) noexcept : m_data(T{}) {
+            for (std::size_t c{}; c < 3; ++c) {
+                for (std::size_t r{}; r < 3; ++r) {
+                    m_data(c, r) = xi_linear(c, r);
+                }
+                m_data(3, c) = static_cast<T>(xi_translation[c]);
+            }
+        }
+
+        // construct from the upper 3x4 block of a 4x4 matrix (last row is not accessed)
+        template<Layout L>
+        explicit constexpr Affine3(const MatrixBase<T, 4, 4, L>& xi_matrix) noexcept : m_data(T{}) {
+            for (std::size_t c{}; c < 4; ++c) {
+                for (std::size_t r{}; r < 3; ++r) {
+                    m_data(c, r) = xi_matrix(c, r);
+                }
+            }
+        }
+
+        Affine3(const Affine3&) noexcept = default;
+        Affine3(Affine3&&) noexcept = default;
+        Affine3& operator=(const Affine3&) noexcept = default;
+        Affine3& operator=(Affine3&&) noexcept = default;
+
+        // element access and queries
+    public:
+
+        // '(col, row)' element access (col < 4, row < 3)
+        constexpr T& operator()(const std::size_t col, const std::size_t row) { return m_data(col, row); }
+        constexpr T  operator()(const std::size_t col, const std::size_t row) const { return m_data(col, row); }
+
+        // linear part
+        constexpr MatrixBase<T, 3, 3> linear() const noexcept {
+            return MatrixBase<T, 3, 3>(m_data.m_data[0], m_data.m_data[1], m_data.m_data[2],
+                                       m_data.m_data[3], m_data.m_data[4], m_data.m_data[5],
+                                       m_data.m_data[6], m_data.m_data[7], m_data.m_data[8]);
+        }
+
+        // translation
+        constexpr VectorBase<T, 3> translation() const noexcept {
+            return VectorBase<T, 3>(m_data.m_data[9], m_data.m_data[10], m_data.m_data[11]);
+        }
+
+        // 4x4 matrix (last row is [0, 0, 0, 1])
+        constexpr MatrixBase<T, 4, 4> dense() const noexcept {
+            MatrixBase<T, 4, 4> xo_mat;
+            for (std::size_t c{}; c < 4; ++c) {
+                for (std::size_t r{}; r < 3; ++r) {
+                    xo_mat(c, r) = m_data(c, r);
+                }
+            }
+            return xo_mat;
+        }
+        explicit constexpr operator MatrixBase<T, 4, 4>() const noexcept { return dense(); }
+
+        // compound operators
+    public:
+
+        // this = this * xi_affine (i.e. - 'xi_affine' is applied first)
+        constexpr Affine3& operator*=(const Affine3& xi_affine) noexcept {
+            *this = *this * xi_affine;
+            return *this;
+        }
+    };
+
+    // type trait to test if an object is an affine transformation
+    template<typename>   struct is_Affine3 : public std::false_type {};
+    template<typename T> struct is_Affine3<Affine3<T>> : public std::true_type {};
+    template<typename T> inline constexpr bool is_Affine3_v = is_Affine3<T>::value;
+
+    // ---------------------------
+    // --- numerical operators ---
+    // ---------------------------
+
+    /**
+    * \brief compose two affine transformations, i.e. - (A * B)(x) = A(B(x))
+    *        (63 flops instead of 112 for the equivalent 4x4 matrix multiplication)
+    *
+    * @param {Affine3, in}  A
+    * @param {Affine3, in}  B
+    * @param {Affine3, out} A * B
+    **/
+    template<typename T>
+    constexpr Affine3<T> operator*(const Affine3<T>& xi_lhs, const Affine3<T>& xi_rhs) noexcept {
+        GLSLCPP_RECORD(MatrixMultiply, 63, 3 * sizeof(Affine3<T>));
+        const auto& a = xi_lhs.m_data.m_data;
+        const auto& b = xi_rhs.m_data.m_data;
+
+        // columns of B are transformed as directions, except its translation which is a point
+        Affine3<T> xo_affine;
+        xo_affine.m_data = { a[0] * b[0] + a[3] * b[1]  + a[6] * b[2],
+                             a[1] * b[0] + a[4] * b[1]  + a[7] * b[2],
+                             a[2] * b[0] + a[5] * b[1]  + a[8] * b[2],
+                             a[0] * b[3] + a[3] * b[4]  + a[6] * b[5],
+                             a[1] * b[3] + a[4] * b[4]  + a[7] * b[5],
+                             a[2] * b[3] + a[5] * b[4]  + a[8] * b[5],
+                             a[0] * b[6] + a[3] * b[7]  + a[6] * b[8],
+                             a[1] * b[6] + a[4] * b[7]  + a[7] * b[8],
+                             a[2] * b[6] + a[5] * b[7]  + a[8] * b[8],
+                             a[0] * b[9] + a[3] * b[10] + a[6] * b[11] + a[9],
+                             a[1] * b[9] + a[4] * b[10] + a[7] * b[11] + a[10],
+                             a[2] * b[9] + a[5] * b[10] + a[8] * b[11] + a[11] };
+        return xo_affine;
+    }
+
+    /**
+    * \brief transform a point (y = L * x + t)
+    *
+    * @param {Affine3,    in}  affine transformation
+    * @param {Vector,     in}  point (3 elements)
+    * @param {VectorBase, out} transformed point
+    **/
+    template<typename T, typename V, REQUIRE(Is_VectorOfLength_v<V, 3>)>
+    constexpr VectorBase<T, 3> TransformPoint(const Affine3<T>& xi_affine, const V& xi_point) noexcept {
+        GLSLCPP_RECORD(MatrixVectorMultiply, 2 * 3 * 3 + 3, sizeof(xi_affine) + 2 * 3 * sizeof(T));
+        const auto& a = xi_affine.m_data.m_data;
+        const T x{ static_cast<T>(xi_point[0]) },
+                y{ static_cast<T>(xi_point[1]) },
+                z{ static_cast<T>(xi_point[2]) };
+        return VectorBase<T, 3>(a[0] * x + a[3] * y + a[6] * z + a[9],
+                                a[1] * x + a[4] * y + a[7] * z + a[10],
+                                a[2] * x + a[5] * y + a[8] * z + a[11]);
+    }
+
+    /**
+    * \brief transform a direction (y = L * x, translation is ignored)
+    *
+    * @param {Affine3,    in}  affine transformation
+    * @param {Vector,     in}  direction (3 elements)
+    * @param {VectorBase, out} transformed direction
+    **/
+    template<typename T, typename V, REQUIRE(Is_VectorOfLength_v<V, 3>)>
+    constexpr VectorBase<T, 3> TransformVector(const Affine3<T>& xi_affine, const V& xi_vector) noexcept {
+        GLSLCPP_RECORD(MatrixVectorMultiply, 2 * 3 * 3, sizeof(xi_affine) + 2 * 3 * sizeof(T));
+        const auto& a = xi_affine.m_data.m_data;
+        const T x{ static_cast<T>(xi_vector[0]) },
+                y{ static_cast<T>(xi_vector[1]) },
+                z{ static_cast<T>(xi_vector[2]) };
+        return VectorBase<T, 3>(a[0] * x + a[3] * y + a[6] * z,
+                                a[1] * x + a[4] * y + a[7] * z,
+                                a[2] * x + a[5] * y + a[8] * z);
+    }
+
+    // ------------------
+    // --- inversions ---
+    // ------------------
+
+    /**
+    * \brief inverse of an affine transformation, i.e. - [L^-1 | -L^-1 * t]
+    *        notice that assertion is the only way to test if linear part is singular (invertible).
+    *
+    * @param {Affine3, in}  affine transformation
+    * @param {Affine3, out} inverse transformation
+    **/
+    template<typename T>
+    constexpr Affine3<T> Inv(const Affine3<T>& xi_affine) noexcept {
+        const MatrixBase<T, 3, 3> linear(Inv(xi_affine.linear()));
+        return Affine3<T>(linear, -(linear * xi_affine.translation()));
+    }
+
+    /**
+    * \brief inverse of a rigid transformation (linear part is a rotation), i.e. - [L^T | -L^T * t]
+    *
+    * @param {Affine3, in}  rigid transformation
+    * @param {Affine3, out} inverse transformation
+    **/
+    template<typename T>
+    constexpr Affine3<T> InvRigid(const Affine3<T>& xi_affine) noexcept {
+        const auto& a = xi_affine.m_data.m_data;
+
+        Affine3<T> xo_affine;
+        auto& c = xo_affine.m_data.m_data;
+        for (std::size_t j{}; j < 3; ++j) {
+            for (std::size_t i{}; i < 3; ++i) {
+                c[j * 3 + i] = a[i * 3 + j];
+            }
+            c[9 + j] = -(a[j * 3] * a[9] + a[j * 3 + 1] * a[10] + a[j * 3 + 2] * a[11]);
+        }
+        return xo_affine;
+    }
+
+}; // namespace GLSLCPP
@@ -7,6 +7,7 @@
 #include "common.h"
 #include "VectorBase.h"
 #include "MatrixBase.h"
+#include "ReductionKernels.h"
 #include<cmath>
 
 namespace GLSLCPP {
@@ -63,18 +64,18 @@ namespace GLSLCPP {
 #undef M_OPERATOR
 
 
-#define M_OPERATOR(OP)                                                                                                  \
-    template<typename T, std::size_t COL, std::size_t ROW>                                                              \
-    constexpr inline bool operator OP (const MatrixBase<T, COL, ROW>& xi_lhs, const MatrixBase<T, COL, ROW>& xi_rhs) {  \
-        return xi_lhs.m_data OP xi_rhs.m_data;                                                                          \
-    }                                                                                                                   \
-    template<typename T, std::size_t COL, std::size_t ROW>                                                              \
-    constexpr inline bool operator OP (const T xi_lhs, const MatrixBase<T, COL, ROW>& xi_rhs) {                         \
-        return xi_lhs OP xi_rhs.m_data;                                                                                 \
-    }                                                                                                                   \
-    template<typename T, std::size_t COL, std::size_t ROW>                                                              \
-    constexpr inline bool operator OP (const MatrixBase<T, COL, ROW>& xi_lhs, const T xi_rhs) {                         \
-        return xi_lhs.m_data OP xi_rhs;                                                                                 \
+#define M_OPERATOR(OP)                                                                                                        \
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L>                                                          \
+    constexpr inline bool operator OP (const MatrixBase<T, COL, ROW, L>& xi_lhs, const MatrixBase<T, COL, ROW, L>& xi_rhs) {  \
+        return xi_lhs.m_data OP xi_rhs.m_data;                                                                                \
+    }                                                                                                                         \
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L>                                                          \
+    constexpr inline bool operator OP (const T xi_lhs, const MatrixBase<T, COL, ROW, L>& xi_rhs) {                            \
+        return xi_lhs OP xi_rhs.m_data;                                                                                       \
+    }                                                                                                                         \
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L>                                                          \
+    constexpr inline bool operator OP (const MatrixBase<T, COL, ROW, L>& xi_lhs, const T xi_rhs) {                            \
+        return xi_lhs.m_data OP xi_rhs;                                                                                       \
     }
 
     M_OPERATOR(== );
@@ -350,98 +351,96 @@ namespace GLSLCPP {
     // --- general binary functions (element wise) ---
     // -----------------------------------------------
 
+    namespace summation_detail {
+        // true for collections whose elements are stored contiguously (VectorBase, Vector2/3/4, MatrixBase)
+        template<typename T> constexpr bool is_Contiguous_v{ is_Vector_v<T> || is_MatrixBase_v<T> };
+
+        template<typename T, std::size_t N>
+        constexpr const T* Data(const VectorBase<T, N>& xi_vec) noexcept { return xi_vec.m_data.data(); }
+
+        // Vector2/3/4 and MatrixBase
+        template<class V>
+        constexpr auto Data(const V& xi_col) noexcept -> decltype(xi_col.m_data.m_data.data()) { return xi_col.m_data.m_data.data(); }
+
+        // dot product of several collections of identical type and length (unrolled kernel for two to four contiguous collections)
+        template<typename T, typename... Args>
+        constexpr inline underlying_type_t<T> Dot(const T& xi_tail, const Args& ...args) {
+            using _T = underlying_type_t<T>;
+
+            if constexpr (is_Contiguous_v<T> && (sizeof...(Args) <= 3) && (std::is_same_v<T, Args> && ...)) {
+                return kernels::DotUnrolled<Length_v<T>>(Data(xi_tail), Data(args)...);
+            } else if constexpr (sizeof...(Args) == 1) {
+                return transform_reduce(xi_tail, args..., _T{},
+                                        [&](const _T l, const _T r) -> _T { return (l + r); },
+                                        [&](const _T l, const _T r) -> _T { return l * r; });
+            } else {
+                _T xo_dot{};
+                for (std::size_t i{}; i < Length_v<T>; ++i) {
+                    xo_dot += (xi_tail[i] * ... * args[i]);
+                }
+                return xo_dot;
+            }
+        }
+    };
+
     /**
     * \brief return the internal ("dot") product between a variadic number of collections.
-    *        collections must have identical underlying type and be with the same length
+    *        collections must have identical underlying type and be with the same length.
+    *        two, three and four contiguous collections are reduced with several independent accumulators (see 'kernels::DotUnrolled').
     *
     * @param {Collection, in}  collections...
     * @param {T,          out} dot(collection #1, ...)
     **/
     template<typename T, REQUIRE(is_iterate_able_v<T>)>
     constexpr inline underlying_type_t<T> dot(const T& xi_tail) {
-        using _T = underlying_type_t<T>;
+        GLSLCPP_RECORD(Dot, 2 * Length_v<T>, Length_v<T> * sizeof(underlying_type_t<T>));
 
         // return squared magnitude
-        auto l = FWD(xi_tail);
-        return reduce(_T{}, l, [&](const _T init, const _T elm) -> _T { return (init + elm * elm); });
+        return summation_detail::Dot(xi_tail, xi_tail);
     }
 
     template<typename T, typename... Args, REQUIRE(is_iterate_able_v<T>)>
     constexpr inline underlying_type_t<T> dot(T&& xi_tail) {
-        using _T = underlying_type_t<T>;
+        GLSLCPP_RECORD(Dot, 2 * Length_v<std::decay_t<T>>, Length_v<std::decay_t<T>> * sizeof(underlying_type_t<T>));
+
         // return vector squred magnitude
-        return reduce(_T{}, xi_tail, [&](const _T init, const _T elm) -> _T { return (init + elm * elm); });
+        return summation_detail::Dot<std::decay_t<T>>(xi_tail, xi_tail);
     }
 
     template<typename T, typename... Args, REQUIRE(is_iterate_able_v<T>)>
     constexpr inline underlying_type_t<T> dot(const T& xi_tail, const T& xi_head) {
-        using _T = underlying_type_t<T>;
+        GLSLCPP_RECORD(Dot, 2 * Length_v<T>, 2 * Length_v<T> * sizeof(underlying_type_t<T>));
 
         // standard dot ("scalar") product
-        auto _l = FWD(xi_tail);
-        auto _r = FWD(xi_head);
-        return transform_reduce(_l, _r, _T{},
-                               [&](const _T l, const _T r) -> _T { return (l + r); },
-                               [&](const _T l, const _T r) -> _T { return l * r; });
+        return summation_detail::Dot(xi_tail, xi_head);
     }
 
     template<typename T, typename... Args, REQUIRE(is_iterate_able_v<T>)>
     constexpr inline underlying_type_t<T> dot(T&& xi_tail, const T& xi_head) {
-        using _T = underlying_type_t<T>;
+        GLSLCPP_RECORD(Dot, 2 * Length_v<std::decay_t<T>>, 2 * Length_v<std::decay_t<T>> * sizeof(underlying_type_t<T>));
 
         // standard dot ("scalar") product
-        auto _r = FWD(xi_head);
-        return transform_reduce(xi_tail, _r, _T{},
-                                [&](const _T l, const _T r) -> _T { return (l + r); },
-                                [&](const _T l, const _T r) -> _T { return l * r; });
+        return summation_detail::Dot<std::decay_t<T>>(xi_tail, xi_head);
     }
 
     template<typename T, typename... Args, REQUIRE(is_iterate_able_v<T> &&
                                                    Are_IterAbleEqualSize_v<Length_v<T>, Args...> &&
                                                    (sizeof...(Args) > 1))>
-        constexpr inline underlying_type_t<T> dot(const T& xi_tail, const Args& ...args) {
-        using _T = underlying_type_t<T>;
-        constexpr std::size_t N{ sizeof...(Args) };
+    constexpr inline underlying_type_t<T> dot(const T& xi_tail, const Args& ...args) {
+        GLSLCPP_RECORD(Dot, (sizeof...(Args) + 1) * Length_v<std::decay_t<T>>, (sizeof...(Args) + 1) * Length_v<std::decay_t<T>> * sizeof(underlying_type_t<T>));
 
         // dot product of several vectors
-        const std::array<T, N + 1> _args{ xi_tail, args... };
-        _T xo_dot{};
-
-        for (std::size_t i{}; i < N + 1; ++i) {
-            _T temp{ static_cast<_T>(1) };
-
-            for (std::size_t j{}; j < N + 1; ++j) {
-                temp *= _args[j][i];
-            }
-
-            xo_dot += temp;
-        }
-
-        return xo_dot;
+        return summation_detail::Dot(xi_tail, args...);
     }
 
     template<typename T, typename... Args, REQUIRE(is_iterate_able_v<T> &&
                                                    Are_IterAbleEqualSize_v<Length_v<T>, Args...> &&
                                                    (sizeof...(Args) > 1))>
     constexpr inline underlying_type_t<T> dot(T&& xi_tail, const Args& ...args) {
-        using _T = underlying_type_t<T>;
-        constexpr std::size_t N{ sizeof...(Args) };
+        GLSLCPP_RECORD(Dot, (sizeof...(Args) + 1) * Length_v<std::decay_t<T>>, (sizeof...(Args) + 1) * Length_v<std::decay_t<T>> * sizeof(underlying_type_t<T>));
 
         // dot product of several vectors
-        const std::array<T, N + 1> _args{ xi_tail, args... };
-        _T xo_dot{};
-
-        for (std::size_t i{}; i < N + 1; ++i) {
-            _T temp{ static_cast<_T>(1) };
-
-            for (std::size_t j{}; j < N + 1; ++j) {
-                temp *= _args[j][i];
-            }
-
-            xo_dot += temp;
-        }
-
-        return xo_dot;
+        return summation_detail::Dot<std::decay_t<T>>(xi_tail, args...);
     }
 
     /**
@@ -588,6 +587,81 @@ namespace GLSLCPP {
         return xo_prod;
     }
 
+    // ---------------------------
+    // --- accurate reductions ---
+    // ---------------------------
+
+    /**
+    * \brief return the sum of a collection elements using a given summation algorithm (i.e. - sum<Summation::Compensated>(v)).
+    *
+    * @param {Summation,  in}  summation algorithm
+    * @param {Collection, in}  collection (vector or matrix)
+    * @param {T,          out} sum of collection elements
+    **/
+    template<Summation S, typename T, REQUIRE(is_iterate_able_v<T> && (Length_v<T> > 0))>
+    inline underlying_type_t<T> sum(const T& xi_col) {
+        using _T = underlying_type_t<T>;
+
+        if constexpr (S == Summation::Naive) {
+            return sum(xi_col);
+        } else {
+            static_assert(std::is_floating_point_v<_T>, "sum<Summation> - pairwise and compensated summation require floating point elements.");
+            if constexpr (S == Summation::Pairwise) {
+                return kernels::SumPairwise(summation_detail::Data(xi_col), Length_v<T>);
+            } else {
+                return kernels::SumCompensated(summation_detail::Data(xi_col), Length_v<T>);
+            }
+        }
+    }
+
+    /**
+    * \brief return the internal ("dot") product of two collections using a given summation algorithm (i.e. - dot<Summation::Compensated>(a, b)).
+    *
+    * @param {Summation,  in}  summation algorithm
+    * @param {Collection, in}  collection #1 (vector or matrix)
+    * @param {Collection, in}  collection #2 (vector or matrix)
+    * @param {T,          out} dot(collection #1, collection #2)
+    **/
+    template<Summation S, typename T, REQUIRE(is_iterate_able_v<T> && (Length_v<T> > 0))>
+    inline underlying_type_t<T> dot(const T& xi_lhs, const T& xi_rhs) {
+        using _T = underlying_type_t<T>;
+
+        if constexpr (S == Summation::Naive) {
+            return dot(xi_lhs, xi_rhs);
+        } else {
+            static_assert(std::is_floating_point_v<_T>, "dot<Summation> - pairwise and compensated summation require floating point elements.");
+            GLSLCPP_RECORD(Dot, 2 * Length_v<T>, 2 * Length_v<T> * sizeof(_T));
+            if constexpr (S == Summation::Pairwise) {
+                return kernels::DotPairwise(summation_detail::Data(xi_lhs), summation_detail::Data(xi_rhs), Length_v<T>);
+            } else {
+                return kernels::DotCompensated(summation_detail::Data(xi_lhs), summation_detail::Data(xi_rhs), Length_v<T>);
+            }
+        }
+    }
+
+    /**
+    * \brief return the product of a collection elements using a given summation algorithm (i.e. - prod<Summation::Compensated>(v)).
+    *
+    * @param {Summation,  in}  summation algorithm
+    * @param {Collection, in}  collection (vector or matrix)
+    * @param {T,          out} product of collection elements
+    **/
+    template<Summation S, typename T, REQUIRE(is_iterate_able_v<T> && (Length_v<T> > 0))>
+    inline underlying_type_t<T> prod(const T& xi_col) {
+        using _T = underlying_type_t<T>;
+
+        if constexpr (S == Summation::Naive) {
+            return prod(xi_col);
+        } else {
+            static_assert(std::is_floating_point_v<_T>, "prod<Summation> - pairwise and compensated products require floating point elements.");
+            if constexpr (S == Summation::Pairwise) {
+                return kernels::ProductPairwise(summation_detail::Data(xi_col), Length_v<T>);
+            } else {
+                return kernels::ProductCompensated(summation_detail::Data(xi_col), Length_v<T>);
+            }
+        }
+    }
+
     /**
     * \brief clamp collections elements to a given region
     *
@@ -0,0 +1,668 @@
+/**
+* GLSL++
+*
+* factorization objects - a matrix is decomposed once (at construction) and the cached decomposition
+* is used for any number of solutions, determinant and inverse calculations.
+*
+* Dan Israel Malta
+**/
+#pragma once
+#include "MatrixOperations.h"
+#include "MatrixView.h"
+#include "LinearAlgebraKernels.h"
+#include <array>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+namespace GLSLCPP {
+
+    /**
+    * \brief LU decomposition (with partial pivoting) of a cubic matrix, i.e. - P * A = L * U.
+    *        factors are kept in column major layout (a row major matrix is converted once, on construction).
+    *
+    * @param {M, in} cubic matrix type
+    **/
+    template<typename M> class LUFactor {
+        static_assert(is_Cubic<M>::value, "LUFactor<M> - M must be a cubic matrix.");
+        using _T = underlying_type_t<M>;
+        static constexpr std::size_t N{ Columns_v<M> };
+        using Factors = MatrixBase<_T, N, N>;
+
+        // properties
+    private:
+        Factors m_lu;                                  // L (below diagonal, unit diagonal is implicit) and U (upper triangular portion)
+        VectorBase<std::size_t, N> m_pivot;      // row 'i' of L * U is row 'm_pivot[i]' of A
+        std::int32_t m_sign{};                   // permutation sign
+
+        // constructors
+    public:
+
+        explicit LUFactor(const M& xi_matrix) noexcept {
+            LU(ColumnMajor(xi_matrix), m_lu, m_pivot, m_sign);
+        }
+
+        // accessors
+    public:
+
+        const Factors& factors() const noexcept { return m_lu; }
+        const VectorBase<std::size_t, N>& pivot() const noexcept { return m_pivot; }
+
+        // methods
+    public:
+
+        /**
+        * \brief solve A * x = b
+        *
+        * @param {vector, in}  b (column vector)
+        * @param {vector, out} x (column vector)
+        **/
+        template<typename V, REQUIRE(Is_VectorOfLength_v<V, N> && std::is_same_v<_T, underlying_type_t<V>>)>
+        V solve(const V& xi_b) const noexcept {
+            std::array<_T, N> x;
+            for (std::size_t i{}; i < N; ++i) {
+                x[i] = xi_b[m_pivot[i]];
+            }
+
+            kernels::TrsmLowerUnit(N, 1, m_lu.m_data.m_data.data(), N, x.data(), N);
+            kernels::TrsmUpper(N, 1, m_lu.m_data.m_data.data(), N, x.data(), N);
+
+            V xo_x;
+            for (std::size_t i{}; i < N; ++i) {
+                xo_x[i] = x[i];
+            }
+            return xo_x;
+        }
+
+        // solve A * x = b, where b is viewed (i.e. - column of another matrix)
+        template<typename T, REQUIRE(std::is_same_v<_T, std::remove_const_t<T>>)>
+        VectorBase<_T, N> solve(const VectorView<T, N>& xi_b) const noexcept {
+            return solve(xi_b.eval());
+        }
+
+        /**
+        * \brief solve A * X = B
+        *
+        * @param {matrixBase, in}  B (every column is a right hand side)
+        * @param {matrixBase, out} X (every column is a solution)
+        **/
+        template<std::size_t K>
+        MatrixBase<_T, K, N> solve(const MatrixBase<_T, K, N>& xi_b) const noexcept {
+            MatrixBase<_T, K, N> xo_x(_T{});
+            for (std::size_t k{}; k < K; ++k) {
+                for (std::size_t i{}; i < N; ++i) {
+                    xo_x(k, i) = xi_b(k, m_pivot[i]);
+                }
+            }
+
+            kernels::TrsmLowerUnit(N, K, m_lu.m_data.m_data.data(), N, &xo_x.m_data[0], N);
+            kernels::TrsmUpper(N, K, m_lu.m_data.m_data.data(), N, &xo_x.m_data[0], N);
+            return xo_x;
+        }
+
+        // determinant of A
+        _T determinant() const noexcept {
+            _T xo_det{ static_cast<_T>(m_sign) };
+            for (std::size_t i{}; i < N; ++i) {
+                xo_det *= m_lu(i, i);
+            }
+            return xo_det;
+        }
+
+        // inverse of A
+        M inverse() const noexcept {
+            return M(solve(Factors()));
+        }
+    };
+
+    /**
+    * \brief outcome of a mixed precision solution
+    *
+    * @param {T, in} working precision
+    **/
+    template<typename T> struct RefinementSolution {
+        std::size_t iterations{};    // number of refinement steps (low precision corrections) performed
+        T backwardError{};           // normwise backward error of solution, i.e. - ||b - A * x|| / (||A|| * ||x|| + ||b||) (infinity norm)
+        bool converged{ false };     // true if backward error is below requested tolerance
+    };
+
+    namespace mixed_precision_detail {
+
+        // below this dimension float factorization saves less than the refinement steps cost, so systems are factorized in working precision
+        constexpr std::size_t MIXED_PRECISION_DIMENSION{ 48 };
+
+        template<typename M> using DefaultFactorization_t = std::conditional_t<(Columns_v<M> >= MIXED_PRECISION_DIMENSION), float, underlying_type_t<M>>;
+
+        // infinity norm of a column major NxN matrix (row sums are accumulated column after column)
+        template<std::size_t N, typename T>
+        T Norm(const T* a) noexcept {
+            std::array<T, N> sum{};
+            for (std::size_t c{}; c < N; ++c) {
+                for (std::size_t r{}; r < N; ++r) {
+                    sum[r] += std::abs(a[c * N + r]);
+                }
+            }
+            return *std::max_element(sum.begin(), sum.end());
+        }
+
+        /**
+        * \brief LU decomposition (with partial pivoting) of a small column major matrix, i.e. - P * A = L * U.
+        *        A is copied into the factors column after column while its infinity norm is accumulated,
+        *        and every elimination step updates contiguous columns.
+        *
+        * @param {T*,         in}  A (column major, NxN)
+        * @param {T*,         out} L (below diagonal, unit diagonal is implicit) and U (upper triangular portion), column major NxN
+        * @param {array,      out} reciprocals of U diagonal
+        * @param {vectorBase, out} pivot (row 'i' of L * U is row 'pivot[i]' of A)
+        * @param {T,          out} ||A|| (infinity norm)
+        **/
+        template<std::size_t N, typename T>
+        T Factorize(const T* a, T* lu, std::array<T, N>& xo_inverse, VectorBase<std::size_t, N>& xo_pivot) noexcept {
+            std::array<T, N> sum{};
+            for (std::size_t c{}; c < N; ++c) {
+                for (std::size_t r{}; r < N; ++r) {
+                    lu[c * N + r] = a[c * N + r];
+                    sum[r] += std::abs(a[c * N + r]);
+                }
+            }
+            for (std::size_t i{}; i < N; ++i) {
+                xo_pivot[i] = i;
+            }
+
+            for (std::size_t c{}; c < N; ++c) {
+                T* column{ lu + c * N };
+
+                // find and exchange pivot
+                std::size_t pivot{ c };
+                for (std::size_t r{ c + 1 }; r < N; ++r) {
+                    if (std::abs(column[r]) > std::abs(column[pivot])) {
+                        pivot = r;
+                    }
+                }
+                if (pivot != c) {
+                    for (std::size_t cc{}; cc < N; ++cc) {
+                        std::swap(lu[cc * N + pivot], lu[cc * N + c]);
+                    }
+                    std::swap(xo_pivot[pivot], xo_pivot[c]);
+                }
+
+                // calculate multipliers and eliminate c-th column
+                xo_inverse[c] = static_cast<T>(1) / column[c];
+                if (column[c] == T{}) continue;
+                for (std::size_t r{ c + 1 }; r < N; ++r) {
+                    column[r] *= xo_inverse[c];
+                }
+                for (std::size_t cc{ c + 1 }; cc < N; ++cc) {
+                    T* target{ lu + cc * N };
+                    const T u{ target[c] };
+                    for (std::size_t r{ c + 1 }; r < N; ++r) {
+                        target[r] -= column[r] * u;
+                    }
+                }
+            }
+
+            return *std::max_element(sum.begin(), sum.end());
+        }
+
+        // solve L * U * x = P * b in place (column oriented substitution, U diagonal is given by its reciprocals)
+        template<std::size_t N, typename T>
+        void Substitute(const T* lu, const T* inverse, std::array<T, N>& xio_x) noexcept {
+            for (std::size_t k{}; k < N; ++k) {
+                const T* lk{ lu + k * N };
+                const T x{ xio_x[k] };
+                for (std::size_t i{ k + 1 }; i < N; ++i) {
+                    xio_x[i] -= lk[i] * x;
+                }
+            }
+            for (std::size_t k{ N }; k-- > 0;) {
+                const T* uk{ lu + k * N };
+                xio_x[k] *= inverse[k];
+                const T x{ xio_x[k] };
+                for (std::size_t i{}; i < k; ++i) {
+                    xio_x[i] -= uk[i] * x;
+                }
+            }
+        }
+
+        /**
+        * \brief solve A * x = b using LU decomposition of A (in precision L) and refine the solution using residuals in working precision T.
+        *
+        * @param {T*,                 in}  A (column major, NxN)
+        * @param {T,                  in}  ||A|| (infinity norm)
+        * @param {L*,                 in}  LU decomposition of A (column major, NxN)
+        * @param {L*,                 in}  reciprocals of U diagonal
+        * @param {vectorBase,         in}  LU decomposition pivot
+        * @param {vector,             in}  b
+        * @param {vector,             out} x
+        * @param {T,                  in}  backward error tolerance
+        * @param {size_t,             in}  maximal number of refinement steps
+        * @param {RefinementSolution, out} number of refinement steps, achieved backward error and convergence flag
+        **/
+        template<std::size_t N, typename L, typename T, typename V>
+        RefinementSolution<T> Refine(const T* a, const T xi_norm, const L* lu, const L* inverse, const VectorBase<std::size_t, N>& xi_pivot,
+                                     const V& xi_b, V& xo_x, const T xi_tolerance, const std::size_t xi_maxIterations) noexcept {
+            RefinementSolution<T> xo_solution;
+            std::array<T, N> x, r;
+            std::array<L, N> low;
+
+            // low precision solution
+            T normB{};
+            for (std::size_t i{}; i < N; ++i) {
+                normB = std::max(normB, std::abs(xi_b[i]));
+            }
+            if constexpr (std::is_same_v<L, T>) {
+                for (std::size_t i{}; i < N; ++i) {
+                    x[i] = xi_b[xi_pivot[i]];
+                }
+                Substitute(lu, inverse, x);
+            }
+            else {
+                for (std::size_t i{}; i < N; ++i) {
+                    low[i] = static_cast<L>(xi_b[xi_pivot[i]]);
+                }
+                Substitute(lu, inverse, low);
+                for (std::size_t i{}; i < N; ++i) {
+                    x[i] = static_cast<T>(low[i]);
+                }
+            }
+
+            T previous{ std::numeric_limits<T>::max() };
+            for (;;) {
+                // working precision residual (column after column)
+                for (std::size_t i{}; i < N; ++i) {
+                    r[i] = xi_b[i];
+                }
+                for (std::size_t c{}; c < N; ++c) {
+                    const T* ac{ a + c * N };
+                    const T xc{ x[c] };
+                    for (std::size_t i{}; i < N; ++i) {
+                        r[i] -= ac[i] * xc;
+                    }
+                }
+
+                T normR{},
+                  normX{};
+                for (std::size_t i{}; i < N; ++i) {
+                    normR = std::max(normR, std::abs(r[i]));
+                    normX = std::max(normX, std::abs(x[i]));
+                }
+                const T denominator{ xi_norm * normX + normB };
+                xo_solution.backwardError = (denominator > T{}) ? (normR / denominator) : T{};
+
+                if (xo_solution.backwardError <= xi_tolerance) {
+                    xo_solution.converged = true;
+                    break;
+                }
+                if ((xo_solution.iterations == xi_maxIterations) || (xo_solution.backwardError > previous / static_cast<T>(2))) {
+                    break;
+                }
+                previous = xo_solution.backwardError;
+
+                // low precision correction (residual is permuted and scaled to avoid low precision underflow)
+                for (std::size_t i{}; i < N; ++i) {
+                    low[i] = static_cast<L>(r[xi_pivot[i]] / normR);
+                }
+                Substitute(lu, inverse, low);
+                for (std::size_t i{}; i < N; ++i) {
+                    x[i] += normR * static_cast<T>(low[i]);
+                }
+                ++xo_solution.iterations;
+            }
+
+            for (std::size_t i{}; i < N; ++i) {
+                xo_x[i] = x[i];
+            }
+            return xo_solution;
+        }
+    };
+
+    /**
+    * \brief mixed precision LU solver of a cubic matrix.
+    *        A is factorized once in low precision (i.e. - float), solutions are computed in low precision and
+    *        iteratively refined to working precision using residuals (b - A * x) calculated in working precision.
+    *        converges for matrices whose condition number is well below 1 / epsilon(low precision).
+    *        by default, matrices smaller than 48x48 are factorized in working precision (refinement only verifies the solution),
+    *        since for them a float factorization is not faster than the refinement steps it requires.
+    *
+    * @param {M, in} cubic matrix type (working precision, i.e. - MatrixBase<double, N, N>)
+    * @param {L, in} factorization precision (float for matrices of 48x48 and larger, working precision otherwise)
+    **/
+    template<typename M, typename L = mixed_precision_detail::DefaultFactorization_t<M>> class MixedPrecisionLUFactor {
+        static_assert(is_Cubic<M>::value, "MixedPrecisionLUFactor<M, L> - M must be a cubic matrix.");
+        static_assert(std::is_floating_point_v<L>, "MixedPrecisionLUFactor<M, L> - L must be a floating point type.");
+        using _T = underlying_type_t<M>;
+        static constexpr std::size_t N{ Columns_v<M> };
+        using Low = MatrixBase<L, N, N>;
+        using Matrix = MatrixBase<_T, N, N>;
+
+        // properties
+    private:
+        Matrix m_matrix;            // A (working precision, column major)
+        LUFactor<Low> m_lu;         // LU decomposition of A (low precision)
+        std::array<L, N> m_inverse; // reciprocals of U diagonal
+        _T m_norm{};                // ||A|| (infinity norm)
+
+        // constructors
+    public:
+
+        explicit MixedPrecisionLUFactor(const M& xi_matrix) noexcept : m_matrix(xi_matrix), m_lu(Demote(m_matrix)),
+                                                                       m_norm(mixed_precision_detail::Norm<N>(m_matrix.m_data.m_data.data())) {
+            for (std::size_t i{}; i < N; ++i) {
+                m_inverse[i] = static_cast<L>(1) / m_lu.factors()(i, i);
+            }
+        }
+
+        // accessors
+    public:
+
+        const Matrix& matrix() const noexcept { return m_matrix; }
+        const LUFactor<Low>& factor() const noexcept { return m_lu; }
+
+        // methods
+    public:
+
+        // default backward error tolerance, sqrt(N) * epsilon(working precision)
+        static _T DefaultTolerance() noexcept {
+            return std::sqrt(static_cast<_T>(N)) * std::numeric_limits<_T>::epsilon();
+        }
+
+        /**
+        * \brief solve A * x = b.
+        *        refinement stops once backward error is below tolerance, when a correction does not halve
+        *        the backward error (stagnation) or after maximal number of iterations.
+        *
+        * @param {vector,             in}  b (column vector)
+        * @param {vector,             out} x (column vector)
+        * @param {T,                  in}  backward error tolerance
+        * @param {size_t,             in}  maximal number of refinement steps
+        * @param {RefinementSolution, out} number of refinement steps, achieved backward error and convergence flag
+        **/
+        template<typename V, REQUIRE(Is_VectorOfLength_v<V, N> && std::is_same_v<_T, underlying_type_t<V>>)>
+        RefinementSolution<_T> solve(const V& xi_b, V& xo_x, const _T xi_tolerance = DefaultTolerance(), const std::size_t xi_maxIterations = 30) const noexcept {
+            return mixed_precision_detail::Refine(m_matrix.m_data.m_data.data(), m_norm, m_lu.factors().m_data.m_data.data(), m_inverse.data(), m_lu.pivot(),
+                                                  xi_b, xo_x, xi_tolerance, xi_maxIterations);
+        }
+
+        // internal helpers
+    private:
+
+        static Low Demote(const Matrix& xi_matrix) noexcept {
+            if constexpr (std::is_same_v<L, _T>) {
+                return xi_matrix;
+            }
+            else {
+                Low xo_low(L{});
+                for (std::size_t i{}; i < N * N; ++i) {
+                    xo_low.m_data[i] = static_cast<L>(xi_matrix.m_data[i]);
+                }
+                return xo_low;
+            }
+        }
+    };
+
+    /**
+    * \brief solve linear system A*x=b (A must be CUBIC) using mixed precision iterative refinement,
+    *        i.e. - LU decomposition in float and residuals in the working precision of A (see 'MixedPrecisionLUFactor').
+    *        matrices smaller than 48x48 are factorized in working precision, in place of a copy of A.
+    *
+    * @param {matrixBase,         in}  A (CUBIC)
+    * @param {vectorBase,         in}  b (column vector)
+    * @param {vectorBase,         out} x (column vector)
+    * @param {T,                  in}  backward error tolerance (sqrt(N) * epsilon by default)
+    * @param {size_t,             in}  maximal number of refinement steps
+    * @param {RefinementSolution, out} number of refinement steps, achieved backward error and convergence flag
+    **/
+    template<typename T, typename U, REQUIRE(is_Cubic<T>::value && Is_VectorOfLength_v<U, Columns_v<T>> &&
+                                             std::is_same_v<underlying_type_t<T>, underlying_type_t<U>>)>
+    RefinementSolution<underlying_type_t<T>> SolveMixedPrecisionLU(const T& xi_A, const U& xi_b, U& xo_x,
+                                                                   const underlying_type_t<T> xi_tolerance = MixedPrecisionLUFactor<T>::DefaultTolerance(),
+                                                                   const std::size_t xi_maxIterations = 30) noexcept {
+        using _T = underlying_type_t<T>;
+        constexpr std::size_t N{ Columns_v<T> };
+
+        // working precision factorization refines A itself, so it is not copied
+        if constexpr (std::is_same_v<mixed_precision_detail::DefaultFactorization_t<T>, _T>) {
+            const auto& A = ColumnMajor(xi_A);
+            std::array<_T, N * N> lu;
+            std::array<_T, N> inverse;
+            VectorBase<std::size_t, N> pivot;
+            const _T norm{ mixed_precision_detail::Factorize(A.m_data.m_data.data(), lu.data(), inverse, pivot) };
+            return mixed_precision_detail::Refine(A.m_data.m_data.data(), norm, lu.data(), inverse.data(), pivot, xi_b, xo_x, xi_tolerance, xi_maxIterations);
+        }
+        else {
+            return MixedPrecisionLUFactor<T>(xi_A).solve(xi_b, xo_x, xi_tolerance, xi_maxIterations);
+        }
+    }
+
+    /**
+    * \brief Cholesky decomposition of a cubic, symmetric and positive definite matrix, i.e. - A = L * L^T.
+    *        factor is kept in column major layout (a symmetric matrix has identical storage in both layouts).
+    *
+    * @param {M, in} cubic matrix type
+    **/
+    template<typename M> class CholeskyFactor {
+        static_assert(is_Cubic<M>::value, "CholeskyFactor<M> - M must be a cubic matrix.");
+        using _T = underlying_type_t<M>;
+        static constexpr std::size_t N{ Columns_v<M> };
+        using Factors = MatrixBase<_T, N, N>;
+
+        // properties
+    private:
+        Factors m_lower;    // L
+
+        // constructors
+    public:
+
+        explicit CholeskyFactor(const M& xi_matrix) noexcept : m_lower(Cholesky(AsColumnMajorSymmetric(xi_matrix))) {}
+
+        // accessors
+    public:
+
+        const Factors& lower() const noexcept { return m_lower; }
+
+        // methods
+    public:
+
+        /**
+        * \brief solve A * x = b
+        *
+        * @param {vector, in}  b (column vector)
+        * @param {vector, out} x (column vector)
+        **/
+        template<typename V, REQUIRE(Is_VectorOfLength_v<V, N> && std::is_same_v<_T, underlying_type_t<V>>)>
+        V solve(const V& xi_b) const noexcept {
+            std::array<_T, N> x;
+            for (std::size_t i{}; i < N; ++i) {
+                x[i] = xi_b[i];
+            }
+
+            kernels::TrsmLower(N, 1, m_lower.m_data.m_data.data(), N, x.data(), N);
+            kernels::TrsmLowerTransposed(N, 1, m_lower.m_data.m_data.data(), N, x.data(), N);
+
+            V xo_x;
+            for (std::size_t i{}; i < N; ++i) {
+                xo_x[i] = x[i];
+            }
+            return xo_x;
+        }
+
+        // solve A * x = b, where b is viewed (i.e. - column of another matrix)
+        template<typename T, REQUIRE(std::is_same_v<_T, std::remove_const_t<T>>)>
+        VectorBase<_T, N> solve(const VectorView<T, N>& xi_b) const noexcept {
+            return solve(xi_b.eval());
+        }
+
+        /**
+        * \brief solve A * X = B
+        *
+        * @param {matrixBase, in}  B (every column is a right hand side)
+        * @param {matrixBase, out} X (every column is a solution)
+        **/
+        template<std::size_t K>
+        MatrixBase<_T, K, N> solve(const MatrixBase<_T, K, N>& xi_b) const noexcept {
+            MatrixBase<_T, K, N> xo_x(xi_b);
+            kernels::TrsmLower(N, K, m_lower.m_data.m_data.data(), N, &xo_x.m_data[0], N);
+            kernels::TrsmLowerTransposed(N, K, m_lower.m_data.m_data.data(), N, &xo_x.m_data[0], N);
+            return xo_x;
+        }
+
+        // determinant of A
+        _T determinant() const noexcept {
+            _T xo_det{ static_cast<_T>(1) };
+            for (std::size_t i{}; i < N; ++i) {
+                xo_det *= m_lower(i, i);
+            }
+            return xo_det * xo_det;
+        }
+
+        // inverse of A
+        M inverse() const noexcept {
+            return M(solve(Factors()));
+        }
+
+        /**
+        * \brief update the decomposition to that of A + x * x^T (O(N^2) operations).
+        *
+        * @param {vector, in} x (column vector)
+        **/
+        template<typename V, REQUIRE(Is_VectorOfLength_v<V, N> && std::is_same_v<_T, underlying_type_t<V>>)>
+        void update(const V& xi_x) noexcept {
+            RankOne(xi_x, static_cast<_T>(1));
+        }
+
+        /**
+        * \brief update the decomposition to that of A - x * x^T (O(N^2) operations).
+        *        decomposition is left unchanged if A - x * x^T is not positive definite.
+        *
+        * @param {vector, in}  x (column vector)
+        * @param {bool,   out} true if downdated matrix is positive definite (and decomposition was updated)
+        **/
+        template<typename V, REQUIRE(Is_VectorOfLength_v<V, N> && std::is_same_v<_T, underlying_type_t<V>>)>
+        bool downdate(const V& xi_x) noexcept {
+            return RankOne(xi_x, static_cast<_T>(-1));
+        }
+
+        // internal helpers
+    private:
+
+        // rank one modification of L (using a sequence of (hyperbolic) rotations)
+        template<typename V>
+        bool RankOne(const V& xi_x, const _T xi_sign) noexcept {
+            std::array<_T, N> x;
+            for (std::size_t i{}; i < N; ++i) {
+                x[i] = xi_x[i];
+            }
+
+            Factors lower(m_lower);
+            _T* l{ &lower.m_data[0] };
+            for (std::size_t k{}; k < N; ++k) {
+                _T* lk{ l + k * N };
+                const _T r2{ lk[k] * lk[k] + xi_sign * x[k] * x[k] };
+                if (!(r2 > _T{})) return false;
+
+                const _T r{ std::sqrt(r2) },
+                         c{ r / lk[k] },
+                         s{ x[k] / lk[k] };
+                lk[k] = r;
+                for (std::size_t i{ k + 1 }; i < N; ++i) {
+                    lk[i] = (lk[i] + xi_sign * s * x[i]) / c;
+                    x[i] = c * x[i] - s * lk[i];
+                }
+            }
+
+            m_lower = lower;
+            return true;
+        }
+
+        // a symmetric matrix is its own transpose, so a row major matrix storage is read as column major storage
+        static const Factors& AsColumnMajorSymmetric(const M& xi_matrix) noexcept {
+            if constexpr (is_RowMajor_v<M>) {
+                return AsTransposed(xi_matrix);
+            }
+            else {
+                return xi_matrix;
+            }
+        }
+    };
+
+    /**
+    * \brief Householder QR decomposition of a rectangular matrix (whose number of rows is equal or larger then the number of columns).
+    *        solutions are in the linear least squares sense.
+    *        factors are kept in column major layout (a row major matrix is converted once, on construction).
+    *
+    * @param {M, in} matrix type (COLxROW, ROW >= COL)
+    **/
+    template<typename M> class QRFactor {
+        static_assert(is_MatrixBase_v<M> && (Rows_v<M> >= Columns_v<M>), "QRFactor<M> - M must be a matrix whose number of rows is equal or larger then the number of columns.");
+        using _T = underlying_type_t<M>;
+        static constexpr std::size_t COL{ Columns_v<M> },
+                                     ROW{ Rows_v<M> };
+        using Factors = MatrixBase<_T, COL, ROW>;
+
+        // properties
+    private:
+        Factors m_qr;                // R (upper triangular portion) and Householder vectors (below diagonal)
+        VectorBase<_T, COL> m_tau;   // Householder coefficients
+
+        // constructors
+    public:
+
+        explicit QRFactor(const M& xi_matrix) noexcept : m_qr(_T{}) {
+            QRhouseholder(ColumnMajor(xi_matrix), m_qr, m_tau);
+        }
+
+        // accessors
+    public:
+
+        const Factors& factors() const noexcept { return m_qr; }
+        const VectorBase<_T, COL>& tau() const noexcept { return m_tau; }
+
+        // methods
+    public:
+
+        /**
+        * \brief solve min(||A * x - b||)
+        *
+        * @param {vector, in}  b (column vector of length ROW)
+        * @param {vector, out} x (column vector of length COL)
+        **/
+        template<typename V, REQUIRE(Is_VectorOfLength_v<V, ROW> && std::is_same_v<_T, underlying_type_t<V>>)>
+        VectorBase<_T, COL> solve(const V& xi_b) const noexcept {
+            return SolveLeastSquares(m_qr, m_tau, xi_b);
+        }
+
+        // solve min(||A * x - b||), where b is viewed (i.e. - column of another matrix)
+        template<typename T, REQUIRE(std::is_same_v<_T, std::remove_const_t<T>>)>
+        VectorBase<_T, COL> solve(const VectorView<T, ROW>& xi_b) const noexcept {
+            return solve(xi_b.eval());
+        }
+
+        /**
+        * \brief solve min(||A * X - B||)
+        *
+        * @param {matrixBase, in}  B (every column is a right hand side)
+        * @param {matrixBase, out} X (every column is a solution)
+        **/
+        template<std::size_t K>
+        MatrixBase<_T, K, COL> solve(const MatrixBase<_T, K, ROW>& xi_b) const noexcept {
+            return SolveLeastSquares(m_qr, m_tau, xi_b);
+        }
+
+        // determinant of A (cubic matrices only)
+        template<std::size_t C = COL, REQUIRE(C == ROW)>
+        _T determinant() const noexcept {
+            // every non trivial reflector has a determinant of -1
+            _T xo_det{ static_cast<_T>(1) };
+            for (std::size_t i{}; i < COL; ++i) {
+                xo_det *= (m_tau[i] != _T{}) ? -m_qr(i, i) : m_qr(i, i);
+            }
+            return xo_det;
+        }
+
+        // inverse of A (pseudo inverse for rectangular matrices; ROWxCOL)
+        MatrixBase<_T, ROW, COL> inverse() const noexcept {
+            return solve(MatrixBase<_T, ROW, ROW>());
+        }
+    };
+
+}; // namespace GLSLCPP
@@ -5,6 +5,9 @@
 **/
 #pragma once
 #include "common.h"
+#include "Parallel.h"
+#include "LinearAlgebraKernels.h"
+#include "ReductionKernels.h"
 #include "VectorBase.h"
 #include "Swizzle.h"
 #include "ElementWiseOperations.h"
@@ -13,4 +16,13 @@
 #include "Vector4.h"
 #include "MatrixBase.h"
 #include "MatrixOperations.h"
+#include "MatrixView.h"
+#include "PackedMatrix.h"
+#include "Affine.h"
+#include "TrackedMatrix.h"
+#include "TransformHierarchy.h"
+#include "SparseMatrix.h"
 #include "Scalar.h"
+#include "Noise.h"
+#include "Texture.h"
+#include "Factorization.h"
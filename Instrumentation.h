@@ -0,0 +1,138 @@
+/**
+* GLSL++
+*
+* opt-in instrumentation of library entry points.
+* when 'GLSLCPP_INSTRUMENT' is defined (before including the library), every call to an instrumented entry point
+* records its nominal number of floating point operations and bytes moved (read + written) in counters of the calling thread.
+* when 'GLSLCPP_INSTRUMENT' is not defined, instrumentation points expand to nothing.
+*
+* counts are inclusive, i.e. - an entry point which is implemented on top of another (matrix multiplication using 'dot')
+* increments the counters of both. work performed by the library thread pool is recorded only at the entry point.
+*
+* Dan Israel Malta
+**/
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <ostream>
+#include <iomanip>
+
+namespace GLSLCPP {
+
+    namespace instrumentation {
+
+        // instrumented entry points
+        enum class Entry : std::uint8_t {
+            Inv                  = 0,    // 'Inv', 'InvInto'
+            SVD                  = 1,    // 'SVD', 'SVDfast', 'SVDjacobi'
+            LU                   = 2,    // 'LU', 'LUblocked'
+            Dot                  = 3,    // 'dot'
+            MatrixMultiply       = 4,    // matrix * matrix
+            MatrixVectorMultiply = 5,    // matrix * vector, vector * matrix
+            SwizzleConversion    = 6,    // swizzle to vector conversion
+            Count                = 7
+        };
+
+        // entry point name
+        constexpr const char* Name(const Entry xi_entry) noexcept {
+            constexpr const char* names[] = { "Inv", "SVD", "LU", "dot", "matrix * matrix", "matrix * vector", "swizzle conversion" };
+            return (xi_entry < Entry::Count) ? names[static_cast<std::size_t>(xi_entry)] : "";
+        }
+
+        // counters of an entry point
+        struct Counter {
+            std::uint64_t calls{};    // number of calls
+            std::uint64_t flops{};    // nominal number of floating point operations
+            std::uint64_t bytes{};    // bytes read and written
+        };
+
+        // counters of all entry points
+        using Counters = std::array<Counter, static_cast<std::size_t>(Entry::Count)>;
+
+        namespace detail {
+            inline Counters& ThreadCounters() noexcept {
+                thread_local Counters counters{};
+                return counters;
+            }
+        };
+
+        /**
+        * \brief record a call to an entry point (in calling thread counters)
+        *
+        * @param {Entry,    in} entry point
+        * @param {uint64_t, in} number of floating point operations
+        * @param {uint64_t, in} number of bytes read and written
+        **/
+        inline void Record(const Entry xi_entry, const std::uint64_t xi_flops, const std::uint64_t xi_bytes) noexcept {
+            Counter& counter{ detail::ThreadCounters()[static_cast<std::size_t>(xi_entry)] };
+            ++counter.calls;
+            counter.flops += xi_flops;
+            counter.bytes += xi_bytes;
+        }
+
+        // return a copy of calling thread counters
+        inline Counters Snapshot() noexcept {
+            return detail::ThreadCounters();
+        }
+
+        // reset calling thread counters
+        inline void Reset() noexcept {
+            detail::ThreadCounters() = Counters{};
+        }
+
+        /**
+        * \brief write a table of counters (only entry points which were called).
+        *        stream formatting (flags and precision) is restored on return.
+        *
+        * @param {ostream,  in|out} stream
+        * @param {Counters, in}     counters (calling thread counters by default)
+        **/
+        inline void Report(std::ostream& xio_stream, const Counters& xi_counters = Snapshot()) {
+            const std::ios_base::fmtflags flags{ xio_stream.flags() };
+            const std::streamsize precision{ xio_stream.precision() };
+
+            xio_stream << std::left << std::setw(20) << "entry point" << std::right << std::setw(14) << "calls" << std::setw(16) << "flops"
+                       << std::setw(16) << "bytes" << std::setw(14) << "flops/byte" << '\n';
+            for (std::size_t i{}; i < xi_counters.size(); ++i) {
+                const Counter& counter{ xi_counters[i] };
+                if (counter.calls == 0) continue;
+
+                const double intensity{ counter.bytes > 0 ? static_cast<double>(counter.flops) / static_cast<double>(counter.bytes) : 0.0 };
+                xio_stream << std::left << std::setw(20) << Name(static_cast<Entry>(i)) << std::right << std::setw(14) << counter.calls
+                           << std::setw(16) << counter.flops << std::setw(16) << counter.bytes
+                           << std::setw(14) << std::fixed << std::setprecision(3) << intensity << '\n';
+            }
+
+            xio_stream.flags(flags);
+            xio_stream.precision(precision);
+        }
+    };
+
+}; // namespace GLSLCPP
+
+// true during constant evaluation (instrumentation is skipped there)
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define GLSLCPP_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+#if !defined(GLSLCPP_CONSTANT_EVALUATED) && defined(_MSC_VER) && (_MSC_VER >= 1925)
+#define GLSLCPP_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#if !defined(GLSLCPP_CONSTANT_EVALUATED)
+#define GLSLCPP_CONSTANT_EVALUATED() false
+#endif
+
+// instrumentation point: GLSLCPP_RECORD(entry, flops, bytes)
+#ifdef GLSLCPP_INSTRUMENT
+#define GLSLCPP_RECORD(ENTRY, FLOPS, BYTES)                                                                                    \
+    do {                                                                                                                       \
+        if (!GLSLCPP_CONSTANT_EVALUATED()) {                                                                                   \
+            ::GLSLCPP::instrumentation::Record(::GLSLCPP::instrumentation::Entry::ENTRY, static_cast<std::uint64_t>(FLOPS),    \
+                                               static_cast<std::uint64_t>(BYTES));                                             \
+        }                                                                                                                      \
+    } while (false)
+#else
+#define GLSLCPP_RECORD(ENTRY, FLOPS, BYTES) do {} while (false)
+#endif
@@ -0,0 +1,305 @@
+/**
+* GLSL++
+*
+* low level dense linear algebra kernels operating on column major raw storage
+* (element at row 'r' and column 'c' of a matrix with leading dimension 'ld' is located at [c * ld + r]).
+* these are the building blocks of the blocked decompositions and rank updates in MatrixOperations.h.
+*
+* Dan Israel Malta
+**/
+#pragma once
+#include <cstddef>
+#include <utility>
+
+namespace GLSLCPP {
+
+    namespace kernels {
+
+        /**
+        * \brief general matrix multiply-subtract: C = C - A * B
+        *
+        * @param {size_t, in}  number of rows in A and C
+        * @param {size_t, in}  number of columns in B and C
+        * @param {size_t, in}  number of columns in A (= number of rows in B)
+        * @param {T*,     in}  A (m x k)
+        * @param {size_t, in}  A leading dimension
+        * @param {T*,     in}  B (k x n)
+        * @param {size_t, in}  B leading dimension
+        * @param {T*,     out} C (m x n)
+        * @param {size_t, in}  C leading dimension
+        **/
+        template<typename T>
+        void GemmSubtract(const std::size_t m, const std::size_t n, const std::size_t k,
+                          const T* a, const std::size_t lda,
+                          const T* b, const std::size_t ldb,
+                          T* c, const std::size_t ldc) noexcept {
+            // four columns of C are updated together, so every column of A is loaded once per four columns of C
+            std::size_t j{};
+            for (; j + 4 <= n; j += 4) {
+                T* c0{ c + j * ldc };
+                T* c1{ c0 + ldc };
+                T* c2{ c1 + ldc };
+                T* c3{ c2 + ldc };
+                const T* b0{ b + j * ldb };
+                const T* b1{ b0 + ldb };
+                const T* b2{ b1 + ldb };
+                const T* b3{ b2 + ldb };
+
+                for (std::size_t p{}; p < k; ++p) {
+                    const T* ap{ a + p * lda };
+                    const T s0{ b0[p] },
+                            s1{ b1[p] },
+                            s2{ b2[p] },
+                            s3{ b3[p] };
+                    for (std::size_t i{}; i < m; ++i) {
+                        const T ai{ ap[i] };
+                        c0[i] -= ai * s0;
+                        c1[i] -= ai * s1;
+                        c2[i] -= ai * s2;
+                        c3[i] -= ai * s3;
+                    }
+                }
+            }
+            for (; j < n; ++j) {
+                T* cj{ c + j * ldc };
+                const T* bj{ b + j * ldb };
+                for (std::size_t p{}; p < k; ++p) {
+                    const T* ap{ a + p * lda };
+                    const T s{ bj[p] };
+                    for (std::size_t i{}; i < m; ++i) {
+                        cj[i] -= ap[i] * s;
+                    }
+                }
+            }
+        }
+
+        /**
+        * \brief solve L * X = B in place, where L is unit lower triangular (its diagonal is not accessed).
+        *
+        * @param {size_t, in}     dimension of L (and number of rows in B)
+        * @param {size_t, in}     number of columns in B
+        * @param {T*,     in}     L (m x m)
+        * @param {size_t, in}     L leading dimension
+        * @param {T*,     in/out} B (m x n), overwritten by X
+        * @param {size_t, in}     B leading dimension
+        **/
+        template<typename T>
+        void TrsmLowerUnit(const std::size_t m, const std::size_t n,
+                           const T* l, const std::size_t ldl,
+                           T* b, const std::size_t ldb) noexcept {
+            for (std::size_t j{}; j < n; ++j) {
+                T* bj{ b + j * ldb };
+                for (std::size_t k{}; k < m; ++k) {
+                    const T x{ bj[k] };
+                    const T* lk{ l + k * ldl };
+                    for (std::size_t i{ k + 1 }; i < m; ++i) {
+                        bj[i] -= lk[i] * x;
+                    }
+                }
+            }
+        }
+
+        /**
+        * \brief solve L * X = B in place, where L is lower triangular (non unit diagonal).
+        *
+        * @param {size_t, in}     dimension of L (and number of rows in B)
+        * @param {size_t, in}     number of columns in B
+        * @param {T*,     in}     L (m x m)
+        * @param {size_t, in}     L leading dimension
+        * @param {T*,     in/out} B (m x n), overwritten by X
+        * @param {size_t, in}     B leading dimension
+        **/
+        template<typename T>
+        void TrsmLower(const std::size_t m, const std::size_t n,
+                       const T* l, const std::size_t ldl,
+                       T* b, const std::size_t ldb) noexcept {
+            for (std::size_t j{}; j < n; ++j) {
+                T* bj{ b + j * ldb };
+                for (std::size_t k{}; k < m; ++k) {
+                    const T* lk{ l + k * ldl };
+                    bj[k] /= lk[k];
+                    const T x{ bj[k] };
+                    for (std::size_t i{ k + 1 }; i < m; ++i) {
+                        bj[i] -= lk[i] * x;
+                    }
+                }
+            }
+        }
+
+        /**
+        * \brief solve L^T * X = B in place, where L is lower triangular (non unit diagonal).
+        *
+        * @param {size_t, in}     dimension of L (and number of rows in B)
+        * @param {size_t, in}     number of columns in B
+        * @param {T*,     in}     L (m x m)
+        * @param {size_t, in}     L leading dimension
+        * @param {T*,     in/out} B (m x n), overwritten by X
+        * @param {size_t, in}     B leading dimension
+        **/
+        template<typename T>
+        void TrsmLowerTransposed(const std::size_t m, const std::size_t n,
+                                 const T* l, const std::size_t ldl,
+                                 T* b, const std::size_t ldb) noexcept {
+            for (std::size_t j{}; j < n; ++j) {
+                T* bj{ b + j * ldb };
+                for (std::size_t k{ m }; k-- > 0;) {
+                    const T* lk{ l + k * ldl };
+                    T x{ bj[k] };
+                    for (std::size_t i{ k + 1 }; i < m; ++i) {
+                        x -= lk[i] * bj[i];
+                    }
+                    bj[k] = x / lk[k];
+                }
+            }
+        }
+
+        /**
+        * \brief solve U * X = B in place, where U is upper triangular (non unit diagonal).
+        *
+        * @param {size_t, in}     dimension of U (and number of rows in B)
+        * @param {size_t, in}     number of columns in B
+        * @param {T*,     in}     U (m x m)
+        * @param {size_t, in}     U leading dimension
+        * @param {T*,     in/out} B (m x n), overwritten by X
+        * @param {size_t, in}     B leading dimension
+        **/
+        template<typename T>
+        void TrsmUpper(const std::size_t m, const std::size_t n,
+                       const T* u, const std::size_t ldu,
+                       T* b, const std::size_t ldb) noexcept {
+            for (std::size_t j{}; j < n; ++j) {
+                T* bj{ b + j * ldb };
+                for (std::size_t k{ m }; k-- > 0;) {
+                    const T* uk{ u + k * ldu };
+                    bj[k] /= uk[k];
+                    const T x{ bj[k] };
+                    for (std::size_t i{}; i < k; ++i) {
+                        bj[i] -= uk[i] * x;
+                    }
+                }
+            }
+        }
+
+        /**
+        * \brief apply a sequence of row interchanges on columns of a matrix, i.e. - for k = first...last-1: swap rows k and pivot[k].
+        *        interchanges are applied column after column so every column is traversed once.
+        *
+        * @param {size_t,  in}     number of columns
+        * @param {T*,      in/out} matrix
+        * @param {size_t,  in}     matrix leading dimension
+        * @param {size_t*, in}     row interchanges (row k is interchanged with row pivot[k])
+        * @param {size_t,  in}     first interchange
+        * @param {size_t,  in}     one past last interchange
+        **/
+        template<typename T>
+        void Laswp(const std::size_t n, T* a, const std::size_t lda,
+                   const std::size_t* pivot, const std::size_t first, const std::size_t last) noexcept {
+            for (std::size_t j{}; j < n; ++j) {
+                T* aj{ a + j * lda };
+                for (std::size_t k{ first }; k < last; ++k) {
+                    if (pivot[k] != k) {
+                        std::swap(aj[k], aj[pivot[k]]);
+                    }
+                }
+            }
+        }
+
+        /**
+        * \brief general rank-1 update: A = A + alpha * x * y^T
+        *        (the outer product is never formed, every column of A is updated by a scaled copy of x)
+        *
+        * @param {size_t, in}     number of rows in A (length of x)
+        * @param {size_t, in}     number of columns in A (length of y)
+        * @param {T,      in}     alpha
+        * @param {T*,     in}     x
+        * @param {T*,     in}     y
+        * @param {T*,     in/out} A (m x n)
+        * @param {size_t, in}     A leading dimension
+        **/
+        template<typename T>
+        void Ger(const std::size_t m, const std::size_t n, const T alpha,
+                 const T* x, const T* y,
+                 T* a, const std::size_t lda) noexcept {
+            for (std::size_t j{}; j < n; ++j) {
+                T* aj{ a + j * lda };
+                const T s{ alpha * y[j] };
+                for (std::size_t i{}; i < m; ++i) {
+                    aj[i] += x[i] * s;
+                }
+            }
+        }
+
+        /**
+        * \brief symmetric rank-1 update of one triangle (diagonal included): A = A + alpha * x * x^T
+        *        (the other triangle is not accessed)
+        *
+        * @param {size_t, in}     dimension of A (length of x)
+        * @param {T,      in}     alpha
+        * @param {T*,     in}     x
+        * @param {T*,     in/out} A (n x n)
+        * @param {size_t, in}     A leading dimension
+        * @param {bool,   in}     true to update the lower triangle, false to update the upper triangle
+        **/
+        template<typename T>
+        void Syr(const std::size_t n, const T alpha, const T* x,
+                 T* a, const std::size_t lda, const bool lower) noexcept {
+            for (std::size_t j{}; j < n; ++j) {
+                T* aj{ a + j * lda };
+                const T s{ alpha * x[j] };
+                const std::size_t first{ lower ? j : 0 },
+                                  last{ lower ? n : j + 1 };
+                for (std::size_t i{ first }; i < last; ++i) {
+                    aj[i] += x[i] * s;
+                }
+            }
+        }
+
+        /**
+        * \brief symmetric rank-k update of one triangle (diagonal included): A = A + alpha * X * X^T
+        *        (the other triangle is not accessed)
+        *
+        * @param {size_t, in}     dimension of A (number of rows in X)
+        * @param {size_t, in}     number of columns in X (number of accumulated vectors)
+        * @param {T,      in}     alpha
+        * @param {T*,     in}     X (n x k)
+        * @param {size_t, in}     X leading dimension
+        * @param {T*,     in/out} A (n x n)
+        * @param {size_t, in}     A leading dimension
+        * @param {bool,   in}     true to update the lower triangle, false to update the upper triangle
+        **/
+        template<typename T>
+        void Syrk(const std::size_t n, const std::size_t k, const T alpha,
+                  const T* x, const std::size_t ldx,
+                  T* a, const std::size_t lda, const bool lower) noexcept {
+            for (std::size_t j{}; j < n; ++j) {
+                T* aj{ a + j * lda };
+                const std::size_t first{ lower ? j : 0 },
+                                  last{ lower ? n : j + 1 };
+
+                // four vectors are accumulated together, so every column of A is loaded once per four vectors
+                std::size_t p{};
+                for (; p + 4 <= k; p += 4) {
+                    const T* x0{ x + p * ldx };
+                    const T* x1{ x0 + ldx };
+                    const T* x2{ x1 + ldx };
+                    const T* x3{ x2 + ldx };
+                    const T s0{ alpha * x0[j] },
+                            s1{ alpha * x1[j] },
+                            s2{ alpha * x2[j] },
+                            s3{ alpha * x3[j] };
+                    for (std::size_t i{ first }; i < last; ++i) {
+                        aj[i] += x0[i] * s0 + x1[i] * s1 + x2[i] * s2 + x3[i] * s3;
+                    }
+                }
+                for (; p < k; ++p) {
+                    const T* xp{ x + p * ldx };
+                    const T s{ alpha * xp[j] };
+                    for (std::size_t i{ first }; i < last; ++i) {
+                        aj[i] += xp[i] * s;
+                    }
+                }
+            }
+        }
+    };
+
+}; // namespace GLSLCPP
@@ -2,7 +2,7 @@
 * Fixed size rectangular (i.e. ROW x COL) numerical matrix.
 *
 * This object follows the GLSL specification, therfore:
-* > Matrix storage layout is column major.
+* > Matrix storage layout is column major (by default, see 'Layout').
 * > Matrix element access is in the following manner: (column, row)
 * > vector-matrix multiplication convention:
 *   a right vector operand is treated as a column vector, while a left vector
@@ -22,14 +22,16 @@
 #include <limits>
 
 namespace GLSLCPP {
+
     /**
     * \brief fixed size numerical matrix
     *
     * @param {T,      in} underlying type
     * @param {COL,    in} number of columns
     * @param {ROW,    in} number of rows
+    * @param {Layout, in} storage layout (column major by default)
     **/
-    template<typename T, std::size_t COL, std::size_t ROW> class MatrixBase {
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L> class MatrixBase {
         static_assert(std::is_arithmetic<T>::value, "MatrixBase<T,COL, ROW> - T must be of numerical type.");
         static_assert(ROW != 0, "MatrixBase<T,COL, ROW> - ROW/COL parameters must be positive.");
         static_assert(COL != 0, "MatrixBase<T,COL, ROW> - ROW/COL parameters must be positive.");
@@ -43,7 +45,11 @@ namespace GLSLCPP {
 
             // given its column and row indices's, return the appropriate linear index
             constexpr static std::size_t Index(const std::size_t xi_row, const std::size_t xi_col) {
-                return (xi_col * ROW + xi_row);
+                if constexpr (L == Layout::ColumnMajor) {
+                    return (xi_col * ROW + xi_row);
+                } else {
+                    return (xi_row * COL + xi_col);
+                }
             }
 
         // constructors
@@ -51,26 +57,29 @@ namespace GLSLCPP {
 
         // empty constructor for a cubic matrix only (I matrix)
         template<std::size_t c = COL, std::size_t r = ROW, REQUIRE(r == c)> explicit constexpr MatrixBase() : m_data(T{}) {
+            GLSLCPP_TRACK(MatrixBase, Construction);
             for (std::size_t i{}; i < ROW; ++i) {
                 m_data[Index(i, i)] = static_cast<T>(1);
             }
         }
 
         // construct using a single value
-        template<typename U> explicit constexpr MatrixBase(const U xi_value = U{}, REQUIRE(is_ArithmeticConvertible_v<U, T>)) : m_data(xi_value) {}
+        template<typename U> explicit constexpr MatrixBase(const U xi_value = U{}, REQUIRE(is_ArithmeticConvertible_v<U, T>)) : m_data(xi_value) { GLSLCPP_TRACK(MatrixBase, Construction); }
 
-        // construct from VectorBase with ROW*COL elements
-        template<typename U> explicit constexpr MatrixBase(const U& xi_vec, REQUIRE(Is_VectorOfLength_v<U, ROW * COL>)) : m_data(xi_vec) {}
-        template<typename U> explicit constexpr MatrixBase(U&& xi_vec, REQUIRE(Is_VectorOfLength_v<U, ROW* COL>))       : m_data(std::move(xi_vec)) {}
+        // construct from VectorBase with ROW*COL elements (given in storage order)
+        template<typename U> explicit constexpr MatrixBase(const U& xi_vec, REQUIRE(Is_VectorOfLength_v<U, ROW * COL>)) : m_data(xi_vec) { GLSLCPP_TRACK(MatrixBase, Construction); }
+        template<typename U> explicit constexpr MatrixBase(U&& xi_vec, REQUIRE(Is_VectorOfLength_v<U, ROW* COL>))       : m_data(std::move(xi_vec)) { GLSLCPP_TRACK(MatrixBase, Construction); }
 
-        // construct using ROW*COL individual values (of same type)
+        // construct using ROW*COL individual values (of same type, given in storage order)
         template<typename ...Us, REQUIRE((sizeof...(Us) == ROW * COL) && Are_ArithmeticConvertible<Us...>::value)>
-        explicit constexpr MatrixBase(Us... xi_values) : m_data(xi_values...) {}
+        explicit constexpr MatrixBase(Us... xi_values) : m_data(xi_values...) { GLSLCPP_TRACK(MatrixBase, Construction); }
 
         // construct from a smaller matrix (the rest of the matrix shall be an 'I')
-        template<typename U, std::size_t _col, std::size_t _row>
-        explicit constexpr MatrixBase(const MatrixBase<U, _col, _row> & xi_mat,
+        template<typename U, std::size_t _col, std::size_t _row, Layout _layout>
+        explicit constexpr MatrixBase(const MatrixBase<U, _col, _row, _layout> & xi_mat,
             REQUIRE((_col < COL) || (_row < ROW))) : m_data(T{}) {
+            GLSLCPP_TRACK(MatrixBase, Construction);
+
             // make it an 'I' matrix in case the input matrix size is smaller
             if constexpr (COL == ROW) {
                 for (std::size_t i{}; i < ROW; ++i) {
@@ -86,9 +95,11 @@ namespace GLSLCPP {
             }
         }
 
-        template<typename U, std::size_t _col, std::size_t _row>
-        explicit constexpr MatrixBase(MatrixBase<U, _col, _row> && xi_mat,
+        template<typename U, std::size_t _col, std::size_t _row, Layout _layout>
+        explicit constexpr MatrixBase(MatrixBase<U, _col, _row, _layout> && xi_mat,
             REQUIRE((_col < COL) || (_row < ROW))) : m_data(T{}) {
+            GLSLCPP_TRACK(MatrixBase, Construction);
+
             // make it an 'I' matrix in case the input matrix size is smaller
             if constexpr (COL == ROW) {
                 for (std::size_t i{}; i < ROW; ++i) {
@@ -107,6 +118,7 @@ namespace GLSLCPP {
         // construct with columns
         template<typename ...Us, REQUIRE(sizeof...(Us) == COL)>
         explicit constexpr MatrixBase(const Us & ... xi_columns) {
+            GLSLCPP_TRACK(MatrixBase, Construction);
             static_assert(Are_VectorsSimilar<T, ROW, Us...>::value,
                 "When attempting to construct a MatrixBase by its columns, make sure that they are all of length 'ROW' and with identical underlying type.");
             const std::array<VectorBase<T, ROW>, COL> columns{ xi_columns... };
@@ -114,12 +126,44 @@ namespace GLSLCPP {
             for (std::size_t i{}; i < COL; ++i) {
                 const VectorBase<T, ROW> col(columns[i]);
                 for (std::size_t j{}; j < ROW; ++j) {
-                    m_data[i * ROW + j] = static_cast<T>(col[j]);
+                    m_data[Index(j, i)] = static_cast<T>(col[j]);
+                }
+            }
+
+        }
+
+        // construct from a matrix of the same dimensions with the other storage layout
+        template<Layout _layout, REQUIRE(_layout != L)>
+        explicit constexpr MatrixBase(const MatrixBase<T, COL, ROW, _layout>& xi_mat) : m_data(T{}) {
+            GLSLCPP_TRACK(MatrixBase, Construction);
+            for (std::size_t i{}; i < COL; ++i) {
+                for (std::size_t j{}; j < ROW; ++j) {
+                    m_data[Index(j, i)] = xi_mat(i, j);
                 }
             }
+        }
 
+#ifdef GLSLCPP_TRACK_TEMPORARIES
+        // copy semantics (counted)
+        MatrixBase(const MatrixBase& xi_mat) : m_data(xi_mat.m_data) {
+            GLSLCPP_TRACK(MatrixBase, Copy);
+        }
+        MatrixBase& operator=(const MatrixBase& xi_mat) {
+            m_data = xi_mat.m_data;
+            GLSLCPP_TRACK(MatrixBase, Copy);
+            return *this;
         }
 
+        // move semantics (counted, moving fixed size storage copies it)
+        MatrixBase(MatrixBase&& xi_mat) noexcept : m_data(std::move(xi_mat.m_data)) {
+            GLSLCPP_TRACK(MatrixBase, Move);
+        }
+        MatrixBase& operator=(MatrixBase&& xi_mat) noexcept {
+            m_data = std::move(xi_mat.m_data);
+            GLSLCPP_TRACK(MatrixBase, Move);
+            return *this;
+        }
+#else
         // copy semantics
         MatrixBase(const MatrixBase&)            = default;
         MatrixBase& operator=(const MatrixBase&) = default;
@@ -127,6 +171,7 @@ namespace GLSLCPP {
         // move semantics
         MatrixBase(MatrixBase&&)            noexcept = default;
         MatrixBase& operator=(MatrixBase&&) noexcept = default;
+#endif
 
         // assignment operator
     public:
@@ -164,7 +209,8 @@ namespace GLSLCPP {
         // set/get operations
     public:
 
-        // '[]' column access (return column #i)
+        // '[]' column access (return column #i, by reference only for column major layout)
+        template<Layout _layout = L, REQUIRE(_layout == Layout::ColumnMajor)>
         constexpr auto& operator[](const std::size_t i) {
             assert(i < COL && " trying to access a non existent column.");
             return *(VectorBase<T, ROW>*)(&m_data[Index(0, i)]);
@@ -215,7 +261,7 @@ namespace GLSLCPP {
 
         // (element wise) operations with equally size matrix
 #define M_OPERATOR(OP)                                                              \
-       constexpr MatrixBase& operator OP (const MatrixBase<T, COL, ROW>& xi_mat) {  \
+       constexpr MatrixBase& operator OP (const MatrixBase& xi_mat) {               \
            m_data OP xi_mat.m_data;                                                 \
            return *this;                                                            \
        }
@@ -232,9 +278,17 @@ namespace GLSLCPP {
 #undef M_OPERATOR
 
         // cubic matrix compound multiplication
-        constexpr MatrixBase& operator *= (const MatrixBase<T, COL, ROW>& xi_mat) {
+        constexpr MatrixBase& operator *= (const MatrixBase& xi_mat) {
             static_assert(ROW == COL, " MatrixBase: compound multiplication (*=) can only be performed between cubic matrix's of equal dimensions.");
 
+            // row major storage of A is the column major storage of transpose(A), and transpose(A * B) = transpose(B) * transpose(A)
+            if constexpr (L == Layout::RowMajor) {
+                m_data = (AsTransposed(xi_mat) * AsTransposed(*this)).m_data;
+                return *this;
+            }
+
+            GLSLCPP_RECORD(MatrixMultiply, 2 * COL * COL * COL, 3 * sizeof(MatrixBase));
+
             if constexpr (COL == 2) {
                 *this = { m_data[0] * xi_mat(0, 0) + m_data[2] * xi_mat(0, 1),
                           m_data[1] * xi_mat(0, 0) + m_data[3] * xi_mat(0, 1),
@@ -265,9 +319,17 @@ namespace GLSLCPP {
             return *this;
         }
 
-        constexpr MatrixBase& operator *= (MatrixBase<T, COL, ROW>&& xi_mat) {
+        constexpr MatrixBase& operator *= (MatrixBase&& xi_mat) {
             static_assert(ROW == COL, " MatrixBase: compound multiplication (*=) can only be performed between cubic matrix's of equal dimensions.");
 
+            // row major storage of A is the column major storage of transpose(A), and transpose(A * B) = transpose(B) * transpose(A)
+            if constexpr (L == Layout::RowMajor) {
+                m_data = (AsTransposed(xi_mat) * AsTransposed(*this)).m_data;
+                return *this;
+            }
+
+            GLSLCPP_RECORD(MatrixMultiply, 2 * COL * COL * COL, 3 * sizeof(MatrixBase));
+
             if constexpr (COL == 2) {
                 *this = { m_data[0] * xi_mat(0, 0) + m_data[2] * xi_mat(0, 1),
                           m_data[1] * xi_mat(0, 0) + m_data[3] * xi_mat(0, 1),
@@ -330,29 +392,74 @@ namespace GLSLCPP {
         auto crend() noexcept -> decltype(m_data.crend()) { return m_data.m_data.crend(); }
     };
 
+    /**
+    * layout reinterpretation
+    **/
+
+    namespace layout_detail {
+        // the other storage layout
+        constexpr Layout Other(const Layout xi_layout) noexcept {
+            return (xi_layout == Layout::ColumnMajor) ? Layout::RowMajor : Layout::ColumnMajor;
+        }
+    };
+
+    /**
+    * \brief reinterpret a matrix as its transpose stored in the other layout, i.e. - the storage of a row major COLxROW
+    *        matrix is the storage of its column major ROWxCOL transpose (and vice versa). no element is moved or copied.
+    *
+    * @param {MatrixBase, in}  matrix (COLxROW, layout L)
+    * @param {MatrixBase, out} reference to matrix transpose (ROWxCOL, other layout)
+    **/
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L>
+    constexpr const MatrixBase<T, ROW, COL, layout_detail::Other(L)>& AsTransposed(const MatrixBase<T, COL, ROW, L>& xi_mat) noexcept {
+        return *(const MatrixBase<T, ROW, COL, layout_detail::Other(L)>*)(&xi_mat);
+    }
+
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L>
+    constexpr MatrixBase<T, ROW, COL, layout_detail::Other(L)>& AsTransposed(MatrixBase<T, COL, ROW, L>& xi_mat) noexcept {
+        return *(MatrixBase<T, ROW, COL, layout_detail::Other(L)>*)(&xi_mat);
+    }
+
+    /**
+    * \brief return a matrix in column major layout, i.e. - a column major matrix is returned as is (by reference)
+    *        while a row major matrix is converted (for routines whose kernels traverse contiguous columns).
+    *
+    * @param {MatrixBase, in}  matrix (COLxROW)
+    * @param {MatrixBase, out} column major matrix (COLxROW)
+    **/
+    template<typename T, std::size_t COL, std::size_t ROW>
+    constexpr const MatrixBase<T, COL, ROW>& ColumnMajor(const MatrixBase<T, COL, ROW>& xi_mat) noexcept {
+        return xi_mat;
+    }
+
+    template<typename T, std::size_t COL, std::size_t ROW>
+    constexpr MatrixBase<T, COL, ROW> ColumnMajor(const MatrixBase<T, COL, ROW, Layout::RowMajor>& xi_mat) noexcept {
+        return MatrixBase<T, COL, ROW>(xi_mat);
+    }
+
     /**
     * numerical operator overload
     **/
 
     // binary operations without multiplication
-#define M_BINARY_OP_NO_LHS_SCALAR(OP, AOP)                                                                                                    \
-    template<typename T, typename U, std::size_t COL, std::size_t ROW, REQUIRE(is_ArithmeticConvertible_v<U, T>)>                             \
-    constexpr inline MatrixBase<T, COL, ROW> operator OP (MatrixBase<T, COL, ROW>&& xi_mat, const U xi_value) {                               \
-        xi_mat AOP xi_value;                                                                                                                  \
-        return xi_mat;                                                                                                                        \
-    }                                                                                                                                         \
-    template<typename T, typename U, std::size_t COL, std::size_t ROW, REQUIRE(is_ArithmeticConvertible_v<U, T>)>                             \
-    constexpr inline MatrixBase<T, COL, ROW> operator OP (const MatrixBase<T, COL, ROW>& xi_mat, const U xi_value) {                          \
-        auto xo_mat = FWD(xi_mat);                                                                                                            \
-        xo_mat AOP xi_value;                                                                                                                  \
-        return FWD(xo_mat);                                                                                                                   \
-    }                                                                                                                                         \
-    template<typename T, std::size_t COL, std::size_t ROW>                                                                                    \
-    constexpr inline MatrixBase<T, COL, ROW> operator OP (const MatrixBase<T, COL, ROW>& xi_mat1, const MatrixBase<T, COL, ROW>& xi_mat2) {   \
-        auto mat1 = FWD(xi_mat1);                                                                                                             \
-        auto mat2 = FWD(xi_mat2);                                                                                                             \
-        mat1 AOP mat2;                                                                                                                        \
-        return FWD(mat1);                                                                                                                     \
+#define M_BINARY_OP_NO_LHS_SCALAR(OP, AOP)                                                                                                            \
+    template<typename T, typename U, std::size_t COL, std::size_t ROW, Layout L, REQUIRE(is_ArithmeticConvertible_v<U, T>)>                           \
+    constexpr inline MatrixBase<T, COL, ROW, L> operator OP (MatrixBase<T, COL, ROW, L>&& xi_mat, const U xi_value) {                                 \
+        xi_mat AOP xi_value;                                                                                                                          \
+        return xi_mat;                                                                                                                                \
+    }                                                                                                                                                 \
+    template<typename T, typename U, std::size_t COL, std::size_t ROW, Layout L, REQUIRE(is_ArithmeticConvertible_v<U, T>)>                           \
+    constexpr inline MatrixBase<T, COL, ROW, L> operator OP (const MatrixBase<T, COL, ROW, L>& xi_mat, const U xi_value) {                            \
+        auto xo_mat = FWD(xi_mat);                                                                                                                    \
+        xo_mat AOP xi_value;                                                                                                                          \
+        return FWD(xo_mat);                                                                                                                           \
+    }                                                                                                                                                 \
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L>                                                                                  \
+    constexpr inline MatrixBase<T, COL, ROW, L> operator OP (const MatrixBase<T, COL, ROW, L>& xi_mat1, const MatrixBase<T, COL, ROW, L>& xi_mat2) {  \
+        auto mat1 = FWD(xi_mat1);                                                                                                                     \
+        auto mat2 = FWD(xi_mat2);                                                                                                                     \
+        mat1 AOP mat2;                                                                                                                                \
+        return FWD(mat1);                                                                                                                             \
     }
 
     M_BINARY_OP_NO_LHS_SCALAR(+, +=);
@@ -367,28 +474,28 @@ namespace GLSLCPP {
 #undef M_BINARY_OP_NO_LHS_SCALAR
 
     // binary operations with left hand side scalar
-#define M_BINARY_OP_WITH_LHS_SCALAR(OP, AOP)                                                                                       \
-    template<typename T, typename U, std::size_t COL, std::size_t ROW, REQUIRE(is_ArithmeticConvertible_v<U, T>)>                  \
-    constexpr inline MatrixBase<T, COL, ROW> operator OP (MatrixBase<T, COL, ROW>&& xi_mat, const U xi_value) {                    \
-        xi_mat AOP xi_value;                                                                                                       \
-        return xi_mat;                                                                                                             \
-    }                                                                                                                              \
-    template<typename T, typename U, std::size_t COL, std::size_t ROW, REQUIRE(is_ArithmeticConvertible_v<U, T>)>                  \
-    constexpr inline MatrixBase<T, COL, ROW> operator OP (const MatrixBase<T, COL, ROW>& xi_mat, const U xi_value) {               \
-        auto xo_mat = FWD(xi_mat);                                                                                                 \
-        xo_mat AOP xi_value;                                                                                                       \
-        return FWD(xo_mat);                                                                                                        \
-    }                                                                                                                              \
-    template<typename T, typename U, std::size_t COL, std::size_t ROW, REQUIRE(is_ArithmeticConvertible_v<U, T>::value)>           \
-    constexpr inline MatrixBase<T, COL, ROW> operator OP (const U xi_value, MatrixBase<T, COL, ROW>&& xi_mat) {                    \
-        xi_mat AOP xi_value;                                                                                                       \
-        return xi_mat;                                                                                                             \
-    }                                                                                                                              \
-    template<typename T, typename U, std::size_t COL, std::size_t ROW, REQUIRE(is_ArithmeticConvertible_v<U, T>)>                  \
-    constexpr inline MatrixBase<T, COL, ROW> operator OP (const U xi_value, const MatrixBase<T, COL, ROW>& xi_mat) {               \
-        auto xo_mat = FWD(xi_mat);                                                                                                 \
-        xo_mat AOP xi_value;                                                                                                       \
-        return FWD(xo_mat);                                                                                                        \
+#define M_BINARY_OP_WITH_LHS_SCALAR(OP, AOP)                                                                                        \
+    template<typename T, typename U, std::size_t COL, std::size_t ROW, Layout L, REQUIRE(is_ArithmeticConvertible_v<U, T>)>         \
+    constexpr inline MatrixBase<T, COL, ROW, L> operator OP (MatrixBase<T, COL, ROW, L>&& xi_mat, const U xi_value) {               \
+        xi_mat AOP xi_value;                                                                                                        \
+        return xi_mat;                                                                                                              \
+    }                                                                                                                               \
+    template<typename T, typename U, std::size_t COL, std::size_t ROW, Layout L, REQUIRE(is_ArithmeticConvertible_v<U, T>)>         \
+    constexpr inline MatrixBase<T, COL, ROW, L> operator OP (const MatrixBase<T, COL, ROW, L>& xi_mat, const U xi_value) {          \
+        auto xo_mat = FWD(xi_mat);                                                                                                  \
+        xo_mat AOP xi_value;                                                                                                        \
+        return FWD(xo_mat);                                                                                                         \
+    }                                                                                                                               \
+    template<typename T, typename U, std::size_t COL, std::size_t ROW, Layout L, REQUIRE(is_ArithmeticConvertible_v<U, T>::value)>  \
+    constexpr inline MatrixBase<T, COL, ROW, L> operator OP (const U xi_value, MatrixBase<T, COL, ROW, L>&& xi_mat) {               \
+        xi_mat AOP xi_value;                                                                                                        \
+        return xi_mat;                                                                                                              \
+    }                                                                                                                               \
+    template<typename T, typename U, std::size_t COL, std::size_t ROW, Layout L, REQUIRE(is_ArithmeticConvertible_v<U, T>)>         \
+    constexpr inline MatrixBase<T, COL, ROW, L> operator OP (const U xi_value, const MatrixBase<T, COL, ROW, L>& xi_mat) {          \
+        auto xo_mat = FWD(xi_mat);                                                                                                  \
+        xo_mat AOP xi_value;                                                                                                        \
+        return FWD(xo_mat);                                                                                                         \
     }
 
     M_BINARY_OP_WITH_LHS_SCALAR(*, *=);
@@ -413,12 +520,14 @@ namespace GLSLCPP {
     // (row X 1) = (row X col) * (1 X col)
     template<typename T, std::size_t COL, std::size_t ROW, REQUIRE((COL == ROW) && (COL == 2))>
     constexpr inline VectorBase<T, ROW> operator * (const MatrixBase<T, COL, ROW>& xi_mat, const VectorBase<T, COL>& xi_vec) {
+        GLSLCPP_RECORD(MatrixVectorMultiply, 2 * COL * ROW, sizeof(xi_mat) + sizeof(xi_vec) + ROW * sizeof(T));
         return VectorBase<T, 2>(xi_mat(0, 0) * xi_vec[0] + xi_mat(1, 0) * xi_vec[1],
                                 xi_mat(0, 1) * xi_vec[0] + xi_mat(1, 1) * xi_vec[1]);
     }
 
     template<typename T, std::size_t COL, std::size_t ROW, REQUIRE((COL == ROW) && (COL == 3))>
     constexpr inline VectorBase<T, ROW> operator * (const MatrixBase<T, COL, ROW>& xi_mat, const VectorBase<T, COL>& xi_vec) {
+        GLSLCPP_RECORD(MatrixVectorMultiply, 2 * COL * ROW, sizeof(xi_mat) + sizeof(xi_vec) + ROW * sizeof(T));
         return VectorBase<T, 3>(xi_mat(0, 0) * xi_vec[0] + xi_mat(1, 0) * xi_vec[1] + xi_mat(2, 0) * xi_vec[2],
                                 xi_mat(0, 1) * xi_vec[0] + xi_mat(1, 1) * xi_vec[1] + xi_mat(2, 1) * xi_vec[2],
                                 xi_mat(0, 2) * xi_vec[0] + xi_mat(1, 2) * xi_vec[1] + xi_mat(2, 2) * xi_vec[2]);
@@ -426,6 +535,7 @@ namespace GLSLCPP {
 
     template<typename T, std::size_t COL, std::size_t ROW, REQUIRE((COL == ROW) && (COL == 4))>
     constexpr inline VectorBase<T, ROW> operator * (const MatrixBase<T, COL, ROW>& xi_mat, const VectorBase<T, COL>& xi_vec) {
+        GLSLCPP_RECORD(MatrixVectorMultiply, 2 * COL * ROW, sizeof(xi_mat) + sizeof(xi_vec) + ROW * sizeof(T));
         return VectorBase<T, 4>(xi_mat(0, 0) * xi_vec[0] + xi_mat(1, 0) * xi_vec[1] + xi_mat(2, 0) * xi_vec[2] + xi_mat(3, 0) * xi_vec[3],
                                 xi_mat(0, 1) * xi_vec[0] + xi_mat(1, 1) * xi_vec[1] + xi_mat(2, 1) * xi_vec[2] + xi_mat(3, 1) * xi_vec[3],
                                 xi_mat(0, 2) * xi_vec[0] + xi_mat(1, 2) * xi_vec[1] + xi_mat(2, 2) * xi_vec[2] + xi_mat(3, 2) * xi_vec[3],
@@ -434,6 +544,7 @@ namespace GLSLCPP {
 
     template<typename T, std::size_t COL, std::size_t ROW, REQUIRE((COL != ROW) || ((COL == ROW) && (COL > 4)))>
     constexpr VectorBase<T, ROW> operator * (const MatrixBase<T, COL, ROW>& xi_mat, const VectorBase<T, COL>& xi_vec) {
+        GLSLCPP_RECORD(MatrixVectorMultiply, 2 * COL * ROW, sizeof(xi_mat) + sizeof(xi_vec) + ROW * sizeof(T));
         VectorBase<T, ROW> xo_vec;
 
         for (std::size_t i{}; i < ROW; ++i) {
@@ -449,16 +560,24 @@ namespace GLSLCPP {
         return xo_vec;
     }
 
+    // row major matrix * vector (matrix * vector = vector * transpose(matrix), transpose is column major)
+    template<typename T, std::size_t COL, std::size_t ROW>
+    constexpr inline VectorBase<T, ROW> operator * (const MatrixBase<T, COL, ROW, Layout::RowMajor>& xi_mat, const VectorBase<T, COL>& xi_vec) {
+        return xi_vec * AsTransposed(xi_mat);
+    }
+
     // vector * matrix (i.e - left multiply a matrix by a vector; vector is treated as row vector)
     // (1 X col) = (1 X row) * (row X col)
     template<typename T, std::size_t COL, std::size_t ROW, REQUIRE((COL == ROW) && (COL == 2))>
     constexpr inline VectorBase<T, COL> operator * (const VectorBase<T, ROW>& xi_vec, const MatrixBase<T, COL, ROW>& xi_mat) {
+        GLSLCPP_RECORD(MatrixVectorMultiply, 2 * COL * ROW, sizeof(xi_mat) + sizeof(xi_vec) + COL * sizeof(T));
         return VectorBase<T, 2>(xi_vec[0] * xi_mat(0, 0) + xi_vec[1] * xi_mat(0, 1),
                                 xi_vec[0] * xi_mat(1, 0) + xi_vec[1] * xi_mat(1, 1));
     }
 
     template<typename T, std::size_t COL, std::size_t ROW, REQUIRE((COL == ROW) && (COL == 3))>
     constexpr inline VectorBase<T, COL> operator * (const VectorBase<T, ROW>& xi_vec, const MatrixBase<T, COL, ROW>& xi_mat) {
+        GLSLCPP_RECORD(MatrixVectorMultiply, 2 * COL * ROW, sizeof(xi_mat) + sizeof(xi_vec) + COL * sizeof(T));
         return VectorBase<T, 3>(xi_vec[0] * xi_mat(0, 0) + xi_vec[1] * xi_mat(0, 1) + xi_vec[2] * xi_mat(0, 2),
                                 xi_vec[0] * xi_mat(1, 0) + xi_vec[1] * xi_mat(1, 1) + xi_vec[2] * xi_mat(1, 2),
                                 xi_vec[0] * xi_mat(2, 0) + xi_vec[1] * xi_mat(2, 1) + xi_vec[2] * xi_mat(2, 2));
@@ -466,6 +585,7 @@ namespace GLSLCPP {
 
     template<typename T, std::size_t COL, std::size_t ROW, REQUIRE((COL == ROW) && (COL == 4))>
     constexpr inline VectorBase<T, COL> operator * (const VectorBase<T, ROW>& xi_vec, const MatrixBase<T, COL, ROW>& xi_mat) {
+        GLSLCPP_RECORD(MatrixVectorMultiply, 2 * COL * ROW, sizeof(xi_mat) + sizeof(xi_vec) + COL * sizeof(T));
         return VectorBase<T, 4>(xi_vec[0] * xi_mat(0, 0) + xi_vec[1] * xi_mat(0, 1) + xi_vec[2] * xi_mat(0, 2) + xi_vec[3] * xi_mat(0, 3),
                                 xi_vec[0] * xi_mat(1, 0) + xi_vec[1] * xi_mat(1, 1) + xi_vec[2] * xi_mat(1, 2) + xi_vec[3] * xi_mat(1, 3),
                                 xi_vec[0] * xi_mat(2, 0) + xi_vec[1] * xi_mat(2, 1) + xi_vec[2] * xi_mat(2, 2) + xi_vec[3] * xi_mat(2, 3),
@@ -474,6 +594,7 @@ namespace GLSLCPP {
 
     template<typename T, std::size_t COL, std::size_t ROW, REQUIRE((COL != ROW) || ((COL == ROW) && (COL > 4)))>
     constexpr VectorBase<T, COL> operator * (const VectorBase<T, ROW>& xi_vec, const MatrixBase<T, COL, ROW>& xi_mat) {
+        GLSLCPP_RECORD(MatrixVectorMultiply, 2 * COL * ROW, sizeof(xi_mat) + sizeof(xi_vec) + COL * sizeof(T));
         VectorBase<T, COL> xo_vec;
 
         for (std::size_t i{}; i < COL; ++i) {
@@ -489,6 +610,12 @@ namespace GLSLCPP {
         return xo_vec;
     }
 
+    // vector * row major matrix (vector * matrix = transpose(matrix) * vector, transpose is column major)
+    template<typename T, std::size_t COL, std::size_t ROW>
+    constexpr inline VectorBase<T, COL> operator * (const VectorBase<T, ROW>& xi_vec, const MatrixBase<T, COL, ROW, Layout::RowMajor>& xi_mat) {
+        return AsTransposed(xi_mat) * xi_vec;
+    }
+
     // rectangular matrix-matrix multiplication
     // (col x row) = (dim x row) * (col * dim)
     template<typename T, std::size_t COL, std::size_t ROW, std::size_t DIM, REQUIRE((DIM > 1) &&
@@ -499,6 +626,7 @@ namespace GLSLCPP {
                                                                                     (ROW != DIM) && 
                                                                                     std::is_arithmetic_v<T>)>
     constexpr MatrixBase<T, COL, ROW> operator * (const MatrixBase<T, DIM, ROW>& xi_lhs, const MatrixBase<T, COL, DIM>& xi_rhs) {
+        GLSLCPP_RECORD(MatrixMultiply, 2 * COL * ROW * DIM, sizeof(xi_lhs) + sizeof(xi_rhs) + sizeof(MatrixBase<T, COL, ROW>));
         MatrixBase<T, COL, ROW> xo_mat(0);
 
         for (std::size_t i{}; i < ROW; ++i) {
@@ -515,4 +643,39 @@ namespace GLSLCPP {
 
         return xo_mat;
     }
+
+    // rectangular row major matrix-matrix multiplication (transpose(lhs * rhs) = transpose(rhs) * transpose(lhs), transposes are column major)
+    template<typename T, std::size_t COL, std::size_t ROW, std::size_t DIM, REQUIRE((DIM > 1) &&
+                                                                                    (COL > 1) &&
+                                                                                    (ROW > 1) &&
+                                                                                    (COL != ROW) &&
+                                                                                    (COL != DIM) &&
+                                                                                    (ROW != DIM) &&
+                                                                                    std::is_arithmetic_v<T>)>
+    constexpr MatrixBase<T, COL, ROW, Layout::RowMajor> operator * (const MatrixBase<T, DIM, ROW, Layout::RowMajor>& xi_lhs,
+                                                                    const MatrixBase<T, COL, DIM, Layout::RowMajor>& xi_rhs) {
+        return MatrixBase<T, COL, ROW, Layout::RowMajor>((AsTransposed(xi_rhs) * AsTransposed(xi_lhs)).m_data);
+    }
+
+    // matrix-matrix multiplication of operands with different layouts (result has left hand side layout)
+    // (col x row) = (dim x row) * (col * dim)
+    template<typename T, std::size_t COL, std::size_t ROW, std::size_t DIM, Layout L, REQUIRE(std::is_arithmetic_v<T>)>
+    constexpr MatrixBase<T, COL, ROW, L> operator * (const MatrixBase<T, DIM, ROW, L>& xi_lhs, const MatrixBase<T, COL, DIM, layout_detail::Other(L)>& xi_rhs) {
+        GLSLCPP_RECORD(MatrixMultiply, 2 * COL * ROW * DIM, sizeof(xi_lhs) + sizeof(xi_rhs) + sizeof(MatrixBase<T, COL, ROW, L>));
+        MatrixBase<T, COL, ROW, L> xo_mat(0);
+
+        for (std::size_t i{}; i < ROW; ++i) {
+            for (std::size_t j{}; j < COL; ++j) {
+                T _sum{};
+
+                for (std::size_t d{}; d < DIM; ++d) {
+                    _sum += xi_lhs(d, i) * xi_rhs(j, d);
+                }
+
+                xo_mat(j, i) = _sum;
+            }
+        }
+
+        return xo_mat;
+    }
 }; // namespace GLSLCPP
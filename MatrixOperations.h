@@ -7,9 +7,13 @@
 #include "common.h"
 #include "VectorBase.h"
 #include "MatrixBase.h"
+#include "Parallel.h"
+#include "LinearAlgebraKernels.h"
 #include <algorithm>
 #include <functional>
 #include <bitset>
+#include <array>
+#include <vector>
 
 namespace GLSLCPP {
 
@@ -83,14 +87,28 @@ namespace GLSLCPP {
         constexpr std::size_t N{ Length_v<T> };
 
         MatrixBase<TYPE, N, N> xo_mat;
+        OuterProductInto(xo_mat, xi_x, xi_y);
+
+        return xo_mat;
+    }
+
+    /**
+    * \brief given two equally sized vectors, write their outer product into a given (preallocated) matrix
+    *
+    * @param {MatrixBase, out} outer product of input vectors
+    * @param {VectorBase, in}  vector #1
+    * @param {VectorBase, in}  vector #2
+    **/
+    template<typename M, typename T, typename U, REQUIRE(Are_TwoVectorsSimilar_v<T, U> && is_Cubic<M>::value && (Columns_v<M> == Length_v<T>))>
+    constexpr void OuterProductInto(M& xo_mat, const T& xi_x, const U& xi_y) noexcept {
+        using _T = underlying_type_t<M>;
+        constexpr std::size_t N{ Length_v<T> };
 
         for (std::size_t i{}; i < N; ++i) {
             for (std::size_t j{}; j < N; ++j) {
-                xo_mat(i, j) = xi_x[i] * xi_y[j];
+                xo_mat(i, j) = static_cast<_T>(xi_x[i] * xi_y[j]);
             }
         }
-
-        return xo_mat;
     }
 
     /**
@@ -140,11 +158,11 @@ namespace GLSLCPP {
     }
 
     template<typename T, REQUIRE(is_Vector_v<T> && (Length_v<T> == 4))>
-    constexpr inline MatrixBase<underlying_type_t<T>, 3, 3> Householder(const T & xi_vec) noexcept {
+    constexpr inline MatrixBase<underlying_type_t<T>, 4, 4> Householder(const T & xi_vec) noexcept {
         using _T = underlying_type_t<T>;
         constexpr _T one{ static_cast<_T>(1) },
                      two{ static_cast<_T>(-2) };
-        return MatrixBase<_T, 3, 3>(one + two * xi_vec[0] * xi_vec[0],       two * xi_vec[0] * xi_vec[1],       two * xi_vec[0] * xi_vec[2],       two * xi_vec[0] * xi_vec[3],
+        return MatrixBase<_T, 4, 4>(one + two * xi_vec[0] * xi_vec[0],       two * xi_vec[0] * xi_vec[1],       two * xi_vec[0] * xi_vec[2],       two * xi_vec[0] * xi_vec[3],
                                           two * xi_vec[1] * xi_vec[0], one + two * xi_vec[1] * xi_vec[1],       two * xi_vec[1] * xi_vec[2],       two * xi_vec[1] * xi_vec[3],
                                           two * xi_vec[2] * xi_vec[0],       two * xi_vec[2] * xi_vec[1], one + two * xi_vec[2] * xi_vec[2],       two * xi_vec[2] * xi_vec[3],
                                           two * xi_vec[3] * xi_vec[0],       two * xi_vec[3] * xi_vec[1],       two * xi_vec[3] * xi_vec[2], one + two * xi_vec[3] * xi_vec[3]);
@@ -155,14 +173,69 @@ namespace GLSLCPP {
         using _T = underlying_type_t<T>;
         constexpr std::size_t N{ Length_v<T> };
 
-        MatrixBase<_T, N, N> reflect(OuterProduct(xi_vec, xi_vec)),
-                             xo_mat;
-        reflect *= static_cast<_T>(2);
-        xo_mat  -= reflect;
+        // rank-1 update of the identity, column by column (without forming the outer product)
+        MatrixBase<_T, N, N> xo_mat;
+        for (std::size_t c{}; c < N; ++c) {
+            const _T scaled{ static_cast<_T>(-2) * xi_vec[c] };
+            for (std::size_t r{}; r < N; ++r) {
+                xo_mat(c, r) += scaled * xi_vec[r];
+            }
+        }
 
         return xo_mat;
     }
 
+    /**
+    * \brief apply a givens rotation on two rows of a matrix in place (O(COL) operations), i.e. - A = G * A,
+    *        where G is the identity except for G(i, i) = G(j, j) = cosine, G(j, i) = sine and G(i, j) = -sine.
+    *        (for j = i + 1, this is identical to 'GivensRotation(cosine, sine, i) * A')
+    *
+    * @param {MatrixBase, in|out} matrix
+    * @param {size_t,     in}     first row (i)
+    * @param {size_t,     in}     second row (j)
+    * @param {T,          in}     cosine of rotation angle
+    * @param {T,          in}     sine of rotation angle
+    **/
+    template<typename T, REQUIRE(is_MatrixBase_v<T>)>
+    constexpr void ApplyGivens(T& xio_mat, const std::size_t xi_i, const std::size_t xi_j,
+                               const underlying_type_t<T> xi_cosine, const underlying_type_t<T> xi_sine) noexcept {
+        using _T = underlying_type_t<T>;
+        assert((xi_i < Rows_v<T>) && (xi_j < Rows_v<T>) && (xi_i != xi_j) && " ApplyGivens(..., i, j, ...) - rows are out of bound or identical.");
+
+        for (std::size_t c{}; c < Columns_v<T>; ++c) {
+            const _T temp1{ xio_mat(c, xi_i) },
+                     temp2{ xio_mat(c, xi_j) };
+            xio_mat(c, xi_i) =  temp1 * xi_cosine + temp2 * xi_sine;
+            xio_mat(c, xi_j) = -temp1 * xi_sine   + temp2 * xi_cosine;
+        }
+    }
+
+    /**
+    * \brief apply a householder reflection on a matrix in place (O(COL*ROW) operations), i.e. - A = (I - tau * v * v^T) * A.
+    *        (for a normalized 'v' and tau = 2, this is identical to 'Householder(v) * A')
+    *
+    * @param {MatrixBase, in|out} matrix
+    * @param {VectorBase, in}     householder vector (v, length ROW)
+    * @param {T,          in}     reflection coefficient (tau)
+    **/
+    template<typename T, typename V, REQUIRE(is_MatrixBase_v<T> && Is_VectorOfLength_v<V, Rows_v<T>> &&
+                                             std::is_same_v<underlying_type_t<T>, underlying_type_t<V>>)>
+    constexpr void ApplyHouseholder(T& xio_mat, const V& xi_v, const underlying_type_t<T> xi_tau) noexcept {
+        using _T = underlying_type_t<T>;
+
+        for (std::size_t c{}; c < Columns_v<T>; ++c) {
+            _T w{};
+            for (std::size_t r{}; r < Rows_v<T>; ++r) {
+                w += xi_v[r] * xio_mat(c, r);
+            }
+            w *= xi_tau;
+
+            for (std::size_t r{}; r < Rows_v<T>; ++r) {
+                xio_mat(c, r) -= w * xi_v[r];
+            }
+        }
+    }
+
     /**
     * \brief construct a van-der-monde matrix
     *
@@ -256,8 +329,8 @@ namespace GLSLCPP {
     * @param {size_t,     in}  row #2
     * @param {MatrixBase, out} input matrix with swapped rows
     **/
-    template<typename T, std::size_t COL, std::size_t ROW>
-    constexpr inline MatrixBase<T, COL, ROW> SwapRows(MatrixBase<T, COL, ROW>&& xi_matrix, const std::size_t a, const std::size_t b) {
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L>
+    constexpr inline MatrixBase<T, COL, ROW, L> SwapRows(MatrixBase<T, COL, ROW, L>&& xi_matrix, const std::size_t a, const std::size_t b) {
         assert((a < ROW) && (b < ROW) && "MatrixBase::SwapRows - attempting to swap rows which are outside of matrix boundaries.");
 
         for (std::size_t i{}; i < COL; ++i) {
@@ -267,8 +340,8 @@ namespace GLSLCPP {
         return xi_matrix;
     }
 
-    template<typename T, std::size_t COL, std::size_t ROW>
-    constexpr inline MatrixBase<T, COL, ROW> SwapRows(const MatrixBase<T, COL, ROW>& xi_matrix, const std::size_t a, const std::size_t b) {
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L>
+    constexpr inline MatrixBase<T, COL, ROW, L> SwapRows(const MatrixBase<T, COL, ROW, L>& xi_matrix, const std::size_t a, const std::size_t b) {
         assert((a < ROW) && (b < ROW) && "MatrixBase::SwapRows - attempting to swap rows which are outside of matrix boundaries.");
         auto mat = FWD(xi_matrix);
 
@@ -283,13 +356,13 @@ namespace GLSLCPP {
     * \brief swap two columns of a given matrix
     *
     * @param {MatrixBase, in}  matrix whose columns shall be swapped
-    * @param {size_t,     in}  row #1
-    * @param {size_t,     in}  row #2
+    * @param {size_t,     in}  column #1
+    * @param {size_t,     in}  column #2
     * @param {MatrixBase, out} input matrix with swapped columns
     **/
-    template<typename T, std::size_t COL, std::size_t ROW>
-    constexpr inline MatrixBase<T, COL, ROW> SwapColumns(MatrixBase<T, COL, ROW>&& xi_matrix, const std::size_t a, const std::size_t b) {
-        assert((a < ROW) && (b < ROW) && "MatrixBase::SwapColumns - attempting to swap columns which are outside of matrix boundaries.");
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L>
+    constexpr inline MatrixBase<T, COL, ROW, L> SwapColumns(MatrixBase<T, COL, ROW, L>&& xi_matrix, const std::size_t a, const std::size_t b) {
+        assert((a < COL) && (b < COL) && "MatrixBase::SwapColumns - attempting to swap columns which are outside of matrix boundaries.");
 
         for (std::size_t i{}; i < ROW; ++i) {
             std::swap(xi_matrix(a, i), xi_matrix(b, i));
@@ -298,9 +371,9 @@ namespace GLSLCPP {
         return xi_matrix;
     }
 
-    template<typename T, std::size_t COL, std::size_t ROW>
-    constexpr inline MatrixBase<T, COL, ROW> SwapColumns(const MatrixBase<T, COL, ROW>& xi_matrix, const std::size_t a, const std::size_t b) {
-        assert((a < ROW) && (b < ROW) && "MatrixBase::SwapColumns - attempting to swap columns which are outside of matrix boundaries.");
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L>
+    constexpr inline MatrixBase<T, COL, ROW, L> SwapColumns(const MatrixBase<T, COL, ROW, L>& xi_matrix, const std::size_t a, const std::size_t b) {
+        assert((a < COL) && (b < COL) && "MatrixBase::SwapColumns - attempting to swap columns which are outside of matrix boundaries.");
         auto mat = FWD(xi_matrix);
 
         for (std::size_t i{}; i < ROW; ++i) {
@@ -391,35 +464,14 @@ namespace GLSLCPP {
 
     template<typename T, std::size_t COL, std::size_t ROW, REQUIRE((COL == ROW) && (ROW > 4))>
     constexpr inline MatrixBase<T, COL, ROW> Transpose(MatrixBase<T, COL, ROW>&& xi_mat) noexcept {
-        constexpr std::size_t last{ ROW * COL },
-                              size{ last - 1 },
-                              n{ last / COL };
-
-        // housekeeping
-        std::bitset<last> visited;
-
-        // transposing
-        std::size_t cycle{};
-        while (++cycle != last) {
-            // visited this element?
-            if (visited[cycle]) continue;
-
-            // cycle along elements
-            std::size_t a{ cycle };
-            do {
-                a = (a == size) ? (size) : ((n * a) % size);
-                std::swap(xi_mat.m_data[a], xi_mat.m_data[cycle]);
-                visited[a] = true;
-            } while (a != cycle);
-        }
-
-        return xi_mat;
+        TransposeInPlace(xi_mat);
+        return std::move(xi_mat);
     }
 
     template<typename T, std::size_t COL, std::size_t ROW, REQUIRE((COL == ROW) && (ROW == 2))>
     constexpr inline MatrixBase<T, COL, ROW> Transpose(const MatrixBase<T, COL, ROW>& xi_mat) noexcept {
-        return MatrixBase<T, 2, 2>(xi_mat(0, 0), xi_mat(0, 1),
-                                   xi_mat(1, 0), xi_mat(1, 1));
+        return MatrixBase<T, 2, 2>(xi_mat(0, 0), xi_mat(1, 0),
+                                   xi_mat(0, 1), xi_mat(1, 1));
     }
 
     template<typename T, std::size_t COL, std::size_t ROW, REQUIRE((COL == ROW) && (ROW == 3))>
@@ -439,30 +491,52 @@ namespace GLSLCPP {
 
     template<typename T, std::size_t COL, std::size_t ROW, REQUIRE((COL == ROW) && (ROW > 4))>
     constexpr inline MatrixBase<T, ROW, COL> Transpose(const MatrixBase<T, COL, ROW>& xi_mat) noexcept {
-        constexpr std::size_t last{ ROW * COL },
-                              size{ last - 1 },
-                              n{ last / COL };
+        MatrixBase<T, ROW, COL> xo_mat(T{});
+        TransposeInto(xo_mat, xi_mat);
+        return xo_mat;
+    }
 
-        // housekeeping
-        auto mat = FWD(xi_mat);
-        std::bitset<last> visited;
+    // row major matrix storage is its column major transpose storage, which is rearranged into row major layout
+    template<typename T, std::size_t COL, std::size_t ROW>
+    constexpr inline MatrixBase<T, ROW, COL, Layout::RowMajor> Transpose(const MatrixBase<T, COL, ROW, Layout::RowMajor>& xi_mat) noexcept {
+        return MatrixBase<T, ROW, COL, Layout::RowMajor>(AsTransposed(xi_mat));
+    }
 
-        // transposing
-        std::size_t cycle{};
-        while (++cycle != last) {
-            // visited this element?
-            if (visited[cycle]) continue;
+    /**
+    * \brief transpose a cubic matrix in place
+    *
+    * @param {MatrixBase, in|out} matrix to be transposed
+    **/
+    template<typename T, std::size_t N, Layout L>
+    constexpr void TransposeInPlace(MatrixBase<T, N, N, L>& xio_mat) noexcept {
+        for (std::size_t c{ 1 }; c < N; ++c) {
+            for (std::size_t r{}; r < c; ++r) {
+                std::swap(xio_mat(c, r), xio_mat(r, c));
+            }
+        }
+    }
 
-            // cycle along elements
-            std::size_t a{ cycle };
-            do {
-                a = (a == size) ? (size) : ((n * a) % size);
-                std::swap(mat.m_data[a], mat.m_data[cycle]);
-                visited[a] = true;
-            } while (a != cycle);
+    /**
+    * \brief write the transpose of a given matrix into a given (preallocated) matrix.
+    *        destination may alias the source (for cubic matrix).
+    *
+    * @param {MatrixBase, out} transposed matrix (ROWxCOL)
+    * @param {MatrixBase, in}  matrix to be transposed (COLxROW)
+    **/
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L>
+    constexpr void TransposeInto(MatrixBase<T, ROW, COL, L>& xo_mat, const MatrixBase<T, COL, ROW, L>& xi_mat) noexcept {
+        if constexpr (COL == ROW) {
+            if (&xo_mat == &xi_mat) {
+                TransposeInPlace(xo_mat);
+                return;
+            }
         }
 
-        return FWD(mat);
+        for (std::size_t c{}; c < COL; ++c) {
+            for (std::size_t r{}; r < ROW; ++r) {
+                xo_mat(r, c) = xi_mat(c, r);
+            }
+        }
     }
 
     /**
@@ -481,6 +555,147 @@ namespace GLSLCPP {
         return xo_mat;
     }
 
+    // --------------------
+    // --- rank updates ---
+    // --------------------
+
+    /**
+    * \brief in place rank-1 update, i.e. - A = A + alpha * x * y^T (A(c, r) += alpha * x[r] * y[c]),
+    *        without forming the outer product.
+    *        notice that 'OuterProduct(x, y)' is y * x^T, so 'A += OuterProduct(x, y)' is 'RankOneUpdate(A, 1, y, x)'.
+    *
+    * @param {MatrixBase, in|out} matrix (COL x ROW)
+    * @param {T,          in}     alpha
+    * @param {VectorBase, in}     x (length ROW)
+    * @param {VectorBase, in}     y (length COL)
+    **/
+    template<typename M, typename T, typename U, REQUIRE(is_MatrixBase_v<M> && Is_VectorOfLength_v<T, Rows_v<M>> && Is_VectorOfLength_v<U, Columns_v<M>> &&
+                                                         std::is_same_v<underlying_type_t<M>, underlying_type_t<T>> &&
+                                                         std::is_same_v<underlying_type_t<M>, underlying_type_t<U>>)>
+    void RankOneUpdate(M& xio_mat, const underlying_type_t<M> xi_alpha, const T& xi_x, const U& xi_y) noexcept {
+        constexpr std::size_t COL{ Columns_v<M> },
+                              ROW{ Rows_v<M> };
+
+        // row major storage is the column major storage of the transpose, i.e. - A^T = A^T + alpha * y * x^T
+        if constexpr (is_RowMajor_v<M>) {
+            kernels::Ger(COL, ROW, xi_alpha, summation_detail::Data(xi_y), summation_detail::Data(xi_x), &xio_mat.m_data[0], COL);
+        } else {
+            kernels::Ger(ROW, COL, xi_alpha, summation_detail::Data(xi_x), summation_detail::Data(xi_y), &xio_mat.m_data[0], ROW);
+        }
+    }
+
+    /**
+    * \brief in place rank-k update from a stream of vector pairs, i.e. - A = A + alpha * sum(x_i * y_i^T),
+    *        without forming the outer products (vectors are packed in blocks and accumulated with a matrix multiply kernel).
+    *
+    * @param {MatrixBase, in|out} matrix (COL x ROW)
+    * @param {T,          in}     alpha
+    * @param {iterator,   in}     first x vector (length ROW)
+    * @param {iterator,   in}     end of x vectors
+    * @param {iterator,   in}     first y vector (length COL), there are as many y vectors as x vectors
+    **/
+    template<typename M, typename IX, typename IY, REQUIRE(is_MatrixBase_v<M> &&
+                                                           Is_VectorOfLength_v<std::decay_t<decltype(*std::declval<IX>())>, Rows_v<M>> &&
+                                                           Is_VectorOfLength_v<std::decay_t<decltype(*std::declval<IY>())>, Columns_v<M>>)>
+    void RankKUpdate(M& xio_mat, const underlying_type_t<M> xi_alpha, IX xi_xFirst, const IX xi_xLast, IY xi_yFirst) noexcept {
+        using _T = underlying_type_t<M>;
+        constexpr std::size_t BLOCK{ 8 };
+        constexpr bool ROW_MAJOR{ is_RowMajor_v<M> };
+
+        // row major storage is the column major storage of the transpose, i.e. - the roles of x and y are exchanged
+        constexpr std::size_t M_{ ROW_MAJOR ? Columns_v<M> : Rows_v<M> },
+                              N_{ ROW_MAJOR ? Rows_v<M> : Columns_v<M> };
+
+        // packed blocks: -alpha * [x_0 ... x_k] (M_ x k) and [y_0 ... y_k]^T (k x N_)
+        std::array<_T, M_ * BLOCK> left;
+        std::array<_T, BLOCK * N_> right;
+        const auto pack = [&](const auto& xi_left, const auto& xi_right, const std::size_t xi_k) {
+            for (std::size_t i{}; i < M_; ++i) {
+                left[xi_k * M_ + i] = -xi_alpha * xi_left[i];
+            }
+            for (std::size_t j{}; j < N_; ++j) {
+                right[j * BLOCK + xi_k] = xi_right[j];
+            }
+        };
+
+        while (xi_xFirst != xi_xLast) {
+            std::size_t count{};
+            for (; (count < BLOCK) && (xi_xFirst != xi_xLast); ++count, ++xi_xFirst, ++xi_yFirst) {
+                if constexpr (ROW_MAJOR) {
+                    pack(*xi_yFirst, *xi_xFirst, count);
+                } else {
+                    pack(*xi_xFirst, *xi_yFirst, count);
+                }
+            }
+
+            kernels::GemmSubtract(M_, N_, count, left.data(), M_, right.data(), BLOCK, &xio_mat.m_data[0], M_);
+        }
+    }
+
+    /**
+    * \brief in place symmetric rank-1 update of the lower triangle (diagonal included), i.e. - A = A + alpha * x * x^T.
+    *        the upper triangle is not accessed (it can be filled using 'SymmetrizeFromLower').
+    *
+    * @param {MatrixBase, in|out} cubic matrix
+    * @param {T,          in}     alpha
+    * @param {VectorBase, in}     x
+    **/
+    template<typename M, typename T, REQUIRE(is_Cubic<M>::value && Is_VectorOfLength_v<T, Rows_v<M>> &&
+                                             std::is_same_v<underlying_type_t<M>, underlying_type_t<T>>)>
+    void SymmetricRankOneUpdate(M& xio_mat, const underlying_type_t<M> xi_alpha, const T& xi_x) noexcept {
+        constexpr std::size_t N{ Rows_v<M> };
+
+        // lower triangle of a row major matrix is the upper triangle of its storage
+        kernels::Syr(N, xi_alpha, summation_detail::Data(xi_x), &xio_mat.m_data[0], N, !is_RowMajor_v<M>);
+    }
+
+    /**
+    * \brief in place symmetric rank-k update of the lower triangle (diagonal included) from a stream of vectors,
+    *        i.e. - A = A + alpha * sum(x_i * x_i^T). the upper triangle is not accessed (it can be filled using 'SymmetrizeFromLower').
+    *
+    * @param {MatrixBase, in|out} cubic matrix
+    * @param {T,          in}     alpha
+    * @param {iterator,   in}     first vector
+    * @param {iterator,   in}     end of vectors
+    **/
+    template<typename M, typename I, REQUIRE(is_Cubic<M>::value && Is_VectorOfLength_v<std::decay_t<decltype(*std::declval<I>())>, Rows_v<M>>)>
+    void SymmetricRankKUpdate(M& xio_mat, const underlying_type_t<M> xi_alpha, I xi_first, const I xi_last) noexcept {
+        using _T = underlying_type_t<M>;
+        constexpr std::size_t N{ Rows_v<M> },
+                              BLOCK{ 8 };
+
+        // packed block of vectors (N x k)
+        std::array<_T, N * BLOCK> packed;
+        while (xi_first != xi_last) {
+            std::size_t count{};
+            for (; (count < BLOCK) && (xi_first != xi_last); ++count, ++xi_first) {
+                const auto& x{ *xi_first };
+                for (std::size_t i{}; i < N; ++i) {
+                    packed[count * N + i] = x[i];
+                }
+            }
+
+            // lower triangle of a row major matrix is the upper triangle of its storage
+            kernels::Syrk(N, count, xi_alpha, packed.data(), N, &xio_mat.m_data[0], N, !is_RowMajor_v<M>);
+        }
+    }
+
+    /**
+    * \brief copy the lower triangle of a matrix to its upper triangle (making it symmetric)
+    *
+    * @param {MatrixBase, in|out} cubic matrix
+    **/
+    template<typename M, REQUIRE(is_Cubic<M>::value)>
+    constexpr void SymmetrizeFromLower(M& xio_mat) noexcept {
+        constexpr std::size_t N{ Rows_v<M> };
+
+        for (std::size_t c{}; c < N; ++c) {
+            for (std::size_t r{ c + 1 }; r < N; ++r) {
+                xio_mat(r, c) = xio_mat(c, r);
+            }
+        }
+    }
+
     // ---------------
     // --- getters ---
     // ---------------
@@ -579,28 +794,44 @@ namespace GLSLCPP {
     }
 
     /**
-    * \brief return a block of a given matrix, where the bloc size is known at compile time
+    * \brief write a block of a given matrix into a given (preallocated) matrix, where the bloc size is known at compile time
     *
-    * @param {MatrixBase,  in}  matrix whos block will be extracted
     * @param {std::size_t, in}  column start
     * @param {std::size_t, in}  column end
     * @param {std::size_t, in}  row start
     * @param {std::size_t, in}  row end
     * @param {MatrixBase,  out} block
+    * @param {MatrixBase,  in}  matrix whos block will be extracted
     **/
     template<std::size_t COL_MIN, std::size_t COL_MAX, 
              std::size_t ROW_MIN, std::size_t ROW_MAX,
              typename T, std::size_t COL, std::size_t ROW,
              REQUIRE((ROW_MIN < ROW_MAX) && (COL_MIN < COL_MAX) && (ROW_MAX <= ROW) && (COL_MAX <= COL))>
-    constexpr inline MatrixBase<T, COL_MAX - COL_MIN + 1, ROW_MAX - ROW_MIN + 1> GetBlock(const MatrixBase<T, COL, ROW>& xi_matrix) noexcept {
-        MatrixBase<T, COL_MAX - COL_MIN + 1, ROW_MAX - ROW_MIN + 1> xo_block(T{});
-
+    constexpr inline void GetBlockInto(MatrixBase<T, COL_MAX - COL_MIN + 1, ROW_MAX - ROW_MIN + 1>& xo_block, const MatrixBase<T, COL, ROW>& xi_matrix) noexcept {
         for (std::size_t j{ COL_MIN }; j <= COL_MAX; ++j) {
             for (std::size_t i{ ROW_MIN }; i <= ROW_MAX; ++i) {
                  xo_block(j - COL_MIN, i - ROW_MIN) = xi_matrix(j, i);
             }
         }
+    }
 
+    /**
+    * \brief return a block of a given matrix, where the bloc size is known at compile time
+    *
+    * @param {MatrixBase,  in}  matrix whos block will be extracted
+    * @param {std::size_t, in}  column start
+    * @param {std::size_t, in}  column end
+    * @param {std::size_t, in}  row start
+    * @param {std::size_t, in}  row end
+    * @param {MatrixBase,  out} block
+    **/
+    template<std::size_t COL_MIN, std::size_t COL_MAX, 
+             std::size_t ROW_MIN, std::size_t ROW_MAX,
+             typename T, std::size_t COL, std::size_t ROW,
+             REQUIRE((ROW_MIN < ROW_MAX) && (COL_MIN < COL_MAX) && (ROW_MAX <= ROW) && (COL_MAX <= COL))>
+    constexpr inline MatrixBase<T, COL_MAX - COL_MIN + 1, ROW_MAX - ROW_MIN + 1> GetBlock(const MatrixBase<T, COL, ROW>& xi_matrix) noexcept {
+        MatrixBase<T, COL_MAX - COL_MIN + 1, ROW_MAX - ROW_MIN + 1> xo_block(T{});
+        GetBlockInto<COL_MIN, COL_MAX, ROW_MIN, ROW_MAX>(xo_block, xi_matrix);
         return xo_block;
     }
 
@@ -691,7 +922,7 @@ namespace GLSLCPP {
                 xi_matrix(0, 2) * det2 - xi_matrix(0, 3) * det3);
     }
 
-    template<typename T, REQUIRE(is_Cubic<T>::value && (Rows_v<T> > 4))>
+    template<typename T, REQUIRE(is_Cubic<T>::value && (Rows_v<T> > 4) && !is_RowMajor_v<T>)>
     constexpr inline underlying_type_t<T> Determinant(const T& xi_matrix) noexcept {
         using _T = underlying_type_t<T>;
         constexpr std::size_t COL{ Columns_v<T> };
@@ -711,15 +942,22 @@ namespace GLSLCPP {
         return xo_det;
     }
 
+    // a matrix and its transpose share their determinant, so a row major matrix is decomposed as its (column major) transpose
+    template<typename T, REQUIRE(is_Cubic<T>::value && (Rows_v<T> > 4) && is_RowMajor_v<T>)>
+    constexpr inline underlying_type_t<T> Determinant(const T& xi_matrix) noexcept {
+        return Determinant(AsTransposed(xi_matrix));
+    }
+
     /** \brief return the inverse of a given matrix (cubic).
     *          notice that assertion is the only way to test if matrix is singular (invertible).
     *
     * @param {matrix,  in}  matrix
     * @param {matrix,  out} matrix inverse
     **/
-    template<typename T, REQUIRE(is_Cubic<T>::value && (Rows_v<T> == 2))>
+    template<typename T, REQUIRE(is_Cubic<T>::value && (Rows_v<T> == 2) && !is_RowMajor_v<T>)>
     constexpr inline T Inv(const T& xi_matrix) noexcept {
         using _T = underlying_type_t<T>;
+        GLSLCPP_RECORD(Inv, 2 * 2 * 2 * 2, 2 * sizeof(T));
 
         const _T det{ Determinant(xi_matrix) };
         assert(std::abs(det) > std::numeric_limits<_T>::epsilon() && " attempting to inverse a not invertiable matrix.");
@@ -729,9 +967,10 @@ namespace GLSLCPP {
                                     -xi_matrix(1, 0) * detInv,  xi_matrix(0, 0) * detInv );
     }
 
-    template<typename T, REQUIRE(is_Cubic<T>::value && (Rows_v<T> == 3))>
+    template<typename T, REQUIRE(is_Cubic<T>::value && (Rows_v<T> == 3) && !is_RowMajor_v<T>)>
     constexpr inline T Inv(const T& xi_matrix) noexcept {
         using _T = underlying_type_t<T>;
+        GLSLCPP_RECORD(Inv, 2 * 3 * 3 * 3, 2 * sizeof(T));
 
         const _T det{ Determinant(xi_matrix) };
         assert(std::abs(det) > std::numeric_limits<_T>::epsilon() && " attempting to inverse a not invertiable matrix.");
@@ -748,9 +987,10 @@ namespace GLSLCPP {
                                      (xi_matrix(0, 0) * xi_matrix(1, 1) - xi_matrix(1, 0) * xi_matrix(0, 1)) * detInv );
     }
 
-    template<typename T, REQUIRE(is_Cubic<T>::value && (Rows_v<T> == 4))>
+    template<typename T, REQUIRE(is_Cubic<T>::value && (Rows_v<T> == 4) && !is_RowMajor_v<T>)>
     constexpr inline T Inv(const T& xi_matrix) noexcept {
         using _T = underlying_type_t<T>;
+        GLSLCPP_RECORD(Inv, 2 * 4 * 4 * 4, 2 * sizeof(T));
 
         MatrixBase<_T, 4, 4> xo_inv( xi_matrix.m_data[5] * xi_matrix.m_data[10] * xi_matrix.m_data[15] - xi_matrix.m_data[5] * xi_matrix.m_data[11] * xi_matrix.m_data[14] - xi_matrix.m_data[9] * xi_matrix.m_data[6] * xi_matrix.m_data[15] + xi_matrix.m_data[9] * xi_matrix.m_data[7] * xi_matrix.m_data[14] + xi_matrix.m_data[13] * xi_matrix.m_data[6] * xi_matrix.m_data[11] - xi_matrix.m_data[13] * xi_matrix.m_data[7] * xi_matrix.m_data[10],
                                     -xi_matrix.m_data[1] * xi_matrix.m_data[10] * xi_matrix.m_data[15] + xi_matrix.m_data[1] * xi_matrix.m_data[11] * xi_matrix.m_data[14] + xi_matrix.m_data[9] * xi_matrix.m_data[2] * xi_matrix.m_data[15] - xi_matrix.m_data[9] * xi_matrix.m_data[3] * xi_matrix.m_data[14] - xi_matrix.m_data[13] * xi_matrix.m_data[2] * xi_matrix.m_data[11] + xi_matrix.m_data[13] * xi_matrix.m_data[3] * xi_matrix.m_data[10],
@@ -778,13 +1018,22 @@ namespace GLSLCPP {
         return xo_inv;
     }
 
-    template<typename T, REQUIRE(is_Cubic<T>::value && (Rows_v<T> > 4))>
+    template<typename T, REQUIRE(is_Cubic<T>::value && (Rows_v<T> > 4) && !is_RowMajor_v<T>)>
     constexpr inline T Inv(const T& xi_matrix) noexcept {
         using _T = underlying_type_t<T>;
         constexpr std::size_t COL{ Columns_v<T> };
 
+        T xo_inv( _T{} );
+
+        // large matrices
+        if constexpr (COL > 8) {
+            InvInto(xo_inv, xi_matrix);
+            return xo_inv;
+        }
+        GLSLCPP_RECORD(Inv, 2 * COL * COL * COL, 2 * sizeof(T));
+
         // LU decompose
-        T lu, xo_inv( _T{} );
+        T lu;
         VectorBase<std::size_t, COL> P;
         std::int32_t sign{};
         LU(xi_matrix, lu, P, sign);
@@ -813,6 +1062,51 @@ namespace GLSLCPP {
         return xo_inv;
     }
 
+    // the inverse of a transpose is the transpose of the inverse, so a row major matrix is inverted as its (column major) transpose
+    template<typename T, REQUIRE(is_Cubic<T>::value && is_RowMajor_v<T>)>
+    constexpr inline T Inv(const T& xi_matrix) noexcept {
+        return AsTransposed(Inv(AsTransposed(xi_matrix)));
+    }
+
+    /** \brief write the inverse of a given matrix (cubic) into a given (preallocated) matrix.
+    *          destination may alias the source.
+    *          matrices larger than 8x8 are inverted without temporaries besides their LU decomposition.
+    *
+    * @param {matrix,  out} matrix inverse
+    * @param {matrix,  in}  matrix
+    **/
+    template<typename T, REQUIRE(is_Cubic<T>::value && !is_RowMajor_v<T>)>
+    void InvInto(T& xo_inv, const T& xi_matrix) noexcept {
+        using _T = underlying_type_t<T>;
+        constexpr std::size_t COL{ Columns_v<T> };
+
+        if constexpr (COL <= 8) {
+            xo_inv = Inv(xi_matrix);
+        }
+        else {
+            GLSLCPP_RECORD(Inv, 2 * COL * COL * COL, 2 * sizeof(T));
+
+            // LU decompose (decomposition is a copy, so destination may alias the source)
+            T lu;
+            VectorBase<std::size_t, COL> P;
+            std::int32_t sign{};
+            LU(xi_matrix, lu, P, sign);
+
+            // solve L * U * inv = P using triangular solve kernels
+            xo_inv = _T{};
+            for (std::size_t i{}; i < COL; ++i) {
+                xo_inv(P[i], i) = static_cast<_T>(1);
+            }
+            kernels::TrsmLowerUnit(COL, COL, &lu.m_data[0], COL, &xo_inv.m_data[0], COL);
+            kernels::TrsmUpper(COL, COL, &lu.m_data[0], COL, &xo_inv.m_data[0], COL);
+        }
+    }
+
+    template<typename T, REQUIRE(is_Cubic<T>::value && is_RowMajor_v<T>)>
+    void InvInto(T& xo_inv, const T& xi_matrix) noexcept {
+        InvInto(AsTransposed(xo_inv), AsTransposed(xi_matrix));
+    }
+
     /**
     * \brief orthonormalize a given matrix (make it columns orthogonal and normalized)
     *        using modified gram-schmidt process.
@@ -822,32 +1116,147 @@ namespace GLSLCPP {
     **/
     template<typename T, REQUIRE(is_MatrixBase_v<T>)>
     constexpr T Orthonormalize(const T& xi_matrix) noexcept {
-        using _T = underlying_type_t<T>;
+        T xo_mat(xi_matrix);
+        OrthonormalizeInPlace(xo_mat);
+        return xo_mat;
+    }
+
+    /**
+    * \brief orthonormalize a given matrix in place using modified gram-schmidt process.
+    *
+    * @param {matrixBase, in|out} matrix to be orthonormalized
+    **/
+    template<typename T, REQUIRE(is_MatrixBase_v<T>)>
+    constexpr void OrthonormalizeInPlace(T& xio_matrix) noexcept {
         constexpr std::size_t COL{ Columns_v<T> };
 
-        // gram-schmidt
-        T xo_mat;
-        for (std::size_t i{}; i < COL; ++i) {
-            xo_mat[i] = xi_matrix[i];
+        // columns are strided in row major layout, so a column major copy is orthonormalized
+        if constexpr (is_RowMajor_v<T>) {
+            MatrixBase<underlying_type_t<T>, COL, Rows_v<T>> mat(xio_matrix);
+            OrthonormalizeInPlace(mat);
+            xio_matrix = T(mat);
+        }
+        else {
+            // gram-schmidt
+            for (std::size_t i{}; i < COL; ++i) {
+                for (std::size_t j{}; j < i; ++j) {
+                    xio_matrix[i] -= ProjectOn(xio_matrix[i], xio_matrix[j]);
+                }
 
-            for (std::size_t j{}; j < i; ++j) {
-                xo_mat[i] -= ProjectOn(xo_mat[i], xo_mat[j]);
+                xio_matrix[i] = Normalize(std::move(xio_matrix[i]));
             }
-
-            xo_mat[i] = Normalize(std::move(xo_mat[i]));
         }
-
-        return xo_mat;
     }
 
     // ----------------------
     // --- Decompositions ---
     // ----------------------
 
+    /**
+    * \brief perform LU decomposition (with partial pivoting) of a cubic matrix using a right looking blocked algorithm,
+    *        i.e. - each panel of BLOCK columns is factorized (row interchanges are applied only within the panel),
+    *               the interchanges are then applied on the trailing columns which are updated by a triangular solve
+    *               followed by a single matrix multiplication (A22 -= A21 * A12).
+    *               interchanges of columns left of the panel are deferred to the end of the factorization.
+    *        output is identical in form to 'LU'.
+    *
+    * @param {matrixBase, in}  cubic matrix to be decomposed
+    * @param {matrixBase, out} decomposed matrix, such that its upper triangular portion
+    *                          is the 'U' portion, and its lower triangulat portion is the 'L' portion.
+    *                          lower triangular matrix should have its diagonal as '1'.
+    * @param {VectorBase, out} decomposition pivot vector (row vector, i.e - VectorN<std::size_t, COL>)
+    * @param {INT32_T,    out} pivot sign
+    **/
+    template<std::size_t BLOCK = 16, typename T, typename U, REQUIRE(is_Cubic<T>::value && !is_RowMajor_v<T> && Is_VectorOfLength_v<U, Columns_v<T>> && std::is_same_v<std::size_t, underlying_type_t<U>>)>
+    void LUblocked(const T& xi_matrix, T& xo_lu, U& xo_pivot, std::int32_t& xo_sign) noexcept {
+        static_assert(BLOCK > 0, "LUblocked panel width must be positive.");
+        using _T = underlying_type_t<T>;
+        constexpr std::size_t N{ Columns_v<T> };
+        GLSLCPP_RECORD(LU, 2 * N * N * N / 3, 2 * sizeof(T) + sizeof(U));
+
+        xo_lu = xi_matrix;
+        _T* a{ &xo_lu.m_data[0] };
+        std::array<std::size_t, N> interchange;
+
+        for (std::size_t k{}; k < N; k += BLOCK) {
+            const std::size_t nb{ std::min(BLOCK, N - k) },
+                              end{ k + nb },
+                              trailing{ N - end };
+
+            // panel factorization
+            for (std::size_t c{ k }; c < end; ++c) {
+                _T* column{ a + c * N };
+
+                // find pivot
+                std::size_t pivot{ c };
+                for (std::size_t r{ c + 1 }; r < N; ++r) {
+                    if (std::abs(column[r]) > std::abs(column[pivot])) {
+                        pivot = r;
+                    }
+                }
+
+                // exchange pivot (panel columns only)
+                interchange[c] = pivot;
+                if (pivot != c) {
+                    for (std::size_t cc{ k }; cc < end; ++cc) {
+                        std::swap(a[cc * N + pivot], a[cc * N + c]);
+                    }
+                }
+
+                // calculate multipliers and eliminate c-th column within the panel
+                if (column[c] != _T{}) {
+                    for (std::size_t r{ c + 1 }; r < N; ++r) {
+                        column[r] /= column[c];
+                    }
+
+                    for (std::size_t cc{ c + 1 }; cc < end; ++cc) {
+                        _T* target{ a + cc * N };
+                        const _T u{ target[c] };
+                        for (std::size_t r{ c + 1 }; r < N; ++r) {
+                            target[r] -= column[r] * u;
+                        }
+                    }
+                }
+            }
+
+            if (trailing == 0) continue;
+
+            // trailing columns: interchange, A12 = L11^-1 * A12, A22 -= A21 * A12
+            _T* a12{ a + end * N + k };
+            kernels::Laswp(trailing, a + end * N, N, interchange.data(), k, end);
+            kernels::TrsmLowerUnit(nb, trailing, a + k * N + k, N, a12, N);
+            kernels::GemmSubtract(trailing, trailing, nb, a + k * N + end, N, a12, N, a12 + nb, N);
+        }
+
+        // deferred interchanges of columns left of each panel
+        for (std::size_t k{ BLOCK }; k < N; k += BLOCK) {
+            kernels::Laswp(k, a, N, interchange.data(), k, std::min(k + BLOCK, N));
+        }
+
+        // interchanges to permutation
+        xo_pivot = [](const std::size_t i) { return i; };
+        xo_sign = 1;
+        for (std::size_t i{}; i < N; ++i) {
+            if (interchange[i] != i) {
+                std::swap(xo_pivot[i], xo_pivot[interchange[i]]);
+                xo_sign = -xo_sign;
+            }
+        }
+    }
+
+    // panels are contiguous columns, so a row major matrix is decomposed as a column major copy
+    template<std::size_t BLOCK = 16, typename T, typename U, REQUIRE(is_Cubic<T>::value && is_RowMajor_v<T> && Is_VectorOfLength_v<U, Columns_v<T>> && std::is_same_v<std::size_t, underlying_type_t<U>>)>
+    void LUblocked(const T& xi_matrix, T& xo_lu, U& xo_pivot, std::int32_t& xo_sign) noexcept {
+        MatrixBase<underlying_type_t<T>, Columns_v<T>, Rows_v<T>> lu;
+        LUblocked<BLOCK>(ColumnMajor(xi_matrix), lu, xo_pivot, xo_sign);
+        xo_lu = T(lu);
+    }
+
     /**
     * \brief perform LU decomposition of a cubic matrix (using Doolittle algorithm),
     *        i.e. - given matrix A, decompose it to L*P*U, where L is lower traingular with unit diagonal,
     *               U is an upper triangular and P is a diagonal pivot matrix (given as a vector holding its diagonal)
+    *        matrices larger than 8x8 are decomposed using 'LUblocked'.
     *
     * @param {matrixBase, in}  cubic matrix to be decomposed
     * @param {matrixBase, out} decomposed matrix, such that its upper triangular portion
@@ -861,6 +1270,12 @@ namespace GLSLCPP {
         using _T = underlying_type_t<T>;
         constexpr std::size_t COL{ Columns_v<T> };
 
+        if constexpr (COL > 8) {
+            LUblocked(xi_matrix, xo_lu, xo_pivot, xo_sign);
+            return;
+        }
+        GLSLCPP_RECORD(LU, 2 * COL * COL * COL / 3, 2 * sizeof(T) + sizeof(U));
+
         xo_lu = xi_matrix;
         xo_pivot = [](const std::size_t i) { return i; };
         xo_sign = 1;
@@ -900,12 +1315,12 @@ namespace GLSLCPP {
     *
     * @param {matrixBase, in}  cubic matrix to be decomposed (whose number of rows is either equal or larger then the number of columns)
     * @param {matrixBase, out} Q matrix (orthogonal matrix with orthogonal columns, i.e. - Q*Q^T = I; COLxROW)
-    * @param {matrixBase, out} R matrix (upper triangular matrix; COLxCOL)
+    * @param {matrixBase, out} R matrix (upper triangular matrix; COLxCOL, in the layout of the decomposed matrix)
     **/
     template<typename T, REQUIRE(is_MatrixBase_v<T> && (Rows_v<T> >= Columns_v<T>))>
     constexpr void QRgramSchmidt(const T& xi_matrix, 
-                      MatrixBase<underlying_type_t<T>, Columns_v<T>, Rows_v<T>>& xo_Q,
-                      MatrixBase<underlying_type_t<T>, Columns_v<T>, Columns_v<T>>& xo_R) noexcept {
+                      MatrixBase<underlying_type_t<T>, Columns_v<T>, Rows_v<T>, Layout_v<T>>& xo_Q,
+                      MatrixBase<underlying_type_t<T>, Columns_v<T>, Columns_v<T>, Layout_v<T>>& xo_R) noexcept {
         using _T = underlying_type_t<T>;
         constexpr std::size_t COL{ Columns_v<T> };
         
@@ -926,11 +1341,11 @@ namespace GLSLCPP {
     *
     * @param {matrixBase, in}  matrix to be decomposed (whose number of rows is either equal or larger then the number of columns)
     * @param {matrixBase, out} Q matrix (orthogonal matrix with orthogonal columns, i.e. - Q*Q^T = I; COLxROW)
-    * @param {matrixBase, out} R matrix (upper triangular matrix; COLxCOL)
+    * @param {matrixBase, out} R matrix (upper triangular matrix; COLxCOL, in the layout of the decomposed matrix)
     **/
     template<typename T, REQUIRE(is_MatrixBase_v<T> && (Rows_v<T> >= Columns_v<T>))>
     void QRgivensRotations(const T& xi_matrix, T& xo_Q, 
-                           MatrixBase<underlying_type_t<T>, Columns_v<T>, Columns_v<T>>& xo_R) noexcept {
+                           MatrixBase<underlying_type_t<T>, Columns_v<T>, Columns_v<T>, Layout_v<T>>& xo_R) noexcept {
         using _T = underlying_type_t<T>;
         constexpr std::size_t COL{ Columns_v<T> },
                               ROW{ Rows_v<T> };
@@ -970,22 +1385,12 @@ namespace GLSLCPP {
                 VectorBase<_T, 3> CSR( GivensRotationInternal(R(j, i - 1), R(j, i)) );
 
                 // R' = G * R
-                for (std::size_t x{}; x < COL; ++x) {
-                    const _T temp1{ R(x, i - 1) },
-                             temp2{ R(x, i) };
-                    R(x, i - 1) =  temp1 * CSR[0] + temp2 * CSR[1];
-                    R(x, i)     = -temp1 * CSR[1] + temp2 * CSR[0];
-                }
+                ApplyGivens(R, i - 1, i, CSR[0], CSR[1]);
                 R(j, i - 1) = CSR[2];
                 R(j, i)     = _T{};
 
-                // Q' = Q * G^
-                for (std::size_t x{}; x < ROW; ++x) {
-                    const _T temp1{ Q(i - 1, x) },
-                             temp2{ Q(i,     x) };
-                    Q(i - 1, x) =  temp1 * CSR[0] + temp2 * CSR[1];
-                    Q(i,     x) = -temp1 * CSR[1] + temp2 * CSR[0];
-                }
+                // Q' = Q * G^T (rotation of Q^T rows)
+                ApplyGivens(AsTransposed(Q), i - 1, i, CSR[0], CSR[1]);
             }
         }
 
@@ -993,44 +1398,229 @@ namespace GLSLCPP {
         if constexpr (ROW != COL) {
             Q = Transpose(std::move(Q));
         }
-        xo_Q = GetBlock<0, COL - 1, 0, ROW - 1>(Q);
+        xo_Q = T(GetBlock<0, COL - 1, 0, ROW - 1>(Q));
 
         // adjust R
-        xo_R = GetBlock<0, COL-1, 0, COL-1>(R);
+        xo_R = MatrixBase<_T, COL, COL, Layout_v<T>>(GetBlock<0, COL-1, 0, COL-1>(R));
     }
 
     /**
-    * \brief perform singular value decomposition on a given matrix, i.e. - given A, return A = U * W * V^T
-    *        where U & V columns are orthonormal (U^T*U = U*U^T = V^T*V = V*V^T = I).
-    *
-    *        important remarks:
-    *        1) to avoid arithmetic complexity which is not needed for most SVD related operations:
-    *           a) instead of U, U*W is returned.
-    *              i.e - for a 3x3 matrix:
-    *              {U(0, 0) * sqrt(W[0]), U(0, 1) * sqrt(W[1]), U(0, 2) * sqrt(W[2]);
-    *               U(1, 0) * sqrt(W[0]), U(1, 1) * sqrt(W[1]), U(1, 2) * sqrt(W[2]);
-    *               U(2, 0) * sqrt(W[0]), U(2, 1) * sqrt(W[1]), U(2, 2) * sqrt(W[2])}
-    *           b) W holds the SQUARE of singular values (i.e. - "eigenvalues").
-    *           C) V is not transposed.
-    *        2) SVD values are numerically correct, but their SIGN MIGHT BE WRONG. For further reading on this subject, see:
-    *           SANDIA REPORT, SAND2007-6422, "Resolving the Sign Ambiguity in the Singular Value Decomposition", R. Bra, E. Acar, T. Kolda.
-    *
-    * @param {matrixBase, in}  matrix to be decomposed
-    * @param {matrixBase, out} U*W [COLxROW]
-    * @param {vectorBase, out} Vector holding SQUARE of singular values [col]
-    * @param {matrixBase, out} V (not V transposed!) [COLxCOL]
-    * @param {bool,       out} true if SVD rutine converged, false otherwise
+    * Householder QR internal kernels.
+    * 'a' is a column major matrix with 'ROW' rows whose columns hold Householder vectors below their diagonal.
     **/
-    template<typename T, typename U, typename W, REQUIRE(is_MatrixBase_v<T> && (Rows_v<T> >= Columns_v<T>) &&
-                                                         Is_VectorOfLength_v<U, Columns_v<T>> && std::is_same_v<underlying_type_t<T>, underlying_type_t<U>> &&
-                                                         is_Cubic<W>::value && (Columns_v<W> == Columns_v<T>) && std::is_same_v<underlying_type_t<T>, underlying_type_t<W>>)>
-    bool SVDfast(const T& xi_mat, T& xo_UW, U& xo_W2, W& xo_V) noexcept {
+    namespace householder_detail {
+
+        // calculate the upper triangular factor 'T' of the block reflector (I - V * T * V^T) = H_k0 * ... * H_(k0 + BLOCK - 1).
+        // 'xo_t' is column major (BLOCK x BLOCK).
+        template<std::size_t BLOCK, typename _T>
+        void BlockReflectorFactor(const _T* a, const std::size_t ROW, const std::size_t k0, const std::array<_T, BLOCK>& xi_tau, std::array<_T, BLOCK * BLOCK>& xo_t) noexcept {
+            xo_t.fill(_T{});
+            for (std::size_t i{}; i < BLOCK; ++i) {
+                const std::size_t ki{ k0 + i };
+                const _T* vi{ a + ki * ROW };
+
+                // T(0:i, i) = -tau_i * T(0:i, 0:i) * V(:, 0:i)^T * v_i
+                for (std::size_t j{}; j < i; ++j) {
+                    const _T* vj{ a + (k0 + j) * ROW };
+                    _T z{ vj[ki] };
+                    for (std::size_t r{ ki + 1 }; r < ROW; ++r) {
+                        z += vj[r] * vi[r];
+                    }
+                    xo_t[i * BLOCK + j] = -xi_tau[i] * z;
+                }
+                for (std::size_t j{}; j < i; ++j) {
+                    _T s{};
+                    for (std::size_t l{ j }; l < i; ++l) {
+                        s += xo_t[l * BLOCK + j] * xo_t[i * BLOCK + l];
+                    }
+                    xo_t[i * BLOCK + j] = s;
+                }
+                xo_t[i * BLOCK + i] = xi_tau[i];
+            }
+        }
+
+        // apply a block reflector transpose on a column, i.e. - C = (I - V * T^T * V^T) * C.
+        // the column is streamed once for V^T * C and once for the update.
+        template<std::size_t BLOCK, typename _T>
+        void ApplyBlockReflectorTransposed(const _T* a, const std::size_t ROW, const std::size_t k0, const std::array<_T, BLOCK * BLOCK>& xi_t, _T* xio_col) noexcept {
+            const std::size_t k1{ k0 + BLOCK };
+
+            // w = V^T * C (triangular portion of V, then its rectangular portion)
+            std::array<_T, BLOCK> w{};
+            for (std::size_t i{}; i < BLOCK; ++i) {
+                const _T x{ xio_col[k0 + i] };
+                w[i] += x;
+                for (std::size_t j{}; j < i; ++j) {
+                    w[j] += a[(k0 + j) * ROW + k0 + i] * x;
+                }
+            }
+            for (std::size_t r{ k1 }; r < ROW; ++r) {
+                const _T x{ xio_col[r] };
+                for (std::size_t j{}; j < BLOCK; ++j) {
+                    w[j] += a[(k0 + j) * ROW + r] * x;
+                }
+            }
+
+            // w = T^T * w (bottom up, in place)
+            for (std::size_t j{ BLOCK }; j-- > 0;) {
+                _T s{};
+                for (std::size_t l{}; l <= j; ++l) {
+                    s += xi_t[j * BLOCK + l] * w[l];
+                }
+                w[j] = s;
+            }
+
+            // C -= V * w
+            for (std::size_t i{}; i < BLOCK; ++i) {
+                _T x{ w[i] };
+                for (std::size_t j{}; j < i; ++j) {
+                    x += a[(k0 + j) * ROW + k0 + i] * w[j];
+                }
+                xio_col[k0 + i] -= x;
+            }
+            for (std::size_t r{ k1 }; r < ROW; ++r) {
+                _T x{};
+                for (std::size_t j{}; j < BLOCK; ++j) {
+                    x += a[(k0 + j) * ROW + r] * w[j];
+                }
+                xio_col[r] -= x;
+            }
+        }
+
+        // apply a single reflector (H_k = I - tau * v_k * v_k^T) on a column
+        template<typename _T>
+        void ApplyReflector(const _T* a, const std::size_t ROW, const std::size_t k, const _T xi_tau, _T* xio_col) noexcept {
+            const _T* v{ a + k * ROW };
+            _T w{ xio_col[k] };
+            for (std::size_t i{ k + 1 }; i < ROW; ++i) {
+                w += v[i] * xio_col[i];
+            }
+            w *= xi_tau;
+
+            xio_col[k] -= w;
+            for (std::size_t i{ k + 1 }; i < ROW; ++i) {
+                xio_col[i] -= w * v[i];
+            }
+        }
+    };
+
+    /**
+    * \brief perform QR decomposition using Householder reflections, where trailing columns are updated
+    *        a panel at a time using a compact WY representation of the panel reflectors (I - V * T * V^T).
+    *
+    *        the decomposition is stored compactly:
+    *        > R is stored at the upper triangular portion (including diagonal) of 'xo_qr'.
+    *        > the k'th Householder vector is stored below the diagonal of column k (its k'th element is an implicit '1').
+    *        > 'xo_tau[k]' holds the k'th reflector coefficient, i.e. - H_k = I - tau[k] * v_k * v_k^T.
+    *        such that Q = H_0 * H_1 * ... * H_(COL-1).
+    *
+    * @param {size_t,     in}  number of columns in a panel (default 4)
+    * @param {matrixBase, in}  matrix to be decomposed (whose number of rows is either equal or larger then the number of columns)
+    * @param {matrixBase, out} compact QR decomposition (COLxROW)
+    * @param {vectorBase, out} reflectors coefficients (COL)
+    **/
+    template<std::size_t BLOCK = 4, typename T, typename U, REQUIRE(is_MatrixBase_v<T> && !is_RowMajor_v<T> && (Rows_v<T> >= Columns_v<T>) &&
+                                                                    Is_VectorOfLength_v<U, Columns_v<T>> && std::is_same_v<underlying_type_t<T>, underlying_type_t<U>>)>
+    void QRhouseholder(const T& xi_matrix, T& xo_qr, U& xo_tau) noexcept {
+        static_assert(BLOCK > 0, "QRhouseholder - panel size must be positive.");
+        using _T = underlying_type_t<T>;
+        constexpr std::size_t COL{ Columns_v<T> },
+                              ROW{ Rows_v<T> };
+        constexpr _T one{ static_cast<_T>(1) };
+
+        xo_qr = xi_matrix;
+        _T* a{ &xo_qr.m_data[0] };
+
+        for (std::size_t k0{}; k0 < COL; k0 += BLOCK) {
+            const std::size_t nb{ std::min(BLOCK, COL - k0) };
+
+            // panel factorization
+            for (std::size_t k{ k0 }; k < k0 + nb; ++k) {
+                _T* v{ a + k * ROW };
+
+                // reflector which annihilates column k below its diagonal
+                _T sigma{};
+                for (std::size_t i{ k + 1 }; i < ROW; ++i) {
+                    sigma += v[i] * v[i];
+                }
+                if (sigma == _T{}) {
+                    xo_tau[k] = _T{};
+                    continue;
+                }
+
+                const _T alpha{ v[k] },
+                         beta{ -std::copysign(std::sqrt(alpha * alpha + sigma), alpha) },
+                         scale{ one / (alpha - beta) };
+                xo_tau[k] = (beta - alpha) / beta;
+                for (std::size_t i{ k + 1 }; i < ROW; ++i) {
+                    v[i] *= scale;
+                }
+                v[k] = beta;
+
+                // apply reflector on the rest of the panel
+                for (std::size_t j{ k + 1 }; j < k0 + nb; ++j) {
+                    householder_detail::ApplyReflector(a, ROW, k, xo_tau[k], a + j * ROW);
+                }
+            }
+
+            // trailing columns update (notice that a panel which has trailing columns is always full, i.e. - nb == BLOCK)
+            if (k0 + nb >= COL) break;
+
+            std::array<_T, BLOCK> tau;
+            std::array<_T, BLOCK * BLOCK> t;
+            for (std::size_t i{}; i < BLOCK; ++i) {
+                tau[i] = xo_tau[k0 + i];
+            }
+            householder_detail::BlockReflectorFactor<BLOCK>(a, ROW, k0, tau, t);
+
+            for (std::size_t c{ k0 + BLOCK }; c < COL; ++c) {
+                householder_detail::ApplyBlockReflectorTransposed<BLOCK>(a, ROW, k0, t, a + c * ROW);
+            }
+        }
+    }
+
+    // reflectors are contiguous columns, so a row major matrix is decomposed as a column major copy
+    template<std::size_t BLOCK = 4, typename T, typename U, REQUIRE(is_MatrixBase_v<T> && is_RowMajor_v<T> && (Rows_v<T> >= Columns_v<T>) &&
+                                                                    Is_VectorOfLength_v<U, Columns_v<T>> && std::is_same_v<underlying_type_t<T>, underlying_type_t<U>>)>
+    void QRhouseholder(const T& xi_matrix, T& xo_qr, U& xo_tau) noexcept {
+        MatrixBase<underlying_type_t<T>, Columns_v<T>, Rows_v<T>> qr(underlying_type_t<T>{});
+        QRhouseholder<BLOCK>(ColumnMajor(xi_matrix), qr, xo_tau);
+        xo_qr = T(qr);
+    }
+
+    /**
+    * \brief perform singular value decomposition on a given matrix, i.e. - given A, return A = U * W * V^T
+    *        where U & V columns are orthonormal (U^T*U = U*U^T = V^T*V = V*V^T = I).
+    *
+    *        important remarks:
+    *        1) to avoid arithmetic complexity which is not needed for most SVD related operations:
+    *           a) instead of U, U*W is returned.
+    *              i.e - for a 3x3 matrix:
+    *              {U(0, 0) * sqrt(W[0]), U(0, 1) * sqrt(W[1]), U(0, 2) * sqrt(W[2]);
+    *               U(1, 0) * sqrt(W[0]), U(1, 1) * sqrt(W[1]), U(1, 2) * sqrt(W[2]);
+    *               U(2, 0) * sqrt(W[0]), U(2, 1) * sqrt(W[1]), U(2, 2) * sqrt(W[2])}
+    *           b) W holds the SQUARE of singular values (i.e. - "eigenvalues").
+    *           C) V is not transposed.
+    *        2) SVD values are numerically correct, but their SIGN MIGHT BE WRONG. For further reading on this subject, see:
+    *           SANDIA REPORT, SAND2007-6422, "Resolving the Sign Ambiguity in the Singular Value Decomposition", R. Bra, E. Acar, T. Kolda.
+    *
+    * @param {matrixBase, in}  matrix to be decomposed
+    * @param {matrixBase, out} U*W [COLxROW]
+    * @param {vectorBase, out} Vector holding SQUARE of singular values [col]
+    * @param {matrixBase, out} V (not V transposed!) [COLxCOL]
+    * @param {bool,       out} true if SVD rutine converged, false otherwise
+    **/
+    template<typename T, typename U, typename W, REQUIRE(is_MatrixBase_v<T> && (Rows_v<T> >= Columns_v<T>) &&
+                                                         Is_VectorOfLength_v<U, Columns_v<T>> && std::is_same_v<underlying_type_t<T>, underlying_type_t<U>> &&
+                                                         is_Cubic<W>::value && (Columns_v<W> == Columns_v<T>) && std::is_same_v<underlying_type_t<T>, underlying_type_t<W>>)>
+    bool SVDfast(const T& xi_mat, T& xo_UW, U& xo_W2, W& xo_V) noexcept {
 
         // housekeeping
         using _T = underlying_type_t<T>;
         constexpr std::size_t ROW{ Rows_v<T> },
                               COL{ Columns_v<T> },
                               sweepLimit{ (COL < 120) ? 30 : (COL / 4) };
+        GLSLCPP_RECORD(SVD, 6 * ROW * COL * COL + 20 * COL * COL * COL, 2 * sizeof(T) + sizeof(U) + sizeof(W));
 
         constexpr _T eps{ std::numeric_limits<_T>::epsilon() },
                      e2{ static_cast<_T>(10.0) * ROW * eps * eps },
@@ -1130,10 +1720,10 @@ namespace GLSLCPP {
         }
 
         // extract V
-        xo_V = GetBlock<0, COL - 1, ROW, ROW + COL - 1>(A);
+        xo_V = W(GetBlock<0, COL - 1, ROW, ROW + COL - 1>(A));
 
         // extract U*W
-        xo_UW = GetBlock<0, COL - 1, 0, ROW - 1>(A);
+        xo_UW = T(GetBlock<0, COL - 1, 0, ROW - 1>(A));
 
         return true;
     }
@@ -1171,7 +1761,9 @@ namespace GLSLCPP {
 
         // adjust U
         for (std::size_t i{}; i < COL; ++i) {
-            xo_U[i] /= xo_W[i];
+            for (std::size_t j{}; j < Rows_v<T>; ++j) {
+                xo_U(i, j) /= xo_W[i];
+            }
         }
 
         // adjust V
@@ -1181,6 +1773,206 @@ namespace GLSLCPP {
         return true;
      }
 
+    /**
+    * \brief perform singular value decomposition on a given matrix, i.e. - given A, return A = U * S * V^T
+    *        where U & V columns are orthonormal, using blocked one-sided (Hestenes) Jacobi sweeps.
+    *
+    *        columns are partitioned into blocks of 'BLOCK' columns. each sweep visits all block pairs in a round robin
+    *        (parallel) ordering, so the block pairs of a round are disjoint and are orthogonalized concurrently.
+    *        inside a block pair all of its column pairs are orthogonalized while its (2 * BLOCK) columns are cache resident.
+    *
+    *        important remarks:
+    *        1) singular values (S) are ordererd from big to small (U & V columns are ordered accordingly).
+    *        2) V is NOT transposed, i.e. - xi_mat = xo_U * diag(xo_S) * Transpose(xo_V).
+    *        3) a column of U which belongs to a zero singular value is zero.
+    *
+    * @param {size_t,     in}  number of columns in a block (default 8)
+    * @param {matrixBase, in}  matrix to be decomposed
+    * @param {matrixBase, out} U [COLxROW]
+    * @param {vectorBase, out} Vector holding singular values [col]
+    * @param {matrixBase, out} V [COLxCOL]
+    * @param {bool,       out} true if SVD rutine converged, false otherwise
+    **/
+    template<std::size_t BLOCK = 8, typename T, typename U, typename W, REQUIRE(is_MatrixBase_v<T> && (Rows_v<T> >= Columns_v<T>) &&
+                                                                               Is_VectorOfLength_v<U, Columns_v<T>> && std::is_same_v<underlying_type_t<T>, underlying_type_t<U>> &&
+                                                                               is_Cubic<W>::value && (Columns_v<W> == Columns_v<T>) && std::is_same_v<underlying_type_t<T>, underlying_type_t<W>> &&
+                                                                               !is_RowMajor_v<T> && !is_RowMajor_v<W>)>
+    bool SVDjacobi(const T& xi_mat, T& xo_U, U& xo_S, W& xo_V) {
+        static_assert(BLOCK > 0, "SVDjacobi - block size must be positive.");
+
+        // housekeeping
+        using _T = underlying_type_t<T>;
+        constexpr std::size_t ROW{ Rows_v<T> },
+                              COL{ Columns_v<T> },
+                              block{ (BLOCK < COL) ? BLOCK : COL },
+                              blocks{ (COL + block - 1) / block },
+                              players{ blocks + (blocks & 1) },                   // round robin participants (odd number of blocks gets a dummy)
+                              sweepLimit{ (COL < 120) ? 30 : (COL / 4) };
+        constexpr bool parallel{ (blocks > 2) && (ROW * COL >= 1024) };          // small problems are not worth the synchronization
+        constexpr _T one{ static_cast<_T>(1) },
+                     tol{ static_cast<_T>(ROW) * std::numeric_limits<_T>::epsilon() };
+        GLSLCPP_RECORD(SVD, 6 * ROW * COL * COL + 20 * COL * COL * COL, 2 * sizeof(T) + sizeof(U) + sizeof(W));
+
+        xo_U = xi_mat;
+        xo_V = W();
+        _T* a{ &xo_U.m_data[0] };
+        _T* v{ &xo_V.m_data[0] };
+
+        // rotate columns 'x' & 'y' (of 'len' elements)
+        const auto Rotate = [](_T* x, _T* y, const std::size_t len, const _T c, const _T s) noexcept {
+            for (std::size_t i{}; i < len; ++i) {
+                const _T xi{ x[i] },
+                         yi{ y[i] };
+                x[i] = c * xi - s * yi;
+                y[i] = s * xi + c * yi;
+            }
+        };
+
+        // orthogonalize column pairs of two blocks ('xi_intra' - also orthogonalize pairs within a block), return number of rotations
+        const auto OrthogonalizeBlocks = [&](const std::size_t xi_first, const std::size_t xi_second, const bool xi_intra) noexcept {
+            std::array<std::size_t, 2 * block> columns{};
+            std::size_t count{};
+            for (std::size_t c{ xi_first * block }; c < std::min((xi_first + 1) * block, COL); ++c) {
+                columns[count++] = c;
+            }
+            const std::size_t split{ count };
+            if (xi_second != xi_first) {
+                for (std::size_t c{ xi_second * block }; c < std::min((xi_second + 1) * block, COL); ++c) {
+                    columns[count++] = c;
+                }
+            }
+
+            std::size_t rotations{};
+            for (std::size_t p{}; p + 1 < count; ++p) {
+                for (std::size_t q{ p + 1 }; q < count; ++q) {
+                    if (!xi_intra && ((p < split) == (q < split))) continue;
+
+                    _T* x{ a + columns[p] * ROW };
+                    _T* y{ a + columns[q] * ROW };
+                    _T alpha{}, beta{}, gamma{};
+                    for (std::size_t i{}; i < ROW; ++i) {
+                        alpha += x[i] * x[i];
+                        beta  += y[i] * y[i];
+                        gamma += x[i] * y[i];
+                    }
+
+                    // are columns already orthogonal?
+                    if (std::abs(gamma) <= tol * std::sqrt(alpha * beta)) continue;
+
+                    const _T zeta{ (beta - alpha) / (static_cast<_T>(2) * gamma) },
+                             t{ std::copysign(one, zeta) / (std::abs(zeta) + std::sqrt(one + zeta * zeta)) },
+                             c{ one / std::sqrt(one + t * t) },
+                             s{ c * t };
+                    Rotate(x, y, ROW, c, s);
+                    Rotate(v + columns[p] * COL, v + columns[q] * COL, COL, c, s);
+                    ++rotations;
+                }
+            }
+
+            return rotations;
+        };
+
+        // sweeps
+        std::size_t sweep{};
+        for (; sweep < sweepLimit; ++sweep) {
+            std::size_t rotations{};
+
+            for (std::size_t round{}; round < std::max<std::size_t>(players - 1, 1); ++round) {
+                std::array<std::size_t, players / 2 + 1> roundRotations{};
+
+                const auto Pair = [&](const std::size_t k) {
+                    std::size_t first{ (round + k) % (players - 1) },
+                                second{ (k == 0) ? (players - 1) : ((round + players - 1 - k) % (players - 1)) };
+                    if (blocks == 1) {
+                        first = second = 0;
+                    }
+                    else if (first >= blocks) {
+                        first = second;
+                    }
+                    else if (second >= blocks) {
+                        second = first;
+                    }
+
+                    // within block pairs are orthogonalized only in the first round (each block appears once per round)
+                    roundRotations[k] = OrthogonalizeBlocks(first, second, round == 0);
+                };
+
+                if constexpr (parallel) {
+                    ThreadPool::Instance().Run(players / 2, Pair);
+                }
+                else {
+                    for (std::size_t k{}; k < std::max<std::size_t>(players / 2, 1); ++k) {
+                        Pair(k);
+                    }
+                }
+
+                for (const std::size_t r : roundRotations) {
+                    rotations += r;
+                }
+            }
+
+            if (rotations == 0) break;
+        }
+
+        // reached maximal number of sweeps
+        if (sweep == sweepLimit) {
+            return false;
+        }
+
+        // singular values are U columns norms
+        for (std::size_t c{}; c < COL; ++c) {
+            _T* x{ a + c * ROW };
+            _T norm{};
+            for (std::size_t i{}; i < ROW; ++i) {
+                norm += x[i] * x[i];
+            }
+            norm = std::sqrt(norm);
+            xo_S[c] = norm;
+
+            if (norm > _T{}) {
+                const _T normInv{ one / norm };
+                for (std::size_t i{}; i < ROW; ++i) {
+                    x[i] *= normInv;
+                }
+            }
+        }
+
+        // order singular values (selection sort, columns are swapped only once)
+        for (std::size_t i{}; i + 1 < COL; ++i) {
+            std::size_t largest{ i };
+            for (std::size_t j{ i + 1 }; j < COL; ++j) {
+                if (xo_S[j] > xo_S[largest]) {
+                    largest = j;
+                }
+            }
+
+            if (largest != i) {
+                std::swap(xo_S[i], xo_S[largest]);
+                std::swap_ranges(a + i * ROW, a + (i + 1) * ROW, a + largest * ROW);
+                std::swap_ranges(v + i * COL, v + (i + 1) * COL, v + largest * COL);
+            }
+        }
+
+        return true;
+    }
+
+    // columns are rotated in place, so row major matrices are decomposed through column major copies
+    template<std::size_t BLOCK = 8, typename T, typename U, typename W, REQUIRE(is_MatrixBase_v<T> && (Rows_v<T> >= Columns_v<T>) &&
+                                                                               Is_VectorOfLength_v<U, Columns_v<T>> && std::is_same_v<underlying_type_t<T>, underlying_type_t<U>> &&
+                                                                               is_Cubic<W>::value && (Columns_v<W> == Columns_v<T>) && std::is_same_v<underlying_type_t<T>, underlying_type_t<W>> &&
+                                                                               (is_RowMajor_v<T> || is_RowMajor_v<W>))>
+    bool SVDjacobi(const T& xi_mat, T& xo_U, U& xo_S, W& xo_V) {
+        using _T = underlying_type_t<T>;
+
+        MatrixBase<_T, Columns_v<T>, Rows_v<T>> u(_T{});
+        MatrixBase<_T, Columns_v<W>, Rows_v<W>> v;
+        const bool xo_flag{ SVDjacobi<BLOCK>(ColumnMajor(xi_mat), u, xo_S, v) };
+        xo_U = T(u);
+        xo_V = W(v);
+
+        return xo_flag;
+    }
+
     /**
     * \brief given cubic and positive definite matrix A, 
     *        constructs a lower triangular matrix L such that L*L' = A.
@@ -1215,36 +2007,708 @@ namespace GLSLCPP {
             xo_lower(j, j) = (d > _T{}) ? (std::sqrt(d)) : (_T{});
         }
 
-        return xo_lower;
+        return xo_lower;
+    }
+
+    template<typename T, REQUIRE(is_Cubic<T>::value)>
+    constexpr T Cholesky(T&& xi_matrix) noexcept {
+        CholeskyInPlace(xi_matrix);
+        return std::move(xi_matrix);
+    }
+
+    /**
+    * \brief given cubic and positive definite matrix A, replace it with lower triangular matrix L such that L*L' = A.
+    *        (every element of A is read just before it is overwritten, so no temporary is needed)
+    *
+    * @param {matrixBase, in|out} 'A' (must be symmetric) / lower decomposition
+    **/
+    template<typename T, REQUIRE(is_Cubic<T>::value)>
+    constexpr void CholeskyInPlace(T& xio_matrix) noexcept {
+        using _T = underlying_type_t<T>;
+        constexpr std::size_t COL{ Columns_v<T> };
+
+        for (std::size_t j{}; j < COL; ++j) {
+            _T d{};
+
+            for (std::size_t k{}; k < j; ++k) {
+                _T s{};
+
+                for (std::size_t i{}; i < k; ++i) {
+                    s += xio_matrix(i, k) * xio_matrix(i, j);
+                }
+
+                xio_matrix(k, j) = s = (xio_matrix(k, j) - s) / xio_matrix(k, k);
+                d += s * s;
+            }
+
+            d = xio_matrix(j, j) - d;
+
+            xio_matrix(j, j) = (d > _T{}) ? (std::sqrt(d)) : (_T{});
+        }
+
+        // clear upper triangular portion
+        for (std::size_t c{ 1 }; c < COL; ++c) {
+            for (std::size_t r{}; r < c; ++r) {
+                xio_matrix(c, r) = _T{};
+            }
+        }
+    }
+
+    namespace eigen_detail {
+
+        // sqrt(a^2 + b^2) without destructive underflow or overflow
+        template<typename T>
+        T Hypot(const T a, const T b) noexcept {
+            const T absa{ std::abs(a) },
+                    absb{ std::abs(b) };
+            if (absa > absb) {
+                const T ratio{ absb / absa };
+                return absa * std::sqrt(static_cast<T>(1) + ratio * ratio);
+            }
+            if (absb == T{}) {
+                return T{};
+            }
+            const T ratio{ absa / absb };
+            return absb * std::sqrt(static_cast<T>(1) + ratio * ratio);
+        }
+
+        // magnitude of 'a' with the sign of 'b'
+        template<typename T>
+        constexpr T Sign(const T a, const T b) noexcept {
+            return (b >= T{}) ? std::abs(a) : -std::abs(a);
+        }
+
+        /**
+        * \brief reduce a symmetric matrix to tridiagonal form using householder reflections (A = Q * T * Q^T).
+        *        only the lower triangle of the matrix is read.
+        *
+        * @param {MatrixBase, in|out} symmetric matrix (column major) / Q (if 'VECTORS' is true, otherwise destroyed)
+        * @param {VectorBase, out}    diagonal of T
+        * @param {VectorBase, out}    sub diagonal of T (element 0 is zero)
+        **/
+        template<bool VECTORS, typename T, std::size_t N>
+        void Tridiagonalize(MatrixBase<T, N, N>& xio_z, VectorBase<T, N>& xo_d, VectorBase<T, N>& xo_e) noexcept {
+            // z(r, c) in matrix notation (row 'r', column 'c')
+            const auto z = [&xio_z](const std::size_t r, const std::size_t c) -> T& { return xio_z(c, r); };
+
+            for (std::size_t i{ N - 1 }; i > 0; --i) {
+                const std::size_t l{ i - 1 };
+                T h{};
+
+                if (l > 0) {
+                    T scale{};
+                    for (std::size_t k{}; k < i; ++k) {
+                        scale += std::abs(z(i, k));
+                    }
+
+                    if (scale == T{}) {
+                        xo_e[i] = z(i, l);
+                    } else {
+                        for (std::size_t k{}; k < i; ++k) {
+                            z(i, k) /= scale;
+                            h += z(i, k) * z(i, k);
+                        }
+
+                        T f{ z(i, l) },
+                          g{ (f >= T{}) ? -std::sqrt(h) : std::sqrt(h) };
+                        xo_e[i] = scale * g;
+                        h -= f * g;
+                        z(i, l) = f - g;
+
+                        f = T{};
+                        for (std::size_t j{}; j < i; ++j) {
+                            if constexpr (VECTORS) {
+                                z(j, i) = z(i, j) / h;
+                            }
+                            g = T{};
+                            for (std::size_t k{}; k <= j; ++k) {
+                                g += z(j, k) * z(i, k);
+                            }
+                            for (std::size_t k{ j + 1 }; k < i; ++k) {
+                                g += z(k, j) * z(i, k);
+                            }
+                            xo_e[j] = g / h;
+                            f += xo_e[j] * z(i, j);
+                        }
+
+                        const T hh{ f / (h + h) };
+                        for (std::size_t j{}; j < i; ++j) {
+                            f = z(i, j);
+                            xo_e[j] = g = xo_e[j] - hh * f;
+                            for (std::size_t k{}; k <= j; ++k) {
+                                z(j, k) -= (f * xo_e[k] + g * z(i, k));
+                            }
+                        }
+                    }
+                } else {
+                    xo_e[i] = z(i, l);
+                }
+
+                xo_d[i] = h;
+            }
+
+            xo_d[0] = T{};
+            xo_e[0] = T{};
+
+            // accumulate transformations
+            for (std::size_t i{}; i < N; ++i) {
+                if constexpr (VECTORS) {
+                    if (xo_d[i] != T{}) {
+                        for (std::size_t j{}; j < i; ++j) {
+                            T g{};
+                            for (std::size_t k{}; k < i; ++k) {
+                                g += z(i, k) * z(k, j);
+                            }
+                            for (std::size_t k{}; k < i; ++k) {
+                                z(k, j) -= g * z(k, i);
+                            }
+                        }
+                    }
+                    xo_d[i] = z(i, i);
+                    z(i, i) = static_cast<T>(1);
+                    for (std::size_t j{}; j < i; ++j) {
+                        z(j, i) = z(i, j) = T{};
+                    }
+                } else {
+                    xo_d[i] = z(i, i);
+                }
+            }
+        }
+
+        /**
+        * \brief eigenvalues (and eigenvectors) of a symmetric tridiagonal matrix using QL algorithm with implicit shifts.
+        *
+        * @param {VectorBase, in|out} diagonal / eigenvalues (unordered)
+        * @param {VectorBase, in|out} sub diagonal (element 0 is ignored) / destroyed
+        * @param {MatrixBase, in|out} transformation which tridiagonalized the matrix (or identity) / eigenvectors (as columns)
+        * @param {bool,       out}    true if algorithm converged, false otherwise
+        **/
+        template<bool VECTORS, typename T, std::size_t N>
+        bool TridiagonalQL(VectorBase<T, N>& xio_d, VectorBase<T, N>& xio_e, MatrixBase<T, N, N>& xio_z) noexcept {
+            constexpr std::size_t MAX_ITERATIONS{ 30 };
+            constexpr T EPS{ std::numeric_limits<T>::epsilon() };
+
+            for (std::size_t i{ 1 }; i < N; ++i) {
+                xio_e[i - 1] = xio_e[i];
+            }
+            xio_e[N - 1] = T{};
+
+            for (std::size_t l{}; l < N; ++l) {
+                std::size_t iteration{},
+                            m{};
+                do {
+                    // look for a single small sub diagonal element to split the matrix
+                    for (m = l; m + 1 < N; ++m) {
+                        const T dd{ std::abs(xio_d[m]) + std::abs(xio_d[m + 1]) };
+                        if (std::abs(xio_e[m]) <= EPS * dd) break;
+                    }
+
+                    if (m != l) {
+                        if (iteration++ == MAX_ITERATIONS) {
+                            return false;
+                        }
+
+                        // implicit shift
+                        T g{ (xio_d[l + 1] - xio_d[l]) / (static_cast<T>(2) * xio_e[l]) },
+                          r{ Hypot(g, static_cast<T>(1)) };
+                        g = xio_d[m] - xio_d[l] + xio_e[l] / (g + Sign(r, g));
+
+                        T s{ static_cast<T>(1) },
+                          c{ static_cast<T>(1) },
+                          p{};
+                        std::int64_t i{ static_cast<std::int64_t>(m) - 1 };
+                        for (; i >= static_cast<std::int64_t>(l); --i) {
+                            const std::size_t _i{ static_cast<std::size_t>(i) };
+                            const T f{ s * xio_e[_i] },
+                                    b{ c * xio_e[_i] };
+                            xio_e[_i + 1] = r = Hypot(f, g);
+
+                            // recover from underflow
+                            if (r == T{}) {
+                                xio_d[_i + 1] -= p;
+                                xio_e[m] = T{};
+                                break;
+                            }
+
+                            s = f / r;
+                            c = g / r;
+                            g = xio_d[_i + 1] - p;
+                            r = (xio_d[_i] - g) * s + static_cast<T>(2) * c * b;
+                            p = s * r;
+                            xio_d[_i + 1] = g + p;
+                            g = c * r - b;
+
+                            // rotate eigenvectors (columns are contiguous)
+                            if constexpr (VECTORS) {
+                                for (std::size_t k{}; k < N; ++k) {
+                                    const T zk{ xio_z(_i + 1, k) };
+                                    xio_z(_i + 1, k) = s * xio_z(_i, k) + c * zk;
+                                    xio_z(_i, k)     = c * xio_z(_i, k) - s * zk;
+                                }
+                            }
+                        }
+
+                        if ((r == T{}) && (i >= static_cast<std::int64_t>(l))) continue;
+
+                        xio_d[l] -= p;
+                        xio_e[l] = g;
+                        xio_e[m] = T{};
+                    }
+                } while (m != l);
+            }
+
+            return true;
+        }
+    };
+
+    /**
+    * \brief given a cubic SYMMETRIC matrix, return its eigenvalues (sorted from big to small) and eigenvectors.
+    *        matrix is reduced to tridiagonal form using householder reflections, which is then diagonalized using QL algorithm with implicit shifts.
+    *        (allocation free, only the lower triangle of the matrix is read)
+    *
+    * @param {matrixBase, in}  symmetric matrix
+    * @param {vectorBase, out} eigenvalues (sorted from big to small)
+    * @param {matrixBase, out} matrix whose columns are the normalized eigenvectors
+    * @param {bool,       out} true if algorithm converged, false otherwise
+    **/
+    template<typename T, typename U, REQUIRE(is_Cubic<T>::value && Is_VectorOfLength_v<U, Columns_v<T>> &&
+                                             std::is_same_v<underlying_type_t<T>, underlying_type_t<U>>)>
+    bool EigenSolverSymmetric(const T& xi_mat, U& xo_values, T& xo_vectors) noexcept {
+        using _T = underlying_type_t<T>;
+        constexpr std::size_t N{ Columns_v<T> };
+
+        MatrixBase<_T, N, N> z(ColumnMajor(xi_mat));
+        VectorBase<_T, N> d, e;
+        eigen_detail::Tridiagonalize<true>(z, d, e);
+        const bool xo_flag{ eigen_detail::TridiagonalQL<true>(d, e, z) };
+
+        // sort from big to small
+        std::array<std::size_t, N> order;
+        for (std::size_t i{}; i < N; ++i) order[i] = i;
+        std::sort(order.begin(), order.end(), [&d](const std::size_t i, const std::size_t j) { return d[i] > d[j]; });
+
+        for (std::size_t i{}; i < N; ++i) {
+            xo_values[i] = d[order[i]];
+            for (std::size_t k{}; k < N; ++k) {
+                xo_vectors(i, k) = z(order[i], k);
+            }
+        }
+
+        return xo_flag;
+    }
+
+    /**
+    * \brief given a cubic SYMMETRIC matrix, return its eigenvalues (sorted from big to small).
+    *        same as 'EigenSolverSymmetric', but transformations (eigenvectors) are not accumulated.
+    *
+    * @param {matrixBase, in}  symmetric matrix
+    * @param {vectorBase, out} eigenvalues (sorted from big to small)
+    * @param {bool,       out} true if algorithm converged, false otherwise
+    **/
+    template<typename T, typename U, REQUIRE(is_Cubic<T>::value && Is_VectorOfLength_v<U, Columns_v<T>> &&
+                                             std::is_same_v<underlying_type_t<T>, underlying_type_t<U>>)>
+    bool EigenValuesSymmetric(const T& xi_mat, U& xo_values) noexcept {
+        using _T = underlying_type_t<T>;
+        constexpr std::size_t N{ Columns_v<T> };
+
+        MatrixBase<_T, N, N> z(ColumnMajor(xi_mat));
+        VectorBase<_T, N> d, e;
+        eigen_detail::Tridiagonalize<false>(z, d, e);
+        const bool xo_flag{ eigen_detail::TridiagonalQL<false>(d, e, z) };
+
+        std::sort(d.begin(), d.end(), [](const _T a, const _T b) { return a > b; });
+        for (std::size_t i{}; i < N; ++i) {
+            xo_values[i] = d[i];
+        }
+
+        return xo_flag;
+    }
+
+    /**
+    * \brief given a cubic (general, real) matrix, return its eigenvalues.
+    *        matrix is reduced to upper hessenberg form using householder reflections, which is then reduced to
+    *        real Schur form using Francis double shift QR algorithm.
+    *        eigenvalues are sorted by descending real part, complex conjugate pairs are adjacent (positive imaginary part first).
+    *        (allocation free)
+    *
+    * @param {matrixBase, in}  matrix
+    * @param {vectorBase, out} real part of eigenvalues
+    * @param {vectorBase, out} imaginary part of eigenvalues
+    * @param {bool,       out} true if algorithm converged, false otherwise
+    **/
+    template<typename T, typename U, REQUIRE(is_Cubic<T>::value && Is_VectorOfLength_v<U, Columns_v<T>> &&
+                                             std::is_same_v<underlying_type_t<T>, underlying_type_t<U>>)>
+    bool EigenValues(const T& xi_mat, U& xo_real, U& xo_imaginary) noexcept {
+        using _T = underlying_type_t<T>;
+        using _I = std::int64_t;
+        using namespace eigen_detail;
+        constexpr std::size_t N{ Columns_v<T> };
+        constexpr std::size_t MAX_ITERATIONS{ 30 };
+        constexpr _T EPS{ std::numeric_limits<_T>::epsilon() };
+
+        // reduce to upper hessenberg form (H = Q^T * A * Q)
+        MatrixBase<_T, N, N> h(ColumnMajor(xi_mat));
+        for (std::size_t k{}; k + 2 < N; ++k) {
+            VectorBase<_T, N> v;
+            _T alpha{};
+            for (std::size_t r{ k + 1 }; r < N; ++r) {
+                v[r] = h(k, r);
+                alpha += v[r] * v[r];
+            }
+            alpha = std::sqrt(alpha);
+            if (alpha == _T{}) continue;
+
+            alpha = Sign(alpha, v[k + 1]);
+            v[k + 1] += alpha;
+            const _T tau{ static_cast<_T>(1) / (alpha * v[k + 1]) };
+            ApplyHouseholder(h, v, tau);
+            ApplyHouseholder(AsTransposed(h), v, tau);
+        }
+
+        // a(r, c) in matrix notation (row 'r', column 'c')
+        const auto a = [&h](const _I r, const _I c) -> _T& { return h(static_cast<std::size_t>(c), static_cast<std::size_t>(r)); };
+        VectorBase<_T, N> wr, wi;
+
+        _T anorm{};
+        for (_I i{}; i < static_cast<_I>(N); ++i) {
+            for (_I j{ std::max<_I>(i - 1, 0) }; j < static_cast<_I>(N); ++j) {
+                anorm += std::abs(a(i, j));
+            }
+        }
+
+        _I nn{ static_cast<_I>(N) - 1 };
+        _T t{};
+        while (nn >= 0) {
+            std::size_t iteration{};
+            _I l{};
+            do {
+                // look for a single small sub diagonal element
+                for (l = nn; l > 0; --l) {
+                    _T s{ std::abs(a(l - 1, l - 1)) + std::abs(a(l, l)) };
+                    if (s == _T{}) s = anorm;
+                    if (std::abs(a(l, l - 1)) <= EPS * s) {
+                        a(l, l - 1) = _T{};
+                        break;
+                    }
+                }
+
+                _T x{ a(nn, nn) };
+
+                // one root found
+                if (l == nn) {
+                    wr[static_cast<std::size_t>(nn)] = x + t;
+                    wi[static_cast<std::size_t>(nn--)] = _T{};
+                    continue;
+                }
+
+                _T y{ a(nn - 1, nn - 1) },
+                   w{ a(nn, nn - 1) * a(nn - 1, nn) };
+
+                // two roots found
+                if (l == nn - 1) {
+                    const _T p{ static_cast<_T>(0.5) * (y - x) },
+                             q{ p * p + w };
+                    _T z{ std::sqrt(std::abs(q)) };
+                    x += t;
+                    const std::size_t i0{ static_cast<std::size_t>(nn - 1) },
+                                      i1{ static_cast<std::size_t>(nn) };
+                    if (q >= _T{}) {
+                        z = p + Sign(z, p);
+                        wr[i0] = wr[i1] = x + z;
+                        if (z != _T{}) wr[i1] = x - w / z;
+                        wi[i0] = wi[i1] = _T{};
+                    } else {
+                        wr[i0] = wr[i1] = x + p;
+                        wi[i0] = z;
+                        wi[i1] = -z;
+                    }
+                    nn -= 2;
+                    continue;
+                }
+
+                // no roots found yet
+                if (iteration == MAX_ITERATIONS) {
+                    return false;
+                }
+
+                // exceptional shift
+                if ((iteration == 10) || (iteration == 20)) {
+                    t += x;
+                    for (_I i{}; i <= nn; ++i) {
+                        a(i, i) -= x;
+                    }
+                    const _T s{ std::abs(a(nn, nn - 1)) + std::abs(a(nn - 1, nn - 2)) };
+                    y = x = static_cast<_T>(0.75) * s;
+                    w = static_cast<_T>(-0.4375) * s * s;
+                }
+                ++iteration;
+
+                // form shift and look for two consecutive small sub diagonal elements
+                _I m{ nn - 2 };
+                _T p{}, q{}, r{}, z{};
+                for (; m >= l; --m) {
+                    z = a(m, m);
+                    r = x - z;
+                    _T s{ y - z };
+                    p = (r * s - w) / a(m + 1, m) + a(m, m + 1);
+                    q = a(m + 1, m + 1) - z - r - s;
+                    r = a(m + 2, m + 1);
+                    s = std::abs(p) + std::abs(q) + std::abs(r);
+                    p /= s;
+                    q /= s;
+                    r /= s;
+                    if (m == l) break;
+                    const _T u{ std::abs(a(m, m - 1)) * (std::abs(q) + std::abs(r)) },
+                             v{ std::abs(p) * (std::abs(a(m - 1, m - 1)) + std::abs(z) + std::abs(a(m + 1, m + 1))) };
+                    if (u <= EPS * v) break;
+                }
+
+                for (_I i{ m }; i < nn - 1; ++i) {
+                    a(i + 2, i) = _T{};
+                    if (i != m) a(i + 2, i - 1) = _T{};
+                }
+
+                // double shift QR step on rows l..nn and columns m..nn
+                for (_I k{ m }; k < nn; ++k) {
+                    if (k != m) {
+                        p = a(k, k - 1);
+                        q = a(k + 1, k - 1);
+                        r = (k + 1 != nn) ? a(k + 2, k - 1) : _T{};
+                        x = std::abs(p) + std::abs(q) + std::abs(r);
+                        if (x != _T{}) {
+                            p /= x;
+                            q /= x;
+                            r /= x;
+                        }
+                    }
+
+                    const _T s{ Sign(std::sqrt(p * p + q * q + r * r), p) };
+                    if (s == _T{}) continue;
+
+                    if (k == m) {
+                        if (l != m) a(k, k - 1) = -a(k, k - 1);
+                    } else {
+                        a(k, k - 1) = -s * x;
+                    }
+                    p += s;
+                    x = p / s;
+                    y = q / s;
+                    z = r / s;
+                    q /= p;
+                    r /= p;
+
+                    // row modification
+                    for (_I j{ k }; j <= nn; ++j) {
+                        p = a(k, j) + q * a(k + 1, j);
+                        if (k + 1 != nn) {
+                            p += r * a(k + 2, j);
+                            a(k + 2, j) -= p * z;
+                        }
+                        a(k + 1, j) -= p * y;
+                        a(k, j) -= p * x;
+                    }
+
+                    // column modification
+                    const _I last{ std::min(nn, k + 3) };
+                    for (_I i{ l }; i <= last; ++i) {
+                        p = x * a(i, k) + y * a(i, k + 1);
+                        if (k + 1 != nn) {
+                            p += z * a(i, k + 2);
+                            a(i, k + 2) -= p * r;
+                        }
+                        a(i, k + 1) -= p * q;
+                        a(i, k) -= p;
+                    }
+                }
+            } while (l + 1 < nn);
+        }
+
+        // sort by descending real part (conjugate pairs remain adjacent)
+        std::array<std::size_t, N> order;
+        for (std::size_t i{}; i < N; ++i) order[i] = i;
+        std::sort(order.begin(), order.end(), [&wr, &wi](const std::size_t i, const std::size_t j) {
+            return (wr[i] > wr[j]) || ((wr[i] == wr[j]) && (wi[i] > wi[j]));
+        });
+        for (std::size_t i{}; i < N; ++i) {
+            xo_real[i] = wr[order[i]];
+            xo_imaginary[i] = wi[order[i]];
+        }
+
+        return true;
     }
 
-    template<typename T, REQUIRE(is_Cubic<T>::value)>
-    constexpr T Cholesky(T&& xi_matrix) noexcept {
-        using _T = underlying_type_t<T>;
-        constexpr std::size_t COL{ Columns_v<T> };
+    /**
+    * \brief given a (large) symmetric linear operator, return its K largest eigenvalues and eigenvectors using
+    *        thick restarted Lanczos iterations with full re-orthogonalization.
+    *        the operator is accessed only through products 'y = A * x', so extracting K eigenpairs costs O(K * N^2) instead of O(N^3).
+    *
+    *        KRYLOV is the dimension of the Krylov subspace (K < KRYLOV <= N, zero for min(N, 2 * K + 8)),
+    *        on every restart (KRYLOV + K) / 2 Ritz vectors are kept. larger subspace means less restarts but more memory (KRYLOV vectors of length N)
+    *        and more work per restart.
+    *
+    * @param {callable,   in}  symmetric operator, called as 'VectorBase<T, N> y = xi_operator(const VectorBase<T, N>& x)'
+    * @param {vectorBase, out} K largest eigenvalues (sorted from big to small)
+    * @param {matrixBase, out} matrix whose K columns are the normalized eigenvectors (KxN)
+    * @param {T,          in}  tolerance (eigenpair is converged when ||A * x - lambda * x|| <= tolerance * |largest eigenvalue|)
+    * @param {size_t,     in}  maximal number of restarts
+    * @param {bool,       out} true if all K eigenpairs converged, false otherwise (also if the projected operator eigen decomposition did not converge)
+    **/
+    template<std::size_t KRYLOV = 0, typename F, typename U, typename W, REQUIRE(!is_MatrixBase_v<std::decay_t<F>> && is_Vector_v<U> && is_MatrixBase_v<W> &&
+                                                                                   (Columns_v<W> == Length_v<U>) && std::is_same_v<underlying_type_t<U>, underlying_type_t<W>>)>
+    bool EigenSolverLanczos(F&& xi_operator, U& xo_values, W& xo_vectors,
+                            const underlying_type_t<U> xi_tolerance = std::sqrt(std::numeric_limits<underlying_type_t<U>>::epsilon()),
+                            const std::size_t xi_maxRestarts = 100) {
+        using _T = underlying_type_t<U>;
+        using vec = VectorBase<_T, Rows_v<W>>;
+        constexpr std::size_t K{ Length_v<U> },
+                              N{ Rows_v<W> },
+                              M{ (KRYLOV == 0) ? std::min(N, 2 * K + 8) : KRYLOV },
+                              KEEP{ (M + K) / 2 };
+        static_assert((K > 0) && (K < M) && (M <= N), "EigenSolverLanczos - Krylov subspace dimension must be larger than number of eigenpairs and not larger than operator dimension.");
+
+        // w = w - h * v
+        const auto Subtract = [](vec& xio_w, const _T xi_h, const vec& xi_v) noexcept {
+            for (std::size_t n{}; n < N; ++n) {
+                xio_w[n] -= xi_h * xi_v[n];
+            }
+        };
 
-        T xo_lower(_T{});
+        // orthogonalize vector against first 'count' basis vectors (twice is enough), return coefficient of last basis vector
+        std::vector<vec> basis(M);
+        const auto Orthogonalize = [&basis, &Subtract](vec& xio_w, const std::size_t xi_count) noexcept {
+            _T last{};
+            for (std::size_t pass{}; pass < 2; ++pass) {
+                for (std::size_t i{}; i < xi_count; ++i) {
+                    const _T h{ dot(basis[i], xio_w) };
+                    Subtract(xio_w, h, basis[i]);
+                    if (i + 1 == xi_count) last += h;
+                }
+            }
+            return last;
+        };
 
-        for (std::size_t j{}; j < COL; ++j) {
-            _T d{};
+        // normalized (pseudo random) vector orthogonal to first 'count' basis vectors
+        std::uint32_t seed{ 0x9e3779b9u };
+        const auto Random = [&seed, &Orthogonalize](vec& xo_v, const std::size_t xi_count) noexcept {
+            _T norm{};
+            while (norm <= std::numeric_limits<_T>::epsilon()) {
+                for (std::size_t n{}; n < N; ++n) {
+                    seed = seed * 1664525u + 1013904223u;
+                    xo_v[n] = static_cast<_T>(seed >> 8) / static_cast<_T>(1u << 24) - static_cast<_T>(0.5);
+                }
+                Orthogonalize(xo_v, xi_count);
+                norm = std::sqrt(dot(xo_v, xo_v));
+            }
+            for (std::size_t n{}; n < N; ++n) {
+                xo_v[n] /= norm;
+            }
+        };
 
-            for (std::size_t k{}; k < j; ++k) {
-                _T s{};
+        // projected operator (tridiagonal, with an arrow head after restarts) and its eigen decomposition
+        MatrixBase<_T, M, M> T(_T{}),
+                             S;
+        VectorBase<_T, M> theta;
+        vec residual;
+        _T beta{};
+        bool xo_flag{ false };
+
+        Random(basis[0], 0);
+        std::size_t start{};
+        std::vector<vec> kept(KEEP);
+        for (std::size_t restart{}; ; ++restart) {
+            // lanczos expansion
+            for (std::size_t j{ start }; j < M; ++j) {
+                vec w(xi_operator(basis[j]));
+                T(j, j) = Orthogonalize(w, j + 1);
+                beta = std::sqrt(dot(w, w));
+
+                if (j + 1 == M) {
+                    residual = w;
+                    break;
+                }
 
-                for (std::size_t i{}; i < k; ++i) {
-                    s += xo_lower(i, k) * xo_lower(i, j);
+                // invariant subspace was found, continue with an orthogonal direction
+                if (beta <= std::numeric_limits<_T>::epsilon() * std::abs(T(j, j))) {
+                    Random(basis[j + 1], j + 1);
+                    beta = _T{};
+                } else {
+                    for (std::size_t n{}; n < N; ++n) {
+                        basis[j + 1][n] = w[n] / beta;
+                    }
                 }
+                T(j, j + 1) = T(j + 1, j) = beta;
+            }
 
-                xo_lower(k, j) = s = (xi_matrix(k, j) - s) / xo_lower(k, k);
-                d += s * s;
+            // Ritz pairs (residual of pair 'i' is beta * |last component of its eigenvector|)
+            const bool projected{ EigenSolverSymmetric(T, theta, S) };
+            const _T scale{ std::max(std::abs(theta[0]), std::abs(theta[M - 1])) };
+            xo_flag = projected;
+            for (std::size_t i{}; i < K; ++i) {
+                xo_flag &= (std::abs(beta * S(i, M - 1)) <= xi_tolerance * scale);
             }
 
-            d = xi_matrix(j, j) - d;
+            // Ritz pairs of a projected operator which was not diagonalized can not be restarted from
+            if (xo_flag || !projected || (restart == xi_maxRestarts)) {
+                for (std::size_t i{}; i < K; ++i) {
+                    xo_values[i] = theta[i];
+                    for (std::size_t n{}; n < N; ++n) {
+                        _T v{};
+                        for (std::size_t j{}; j < M; ++j) {
+                            v += S(i, j) * basis[j][n];
+                        }
+                        xo_vectors(i, n) = v;
+                    }
+                }
+                return xo_flag;
+            }
 
-            xo_lower(j, j) = (d > _T{}) ? (std::sqrt(d)) : (_T{});
+            // thick restart - keep leading Ritz vectors, continue from residual direction
+            for (std::size_t i{}; i < KEEP; ++i) {
+                kept[i] = _T{};
+                for (std::size_t j{}; j < M; ++j) {
+                    Subtract(kept[i], -S(i, j), basis[j]);
+                }
+            }
+            std::swap_ranges(kept.begin(), kept.end(), basis.begin());
+
+            T = _T{};
+            for (std::size_t i{}; i < KEEP; ++i) {
+                T(i, i) = theta[i];
+            }
+            if (beta > std::numeric_limits<_T>::epsilon() * scale) {
+                for (std::size_t n{}; n < N; ++n) {
+                    basis[KEEP][n] = residual[n] / beta;
+                }
+                for (std::size_t i{}; i < KEEP; ++i) {
+                    T(i, KEEP) = T(KEEP, i) = beta * S(i, M - 1);
+                }
+            } else {
+                Random(basis[KEEP], KEEP);
+            }
+            start = KEEP;
         }
+    }
 
-        return xo_lower;
+    /**
+    * \brief given a (large) cubic symmetric matrix, return its K largest eigenvalues and eigenvectors using
+    *        thick restarted Lanczos iterations (see 'EigenSolverLanczos' which accepts an operator).
+    *
+    * @param {matrixBase, in}  symmetric matrix (NxN)
+    * @param {vectorBase, out} K largest eigenvalues (sorted from big to small)
+    * @param {matrixBase, out} matrix whose K columns are the normalized eigenvectors (KxN)
+    * @param {T,          in}  tolerance (eigenpair is converged when ||A * x - lambda * x|| <= tolerance * |largest eigenvalue|)
+    * @param {size_t,     in}  maximal number of restarts
+    * @param {bool,       out} true if all K eigenpairs converged, false otherwise
+    **/
+    template<std::size_t KRYLOV = 0, typename T, typename U, typename W, REQUIRE(is_Cubic<T>::value && is_Vector_v<U> && is_MatrixBase_v<W> &&
+                                                                                   (Columns_v<W> == Length_v<U>) && (Rows_v<W> == Rows_v<T>) &&
+                                                                                   std::is_same_v<underlying_type_t<T>, underlying_type_t<U>> &&
+                                                                                   std::is_same_v<underlying_type_t<T>, underlying_type_t<W>>)>
+    bool EigenSolverLanczos(const T& xi_mat, U& xo_values, W& xo_vectors,
+                            const underlying_type_t<U> xi_tolerance = std::sqrt(std::numeric_limits<underlying_type_t<U>>::epsilon()),
+                            const std::size_t xi_maxRestarts = 100) {
+        return EigenSolverLanczos<KRYLOV>([&xi_mat](const VectorBase<underlying_type_t<T>, Rows_v<T>>& x) { return xi_mat * x; },
+                                          xo_values, xo_vectors, xi_tolerance, xi_maxRestarts);
     }
 
     // --------------------------------------
@@ -1357,19 +2821,18 @@ namespace GLSLCPP {
     constexpr VectorBase<underlying_type_t<T>, Columns_v<T>> 
     SolveQR(const T& xi_A, const VectorBase<underlying_type_t<T>, Rows_v<T>>& xi_B) noexcept {
         using _T = underlying_type_t<T>;
-        constexpr std::size_t COL{ Columns_v<T> },
-                              ROW{ Rows_v<T> };
+        constexpr std::size_t COL{ Columns_v<T> };
 
         // QR decomposition
-        MatrixBase<_T, COL, ROW> Q(_T{});
-        MatrixBase<_T, COL, COL> R(_T{});
+        T Q(_T{});
+        MatrixBase<_T, COL, COL, Layout_v<T>> R(_T{});
         QRgivensRotations(xi_A, Q, R);
 
         // C = Q * B
         const auto C(xi_B * Q);
 
         // R*x = C
-        MatrixBase<_T, COL, COL> Rlu;
+        MatrixBase<_T, COL, COL, Layout_v<T>> Rlu;
         VectorBase<std::size_t, COL> piv;
         int32_t sign;
         LU(R, Rlu, piv, sign);
@@ -1377,6 +2840,266 @@ namespace GLSLCPP {
         return SolveSquareLU(Rlu, C);
     }
 
+    /**
+    * \brief solve the linear least squares problem min(||A*x - b||) given the compact Householder QR decomposition of 'A'
+    *        (as calculated by 'QRhouseholder'). the decomposition can be reused for any number of right hand sides.
+    *
+    * @param {matrixBase,            in}  compact QR decomposition of A (COLxROW, ROW >= COL)
+    * @param {vectorBase,            in}  reflectors coefficients (COL)
+    * @param {vectorBase/matrixBase, in}  b (column vector of length ROW, or a matrix whose columns are right hand sides)
+    * @param {vectorBase/matrixBase, out} x (column vector of length COL, or a matrix whose columns are solutions)
+    **/
+    template<typename T, typename U, typename V, REQUIRE(is_MatrixBase_v<T> && (Rows_v<T> >= Columns_v<T>) &&
+                                                         Is_VectorOfLength_v<U, Columns_v<T>> && std::is_same_v<underlying_type_t<T>, underlying_type_t<U>> &&
+                                                         Is_VectorOfLength_v<V, Rows_v<T>> && std::is_same_v<underlying_type_t<T>, underlying_type_t<V>>)>
+    VectorBase<underlying_type_t<T>, Columns_v<T>> SolveLeastSquares(const T& xi_qr, const U& xi_tau, const V& xi_b) noexcept {
+        using _T = underlying_type_t<T>;
+        constexpr std::size_t COL{ Columns_v<T> },
+                              ROW{ Rows_v<T> };
+
+        MatrixBase<_T, 1, ROW> b(_T{});
+        for (std::size_t i{}; i < ROW; ++i) {
+            b(0, i) = xi_b[i];
+        }
+
+        const MatrixBase<_T, 1, COL> x(SolveLeastSquares(xi_qr, xi_tau, b));
+
+        VectorBase<_T, COL> xo_x;
+        for (std::size_t i{}; i < COL; ++i) {
+            xo_x[i] = x(0, i);
+        }
+
+        return xo_x;
+    }
+
+    template<typename T, typename U, std::size_t N, REQUIRE(is_MatrixBase_v<T> && !is_RowMajor_v<T> && (Rows_v<T> >= Columns_v<T>) &&
+                                                            Is_VectorOfLength_v<U, Columns_v<T>> && std::is_same_v<underlying_type_t<T>, underlying_type_t<U>>)>
+    MatrixBase<underlying_type_t<T>, N, Columns_v<T>> SolveLeastSquares(const T& xi_qr, const U& xi_tau, const MatrixBase<underlying_type_t<T>, N, Rows_v<T>>& xi_b) noexcept {
+        using _T = underlying_type_t<T>;
+        constexpr std::size_t COL{ Columns_v<T> },
+                              ROW{ Rows_v<T> },
+                              BLOCK{ 4 };
+
+        MatrixBase<_T, N, ROW> b(xi_b);
+        MatrixBase<_T, N, COL> xo_x(_T{});
+        const _T* a{ xi_qr.m_data.m_data.data() };
+        _T* y{ &b.m_data[0] };
+
+        // Y = Q^T * B = H_(COL-1) * ... * H_0 * B (full panels are applied as block reflectors)
+        std::size_t k0{};
+        for (; k0 + BLOCK <= COL; k0 += BLOCK) {
+            std::array<_T, BLOCK> tau;
+            std::array<_T, BLOCK * BLOCK> t;
+            for (std::size_t i{}; i < BLOCK; ++i) {
+                tau[i] = xi_tau[k0 + i];
+            }
+            householder_detail::BlockReflectorFactor<BLOCK>(a, ROW, k0, tau, t);
+
+            for (std::size_t n{}; n < N; ++n) {
+                householder_detail::ApplyBlockReflectorTransposed<BLOCK>(a, ROW, k0, t, y + n * ROW);
+            }
+        }
+        for (; k0 < COL; ++k0) {
+            for (std::size_t n{}; n < N; ++n) {
+                householder_detail::ApplyReflector(a, ROW, k0, xi_tau[k0], y + n * ROW);
+            }
+        }
+
+        // R * X = Y (upper portion of Y)
+        for (std::size_t n{}; n < N; ++n) {
+            _T* yn{ y + n * ROW };
+            for (std::size_t k{ COL }; k-- > 0;) {
+                yn[k] /= a[k * ROW + k];
+                for (std::size_t i{}; i < k; ++i) {
+                    yn[i] -= yn[k] * a[k * ROW + i];
+                }
+            }
+
+            for (std::size_t i{}; i < COL; ++i) {
+                xo_x(n, i) = yn[i];
+            }
+        }
+
+        return xo_x;
+    }
+
+    // reflectors are contiguous columns, so a row major decomposition is applied as a column major copy
+    template<typename T, typename U, std::size_t N, REQUIRE(is_MatrixBase_v<T> && is_RowMajor_v<T> && (Rows_v<T> >= Columns_v<T>) &&
+                                                            Is_VectorOfLength_v<U, Columns_v<T>> && std::is_same_v<underlying_type_t<T>, underlying_type_t<U>>)>
+    MatrixBase<underlying_type_t<T>, N, Columns_v<T>> SolveLeastSquares(const T& xi_qr, const U& xi_tau, const MatrixBase<underlying_type_t<T>, N, Rows_v<T>>& xi_b) noexcept {
+        return SolveLeastSquares(ColumnMajor(xi_qr), xi_tau, xi_b);
+    }
+
+    /**
+    * \brief solve the linear least squares problem min(||A*x - b||) using Householder QR decomposition
+    *
+    * @param {matrixBase,            in}  A (COLxROW, ROW >= COL)
+    * @param {vectorBase/matrixBase, in}  b (column vector of length ROW, or a matrix whose columns are right hand sides)
+    * @param {vectorBase/matrixBase, out} x (column vector of length COL, or a matrix whose columns are solutions)
+    **/
+    template<typename T, typename V, REQUIRE(is_MatrixBase_v<T> && (Rows_v<T> >= Columns_v<T>) &&
+                                             (Is_VectorOfLength_v<V, Rows_v<T>> || (is_MatrixBase_v<V> && (Rows_v<V> == Rows_v<T>))))>
+    auto SolveLeastSquares(const T& xi_A, const V& xi_b) noexcept {
+        using _T = underlying_type_t<T>;
+
+        MatrixBase<_T, Columns_v<T>, Rows_v<T>> qr(_T{});
+        VectorBase<_T, Columns_v<T>> tau;
+        QRhouseholder(ColumnMajor(xi_A), qr, tau);
+
+        return SolveLeastSquares(qr, tau, xi_b);
+    }
+
+    /**
+    * \brief solve linear system A*x=b where A is the symmetric Toeplitz matrix generated by vector 't' (i.e. - A = Toeplitz(t))
+    *        using Levinson-Durbin recursion, in O(N^2) operations and without forming A.
+    *        (A must be positive definite, or at least have nonsingular leading principal sub matrices)
+    *
+    * @param {vectorBase, in}  t (first column of A)
+    * @param {vectorBase, in}  b (column vector)
+    * @param {vectorBase, out} x (column vector)
+    **/
+    template<typename T, typename U, REQUIRE(Are_TwoVectorsSimilar_v<T, U> && std::is_same_v<underlying_type_t<T>, underlying_type_t<U>>)>
+    constexpr U SolveToeplitz(const T& xi_t, const U& xi_b) noexcept {
+        using _T = underlying_type_t<T>;
+        constexpr std::size_t N{ Length_v<T> };
+        assert(xi_t[0] != _T{} && " SolveToeplitz(t, b) - t[0] must not be zero.");
+
+        // normalize system to unit diagonal
+        const _T scale{ static_cast<_T>(1) / xi_t[0] };
+        U xo_x;
+        xo_x[0] = xi_b[0] * scale;
+        if constexpr (N == 1) {
+            return xo_x;
+        }
+
+        // y - solution of the Yule-Walker system of the current order (Durbin), x - solution of current order (Levinson)
+        VectorBase<_T, N> y,
+                          temp;
+        _T alpha{ -xi_t[1] * scale },
+           beta{ static_cast<_T>(1) };
+        y[0] = alpha;
+
+        for (std::size_t k{ 1 }; k < N; ++k) {
+            beta *= (static_cast<_T>(1) - alpha * alpha);
+            assert(beta != _T{} && " SolveToeplitz(t, b) - Toeplitz matrix has a singular leading principal sub matrix.");
+
+            _T mu{ xi_b[k] * scale };
+            for (std::size_t i{}; i < k; ++i) {
+                mu -= xi_t[i + 1] * scale * xo_x[k - 1 - i];
+            }
+            mu /= beta;
+
+            for (std::size_t i{}; i < k; ++i) {
+                temp[i] = xo_x[i] + mu * y[k - 1 - i];
+            }
+            for (std::size_t i{}; i < k; ++i) {
+                xo_x[i] = temp[i];
+            }
+            xo_x[k] = mu;
+
+            if (k + 1 < N) {
+                alpha = -xi_t[k + 1] * scale;
+                for (std::size_t i{}; i < k; ++i) {
+                    alpha -= xi_t[i + 1] * scale * y[k - 1 - i];
+                }
+                alpha /= beta;
+
+                for (std::size_t i{}; i < k; ++i) {
+                    temp[i] = y[i] + alpha * y[k - 1 - i];
+                }
+                for (std::size_t i{}; i < k; ++i) {
+                    y[i] = temp[i];
+                }
+                y[k] = alpha;
+            }
+        }
+
+        return xo_x;
+    }
+
+    /**
+    * \brief solve linear system A*x=b where A is the van-der-monde matrix generated by vector 'v' (i.e. - A = VanDerMonde(v),
+    *        whose column 'i' holds the powers of v[i] in descending order) using Bjorck-Pereyra algorithm,
+    *        in O(N^2) operations and without forming A.
+    *        (v elements must be distinct)
+    *
+    * @param {vectorBase, in}  v
+    * @param {vectorBase, in}  b (column vector)
+    * @param {vectorBase, out} x (column vector)
+    **/
+    template<typename T, typename U, REQUIRE(Are_TwoVectorsSimilar_v<T, U> && std::is_same_v<underlying_type_t<T>, underlying_type_t<U>>)>
+    constexpr U SolveVanDerMonde(const T& xi_v, const U& xi_b) noexcept {
+        constexpr std::size_t N{ Length_v<T> };
+
+        // right hand side in ascending powers order
+        U xo_x;
+        for (std::size_t i{}; i < N; ++i) {
+            xo_x[i] = xi_b[N - 1 - i];
+        }
+
+        for (std::size_t k{}; k + 1 < N; ++k) {
+            for (std::size_t i{ N - 1 }; i > k; --i) {
+                xo_x[i] -= xi_v[k] * xo_x[i - 1];
+            }
+        }
+
+        for (std::size_t k{ N - 1 }; k > 0; --k) {
+            for (std::size_t i{ k }; i < N; ++i) {
+                assert(xi_v[i] != xi_v[i - k] && " SolveVanDerMonde(v, b) - v elements must be distinct.");
+                xo_x[i] /= (xi_v[i] - xi_v[i - k]);
+            }
+            for (std::size_t i{ k - 1 }; i + 1 < N; ++i) {
+                xo_x[i] -= xo_x[i + 1];
+            }
+        }
+
+        return xo_x;
+    }
+
+    /**
+    * \brief solve linear system A^T*x=b where A is the van-der-monde matrix generated by vector 'v' (i.e. - A = VanDerMonde(v))
+    *        using Bjorck-Pereyra algorithm, in O(N^2) operations and without forming A.
+    *        this is polynomial interpolation, i.e. - x holds the coefficients (in descending powers order) of the polynomial
+    *        of degree N-1 which passes through the points {v[i], b[i]}.
+    *        (v elements must be distinct)
+    *
+    * @param {vectorBase, in}  v (interpolation points)
+    * @param {vectorBase, in}  b (column vector; interpolated values)
+    * @param {vectorBase, out} x (column vector; polynomial coefficients in descending powers order)
+    **/
+    template<typename T, typename U, REQUIRE(Are_TwoVectorsSimilar_v<T, U> && std::is_same_v<underlying_type_t<T>, underlying_type_t<U>>)>
+    constexpr U SolveVanDerMondeTransposed(const T& xi_v, const U& xi_b) noexcept {
+        using _T = underlying_type_t<T>;
+        constexpr std::size_t N{ Length_v<T> };
+
+        // newton divided differences
+        VectorBase<_T, N> a;
+        for (std::size_t i{}; i < N; ++i) {
+            a[i] = xi_b[i];
+        }
+        for (std::size_t k{}; k + 1 < N; ++k) {
+            for (std::size_t i{ N - 1 }; i > k; --i) {
+                assert(xi_v[i] != xi_v[i - k - 1] && " SolveVanDerMondeTransposed(v, b) - v elements must be distinct.");
+                a[i] = (a[i] - a[i - 1]) / (xi_v[i] - xi_v[i - k - 1]);
+            }
+        }
+
+        // newton form to monomial form (ascending powers order)
+        for (std::size_t k{ N - 1 }; k > 0; --k) {
+            for (std::size_t i{ k - 1 }; i + 1 < N; ++i) {
+                a[i] -= a[i + 1] * xi_v[k - 1];
+            }
+        }
+
+        // descending powers order
+        U xo_x;
+        for (std::size_t i{}; i < N; ++i) {
+            xo_x[i] = a[N - 1 - i];
+        }
+
+        return xo_x;
+    }
+
 
     // ---------------
     // --- Queries ---
@@ -1695,8 +3418,10 @@ namespace GLSLCPP {
             s =  t;
         }
 
-        xo_U = { c, s,
-                -s, c };
+        xo_U(0, 0) =  c;
+        xo_U(0, 1) =  s;
+        xo_U(1, 0) = -s;
+        xo_U(1, 1) =  c;
     }
 
     /**
@@ -1724,8 +3449,10 @@ namespace GLSLCPP {
             c =  x0 * den;
             s = -x1 * den;
         }
-        xo_R = { c, s,
-                -s, c };
+        xo_R(0, 0) =  c;
+        xo_R(0, 1) =  s;
+        xo_R(1, 0) = -s;
+        xo_R(1, 1) =  c;
 
         // S
         xo_S = xi_A;
@@ -1818,4 +3545,278 @@ namespace GLSLCPP {
         }
     }
 
+    namespace polar_detail {
+
+        // 3x3 matrix stored as 9 column major elements
+        template<typename T> using Matrix3 = std::array<T, 9>;
+
+        template<typename T>
+        constexpr inline T Determinant(const Matrix3<T>& xi_a) noexcept {
+            return xi_a[0] * (xi_a[4] * xi_a[8] - xi_a[5] * xi_a[7]) -
+                   xi_a[3] * (xi_a[1] * xi_a[8] - xi_a[2] * xi_a[7]) +
+                   xi_a[6] * (xi_a[1] * xi_a[5] - xi_a[2] * xi_a[4]);
+        }
+
+        template<typename T>
+        constexpr inline T FrobeniusSquared(const Matrix3<T>& xi_a) noexcept {
+            T xo_sum{};
+            for (std::size_t i{}; i < 9; ++i) {
+                xo_sum += xi_a[i] * xi_a[i];
+            }
+            return xo_sum;
+        }
+
+        // true if matrix is inverted or close to singular, i.e. - Newton iteration might not converge to a proper rotation
+        template<typename T>
+        constexpr inline bool IsDegenerate(const Matrix3<T>& xi_a) noexcept {
+            // det <= sqrt(epsilon) * ||A||^3
+            const T det{ Determinant(xi_a) },
+                    norm{ FrobeniusSquared(xi_a) };
+            return (det <= T{}) || (det * det <= std::numeric_limits<T>::epsilon() * norm * norm * norm);
+        }
+
+        /**
+        * \brief one step of scaled Newton iteration for the orthogonal polar factor (Higham):
+        *        X = 0.5 * (gamma * X + X^-T / gamma), where gamma = sqrt(||X^-1|| / ||X||) (frobenius norm).
+        *        X^-T is the cofactor matrix divided by the determinant, so the step is branch free.
+        *        returns the squared frobenius norm of the change in X.
+        **/
+        template<typename T>
+        constexpr inline T NewtonStep(Matrix3<T>& xio_x) noexcept {
+            const Matrix3<T> cofactor{ xio_x[4] * xio_x[8] - xio_x[5] * xio_x[7],
+                                       xio_x[5] * xio_x[6] - xio_x[3] * xio_x[8],
+                                       xio_x[3] * xio_x[7] - xio_x[4] * xio_x[6],
+                                       xio_x[7] * xio_x[2] - xio_x[8] * xio_x[1],
+                                       xio_x[8] * xio_x[0] - xio_x[6] * xio_x[2],
+                                       xio_x[6] * xio_x[1] - xio_x[7] * xio_x[0],
+                                       xio_x[1] * xio_x[5] - xio_x[2] * xio_x[4],
+                                       xio_x[2] * xio_x[3] - xio_x[0] * xio_x[5],
+                                       xio_x[0] * xio_x[4] - xio_x[1] * xio_x[3] };
+            const T det{ xio_x[0] * cofactor[0] + xio_x[1] * cofactor[1] + xio_x[2] * cofactor[2] },
+                    gamma{ std::sqrt(std::sqrt(FrobeniusSquared(cofactor) / FrobeniusSquared(xio_x)) / std::abs(det)) },
+                    a{ static_cast<T>(0.5) * gamma },
+                    b{ static_cast<T>(0.5) / (gamma * det) };
+
+            T xo_delta{};
+            for (std::size_t i{}; i < 9; ++i) {
+                const T x{ a * xio_x[i] + b * cofactor[i] },
+                        d{ x - xio_x[i] };
+                xo_delta += d * d;
+                xio_x[i] = x;
+            }
+            return xo_delta;
+        }
+
+        /**
+        * \brief rotation maximizing trace(R^T * A) - its quaternion is the eigenvector of the largest eigenvalue
+        *        of a symmetric 4x4 matrix built from A (Horn). always a proper rotation, also for inverted or singular A.
+        **/
+        template<typename T>
+        inline Matrix3<T> QuaternionRotation(const Matrix3<T>& xi_a) noexcept {
+            // xi_a[c * 3 + r] is element at row r and column c
+            const T a00{ xi_a[0] }, a10{ xi_a[1] }, a20{ xi_a[2] },
+                    a01{ xi_a[3] }, a11{ xi_a[4] }, a21{ xi_a[5] },
+                    a02{ xi_a[6] }, a12{ xi_a[7] }, a22{ xi_a[8] };
+            const MatrixBase<T, 4, 4> K(a00 + a11 + a22, a21 - a12,        a02 - a20,        a10 - a01,
+                                        a21 - a12,       a00 - a11 - a22,  a01 + a10,        a02 + a20,
+                                        a02 - a20,       a01 + a10,        a11 - a00 - a22,  a12 + a21,
+                                        a10 - a01,       a02 + a20,        a12 + a21,        a22 - a00 - a11);
+            VectorBase<T, 4> values;
+            MatrixBase<T, 4, 4> vectors;
+            EigenSolverSymmetric(K, values, vectors);
+
+            // quaternion (w, x, y, z) to rotation matrix
+            const T w{ vectors(0, 0) }, x{ vectors(0, 1) }, y{ vectors(0, 2) }, z{ vectors(0, 3) };
+            return Matrix3<T>{ w * w + x * x - y * y - z * z, static_cast<T>(2) * (x * y + w * z),         static_cast<T>(2) * (x * z - w * y),
+                               static_cast<T>(2) * (x * y - w * z),         w * w - x * x + y * y - z * z, static_cast<T>(2) * (y * z + w * x),
+                               static_cast<T>(2) * (x * z + w * y),         static_cast<T>(2) * (y * z - w * x),         w * w - x * x - y * y + z * z };
+        }
+
+        // S = R^T * A (symmetrized)
+        template<typename T>
+        constexpr inline Matrix3<T> Stretch(const Matrix3<T>& xi_r, const Matrix3<T>& xi_a) noexcept {
+            Matrix3<T> s{};
+            for (std::size_t c{}; c < 3; ++c) {
+                for (std::size_t r{}; r < 3; ++r) {
+                    s[c * 3 + r] = xi_r[r * 3] * xi_a[c * 3] + xi_r[r * 3 + 1] * xi_a[c * 3 + 1] + xi_r[r * 3 + 2] * xi_a[c * 3 + 2];
+                }
+            }
+
+            Matrix3<T> xo_s{};
+            for (std::size_t c{}; c < 3; ++c) {
+                for (std::size_t r{}; r < 3; ++r) {
+                    xo_s[c * 3 + r] = static_cast<T>(0.5) * (s[c * 3 + r] + s[r * 3 + c]);
+                }
+            }
+            return xo_s;
+        }
+
+        // polar decomposition of a batch of matrices given as structure of arrays (S is skipped if its streams are not given)
+        template<typename T, bool STRETCH>
+        inline void Batch(const std::array<const T*, 9>& xi_A, const std::array<T*, 9>& xo_R, const std::array<T*, 9>& xo_S,
+                          const std::size_t xi_count, const std::size_t xi_iterations) noexcept {
+            // matrices are copied into blocks of BLOCK lanes (structure of arrays, element j of lane l is at [j][l]),
+            // and all lanes are updated by branch free Newton steps until the whole block converged.
+            // iterates converge to rotations (whose squared frobenius norm is 3), so the change is measured against 3, whatever the scale of A.
+            // padding lanes, inverted and (close to) singular matrices are replaced by identity (which converges immediately),
+            // and the rotation of the later is extracted from their quaternion.
+            constexpr std::size_t BLOCK{ 16 };
+            using Block = std::array<std::array<T, BLOCK>, 9>;
+            const Matrix3<T> identity{ 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+            for (std::size_t first{}; first < xi_count; first += BLOCK) {
+                const std::size_t lanes{ std::min(BLOCK, xi_count - first) };
+                Block a, x;
+                std::array<T, BLOCK> delta;
+                std::array<bool, BLOCK> degenerate;
+                for (std::size_t j{}; j < 9; ++j) {
+                    for (std::size_t l{}; l < BLOCK; ++l) {
+                        a[j][l] = (l < lanes) ? xi_A[j][first + l] : identity[j];
+                    }
+                }
+                for (std::size_t l{}; l < BLOCK; ++l) {
+                    Matrix3<T> r;
+                    for (std::size_t j{}; j < 9; ++j) {
+                        r[j] = a[j][l];
+                    }
+                    degenerate[l] = IsDegenerate(r);
+                    for (std::size_t j{}; j < 9; ++j) {
+                        x[j][l] = degenerate[l] ? identity[j] : r[j];
+                    }
+                }
+
+                for (std::size_t k{}; k < xi_iterations; ++k) {
+                    for (std::size_t l{}; l < BLOCK; ++l) {
+                        Matrix3<T> r;
+                        for (std::size_t j{}; j < 9; ++j) {
+                            r[j] = x[j][l];
+                        }
+                        delta[l] = NewtonStep(r);
+                        for (std::size_t j{}; j < 9; ++j) {
+                            x[j][l] = r[j];
+                        }
+                    }
+                    if (*std::max_element(delta.begin(), delta.end()) <= static_cast<T>(3) * std::numeric_limits<T>::epsilon()) break;
+                }
+
+                for (std::size_t l{}; l < lanes; ++l) {
+                    if (degenerate[l]) {
+                        Matrix3<T> r;
+                        for (std::size_t j{}; j < 9; ++j) {
+                            r[j] = a[j][l];
+                        }
+                        r = QuaternionRotation(r);
+                        for (std::size_t j{}; j < 9; ++j) {
+                            x[j][l] = r[j];
+                        }
+                    }
+                }
+
+                // export
+                for (std::size_t j{}; j < 9; ++j) {
+                    for (std::size_t l{}; l < lanes; ++l) {
+                        xo_R[j][first + l] = x[j][l];
+                    }
+                }
+                if constexpr (STRETCH) {
+                    Block s;
+                    for (std::size_t l{}; l < BLOCK; ++l) {
+                        Matrix3<T> r, m;
+                        for (std::size_t j{}; j < 9; ++j) {
+                            r[j] = x[j][l];
+                            m[j] = a[j][l];
+                        }
+                        m = Stretch(r, m);
+                        for (std::size_t j{}; j < 9; ++j) {
+                            s[j][l] = m[j];
+                        }
+                    }
+                    for (std::size_t j{}; j < 9; ++j) {
+                        for (std::size_t l{}; l < lanes; ++l) {
+                            xo_S[j][first + l] = s[j][l];
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    /**
+    * \brief perform polar decomposition (PD) on a given 3x3 matrix, i.e. A = R * S,
+    *        where R is a proper rotation matrix (det(R) = 1) and S is symmetric describing deformations.
+    *        R is calculated by scaled Newton iterations, inverted or (close to) singular matrices are handled by
+    *        extracting the rotation quaternion, in which case S has a negative eigenvalue (a granted negative sign on the small magnitude singular value).
+    *
+    * @param {matrixBase, in}  A
+    * @param {matrixBase, out} R
+    * @param {matrixBase, out} S
+    **/
+    template<typename T, REQUIRE(is_Cubic<T>::value && (Length_v<T> == 9))>
+    void PolarDecomposition3x3(const T& xi_A, T& xo_R, T& xo_S) noexcept {
+        using _T = underlying_type_t<T>;
+        constexpr std::size_t maxIterations{ 16 };
+
+        polar_detail::Matrix3<_T> a, r;
+        for (std::size_t c{}; c < 3; ++c) {
+            for (std::size_t i{}; i < 3; ++i) {
+                a[c * 3 + i] = xi_A(c, i);
+            }
+        }
+
+        if (polar_detail::IsDegenerate(a)) {
+            r = polar_detail::QuaternionRotation(a);
+        } else {
+            // quadratic convergence - once the change is below sqrt(epsilon) (relative to the iterate, not A, since iterates
+            // converge to a rotation whatever the scale of A) the last iterate is accurate to machine precision
+            r = a;
+            for (std::size_t k{}; k < maxIterations; ++k) {
+                const _T delta{ polar_detail::NewtonStep(r) };
+                if (delta <= std::numeric_limits<_T>::epsilon() * polar_detail::FrobeniusSquared(r)) break;
+            }
+        }
+
+        const polar_detail::Matrix3<_T> s(polar_detail::Stretch(r, a));
+        for (std::size_t c{}; c < 3; ++c) {
+            for (std::size_t i{}; i < 3; ++i) {
+                xo_R(c, i) = r[c * 3 + i];
+                xo_S(c, i) = s[c * 3 + i];
+            }
+        }
+    }
+
+    /**
+    * \brief perform polar decomposition (A = R * S) on a batch of 3x3 matrices given as structure of arrays,
+    *        i.e. - element at column c and row r of matrix #i is xi_A[c * 3 + r][i] (same for R and S).
+    *        matrices are processed in blocks by branch free Newton iterations (auto-vectorizable),
+    *        inverted or (close to) singular matrices are then fixed by quaternion rotation extraction,
+    *        so all rotations are proper (see scalar 'PolarDecomposition3x3').
+    *        Remark: gcc/clang vectorize the square roots of the Newton iteration only with -fno-math-errno.
+    *
+    * @param {array<T*, 9>, in}  pointers to 9 element streams of A
+    * @param {array<T*, 9>, out} pointers to 9 element streams of R (each must hold 'xi_count' elements)
+    * @param {array<T*, 9>, out} pointers to 9 element streams of S (each must hold 'xi_count' elements)
+    * @param {size_t,       in}  number of matrices
+    * @param {size_t,       in}  maximal number of Newton iterations
+    **/
+    template<typename T, REQUIRE(std::is_floating_point_v<T>)>
+    void PolarDecomposition3x3(const std::array<const T*, 9>& xi_A, const std::array<T*, 9>& xo_R, const std::array<T*, 9>& xo_S,
+                               const std::size_t xi_count, const std::size_t xi_iterations = 16) noexcept {
+        polar_detail::Batch<T, true>(xi_A, xo_R, xo_S, xi_count, xi_iterations);
+    }
+
+    /**
+    * \brief extract the rotation (R in A = R * S) of a batch of 3x3 matrices given as structure of arrays
+    *        (same as 'PolarDecomposition3x3' without calculating S).
+    *
+    * @param {array<T*, 9>, in}  pointers to 9 element streams of A
+    * @param {array<T*, 9>, out} pointers to 9 element streams of R (each must hold 'xi_count' elements)
+    * @param {size_t,       in}  number of matrices
+    * @param {size_t,       in}  maximal number of Newton iterations
+    **/
+    template<typename T, REQUIRE(std::is_floating_point_v<T>)>
+    void PolarRotation3x3(const std::array<const T*, 9>& xi_A, const std::array<T*, 9>& xo_R,
+                          const std::size_t xi_count, const std::size_t xi_iterations = 16) noexcept {
+        polar_detail::Batch<T, false>(xi_A, xo_R, xo_R, xi_count, xi_iterations);
+    }
+
 }; // namespace GLSLCPP
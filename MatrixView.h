@@ -0,0 +1,546 @@
+/**
+* GLSL++
+*
+* non owning views over the storage of a MatrixBase (columns, rows, diagonals and rectangular blocks).
+* views read and write the viewed matrix directly, so partitioned algorithms (block updates, Schur complements, etc.)
+* can operate on portions of a matrix without copying them.
+*
+* a view does not extend the lifetime of the matrix it views.
+* arithmetic between a view and another operand yields a value (VectorBase/MatrixBase), not a view.
+*
+* Dan Israel Malta
+**/
+#pragma once
+#include "common.h"
+#include "VectorBase.h"
+#include "MatrixBase.h"
+#include "LinearAlgebraKernels.h"
+#include <iterator>
+#include <type_traits>
+
+namespace GLSLCPP {
+
+    /**
+    * \brief random access iterator over equally spaced elements
+    *
+    * @param {T, in} underlying type (const qualified for read only iteration)
+    **/
+    template<typename T> class StridedIterator {
+
+        // properties
+    private:
+        T* m_pointer{ nullptr };
+        std::ptrdiff_t m_stride{ 1 };
+
+        // iterator traits
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = std::remove_const_t<T>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = T*;
+        using reference         = T&;
+
+        // constructors
+    public:
+        constexpr StridedIterator() noexcept = default;
+        constexpr StridedIterator(T* xi_pointer, const std::ptrdiff_t xi_stride) noexcept : m_pointer(xi_pointer), m_stride(xi_stride) {}
+
+        // operators
+    public:
+        constexpr T& operator*() const noexcept { return *m_pointer; }
+        constexpr T* operator->() const noexcept { return m_pointer; }
+        constexpr T& operator[](const difference_type i) const noexcept { return m_pointer[i * m_stride]; }
+
+        constexpr StridedIterator& operator++() noexcept { m_pointer += m_stride; return *this; }
+        constexpr StridedIterator& operator--() noexcept { m_pointer -= m_stride; return *this; }
+        constexpr StridedIterator operator++(int) noexcept { StridedIterator xo_it(*this); m_pointer += m_stride; return xo_it; }
+        constexpr StridedIterator operator--(int) noexcept { StridedIterator xo_it(*this); m_pointer -= m_stride; return xo_it; }
+        constexpr StridedIterator& operator+=(const difference_type n) noexcept { m_pointer += n * m_stride; return *this; }
+        constexpr StridedIterator& operator-=(const difference_type n) noexcept { m_pointer -= n * m_stride; return *this; }
+
+        constexpr friend StridedIterator operator+(StridedIterator it, const difference_type n) noexcept { return it += n; }
+        constexpr friend StridedIterator operator+(const difference_type n, StridedIterator it) noexcept { return it += n; }
+        constexpr friend StridedIterator operator-(StridedIterator it, const difference_type n) noexcept { return it -= n; }
+        constexpr friend difference_type operator-(const StridedIterator& a, const StridedIterator& b) noexcept { return (a.m_pointer - b.m_pointer) / a.m_stride; }
+
+        constexpr friend bool operator==(const StridedIterator& a, const StridedIterator& b) noexcept { return a.m_pointer == b.m_pointer; }
+        constexpr friend bool operator!=(const StridedIterator& a, const StridedIterator& b) noexcept { return a.m_pointer != b.m_pointer; }
+        constexpr friend bool operator< (const StridedIterator& a, const StridedIterator& b) noexcept { return (b - a) > 0; }
+        constexpr friend bool operator> (const StridedIterator& a, const StridedIterator& b) noexcept { return b < a; }
+        constexpr friend bool operator<=(const StridedIterator& a, const StridedIterator& b) noexcept { return !(b < a); }
+        constexpr friend bool operator>=(const StridedIterator& a, const StridedIterator& b) noexcept { return !(a < b); }
+    };
+
+    template<typename T, std::size_t N> class VectorView;
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L = Layout::ColumnMajor> class BlockView;
+
+    // type trait to test if an object is a vector view
+    template<typename>                  struct is_VectorView : public std::false_type {};
+    template<typename T, std::size_t N> struct is_VectorView<VectorView<T, N>> : public std::true_type {};
+    template<typename T> inline constexpr bool is_VectorView_v = is_VectorView<std::remove_cv_t<std::remove_reference_t<T>>>::value;
+
+    // type trait to test if an object is a block view
+    template<typename>                                               struct is_BlockView : public std::false_type {};
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L> struct is_BlockView<BlockView<T, COL, ROW, L>> : public std::true_type {};
+    template<typename T> inline constexpr bool is_BlockView_v = is_BlockView<std::remove_cv_t<std::remove_reference_t<T>>>::value;
+
+    // number of elements in a vector view
+    template<typename T, std::size_t N> struct Length<VectorView<T, N>> { static constexpr std::size_t value{ N }; };
+
+    namespace view_detail {
+
+        // convert an operand of a view operation to a value (views are evaluated, vectors and scalars are converted)
+        template<typename T, std::size_t N, typename U>
+        constexpr VectorBase<T, N> AsVector(const U& xi_operand) {
+            if constexpr (is_VectorView_v<U>) {
+                return xi_operand.eval();
+            }
+            else if constexpr (std::is_arithmetic_v<U>) {
+                return VectorBase<T, N>(xi_operand);
+            }
+            else {
+                static_assert(Is_VectorOfLength_v<U, N>, "view operation - operand must be a scalar, a vector or a view of the same length.");
+                VectorBase<T, N> xo_vec;
+                for (std::size_t i{}; i < N; ++i) {
+                    xo_vec[i] = static_cast<T>(xi_operand[i]);
+                }
+                return xo_vec;
+            }
+        }
+
+        // position of element (col, row) in storage whose leading dimension is 'ld' (number of rows if column major, number of columns if row major)
+        template<Layout L>
+        constexpr std::size_t Offset(const std::size_t xi_col, const std::size_t xi_row, const std::size_t xi_ld) noexcept {
+            return (L == Layout::ColumnMajor) ? (xi_col * xi_ld + xi_row) : (xi_row * xi_ld + xi_col);
+        }
+
+        // underlying storage and leading dimension of a matrix or block view
+        template<typename T, std::size_t COL, std::size_t ROW, Layout L>
+        constexpr const T* Data(const MatrixBase<T, COL, ROW, L>& xi_mat) noexcept { return xi_mat.m_data.m_data.data(); }
+        template<typename T, std::size_t COL, std::size_t ROW, Layout L>
+        constexpr T* Data(MatrixBase<T, COL, ROW, L>& xi_mat) noexcept { return &xi_mat.m_data[0]; }
+        template<typename T, std::size_t COL, std::size_t ROW, Layout L>
+        constexpr T* Data(const BlockView<T, COL, ROW, L>& xi_block) noexcept { return xi_block.data(); }
+
+        template<typename T, std::size_t COL, std::size_t ROW, Layout L>
+        constexpr std::size_t LeadingDimension(const MatrixBase<T, COL, ROW, L>&) noexcept { return (L == Layout::ColumnMajor) ? ROW : COL; }
+        template<typename T, std::size_t COL, std::size_t ROW, Layout L>
+        constexpr std::size_t LeadingDimension(const BlockView<T, COL, ROW, L>& xi_block) noexcept { return xi_block.leadingDimension(); }
+    };
+
+    /**
+    * \brief non owning view over N equally spaced elements (a column, a row or a diagonal of a matrix)
+    *
+    * @param {T, in} underlying type (const qualified for a read only view)
+    * @param {N, in} number of elements
+    **/
+    template<typename T, std::size_t N> class VectorView {
+        static_assert(std::is_arithmetic<T>::value, "VectorView<T,N> - T must be of numerical type.");
+        using _T = std::remove_const_t<T>;
+
+        // properties
+    private:
+        T* m_data;
+        std::size_t m_stride;
+
+        // constructors
+    public:
+
+        constexpr VectorView(T* xi_data, const std::size_t xi_stride) noexcept : m_data(xi_data), m_stride(xi_stride) {}
+
+        // a read only view can be constructed from a writable one
+        template<typename U, REQUIRE(std::is_same_v<const U, T> && !std::is_same_v<U, T>)>
+        constexpr VectorView(const VectorView<U, N>& xi_view) noexcept : m_data(xi_view.data()), m_stride(xi_view.stride()) {}
+
+        VectorView(const VectorView&) noexcept = default;
+
+        // element access and queries
+    public:
+
+        constexpr T& operator[](const std::size_t i) const { assert(i < N && " attempting to access an out-of-region index"); return m_data[i * m_stride]; }
+
+        constexpr std::size_t length() const noexcept { return N; }
+        constexpr T* data() const noexcept { return m_data; }
+        constexpr std::size_t stride() const noexcept { return m_stride; }
+
+        // copy viewed elements into a vector
+        constexpr VectorBase<_T, N> eval() const {
+            VectorBase<_T, N> xo_vec;
+            for (std::size_t i{}; i < N; ++i) {
+                xo_vec[i] = m_data[i * m_stride];
+            }
+            return xo_vec;
+        }
+
+        // iterators
+    public:
+
+        constexpr StridedIterator<T> begin() const noexcept { return StridedIterator<T>(m_data, static_cast<std::ptrdiff_t>(m_stride)); }
+        constexpr StridedIterator<T> end()   const noexcept { return begin() + static_cast<std::ptrdiff_t>(N); }
+        constexpr StridedIterator<const T> cbegin() const noexcept { return StridedIterator<const T>(m_data, static_cast<std::ptrdiff_t>(m_stride)); }
+        constexpr StridedIterator<const T> cend()   const noexcept { return cbegin() + static_cast<std::ptrdiff_t>(N); }
+
+        // assignment operations (viewed elements are written)
+    public:
+
+        // assign another view (through a temporary, since views might overlap)
+        VectorView& operator=(const VectorView& xi_view) {
+            return (*this = xi_view.eval());
+        }
+
+        // assign a scalar, vector or a view
+        template<typename U, REQUIRE(std::is_arithmetic_v<U> || Is_VectorOfLength_v<U, N> || is_VectorView_v<U>)>
+        constexpr VectorView& operator=(const U& xi_value) {
+            static_assert(!std::is_const_v<T>, "VectorView - attempting to write through a read only view.");
+            const VectorBase<_T, N> value(view_detail::AsVector<_T, N>(xi_value));
+            for (std::size_t i{}; i < N; ++i) {
+                m_data[i * m_stride] = value[i];
+            }
+            return *this;
+        }
+
+        // compound operators
+    public:
+
+#define M_OPERATOR(OP)                                                                                                  \
+        template<typename U, REQUIRE(std::is_arithmetic_v<U>)>                                                          \
+        constexpr VectorView& operator OP (const U xi_value) {                                                          \
+            static_assert(!std::is_const_v<T>, "VectorView - attempting to write through a read only view.");           \
+            for (std::size_t i{}; i < N; ++i) {                                                                         \
+                m_data[i * m_stride] OP static_cast<_T>(xi_value);                                                      \
+            }                                                                                                           \
+            return *this;                                                                                               \
+        }                                                                                                               \
+        template<typename U, REQUIRE(Is_VectorOfLength_v<U, N> || is_VectorView_v<U>)>                                  \
+        constexpr VectorView& operator OP (const U& xi_vector) {                                                        \
+            static_assert(!std::is_const_v<T>, "VectorView - attempting to write through a read only view.");           \
+            const VectorBase<_T, N> value(view_detail::AsVector<_T, N>(xi_vector));                                     \
+            for (std::size_t i{}; i < N; ++i) {                                                                         \
+                m_data[i * m_stride] OP value[i];                                                                       \
+            }                                                                                                           \
+            return *this;                                                                                               \
+        }
+
+        M_OPERATOR(+=);
+        M_OPERATOR(-=);
+        M_OPERATOR(*=);
+        M_OPERATOR(/=);
+#undef M_OPERATOR
+    };
+
+    // alias templates for common vector views
+    template<typename T, std::size_t N> using ColumnView = VectorView<T, N>;
+    template<typename T, std::size_t N> using RowView    = VectorView<T, N>;
+    template<typename T, std::size_t N> using DiagView   = VectorView<T, N>;
+
+    // arithmetic involving a vector view (evaluates to a VectorBase)
+#define M_OPERATOR(OP, AOP)                                                                                             \
+    template<typename T, std::size_t N, typename U, REQUIRE(std::is_arithmetic_v<U> || Is_VectorOfLength_v<U, N> || is_VectorView_v<U>)> \
+    constexpr VectorBase<std::remove_const_t<T>, N> operator OP (const VectorView<T, N>& xi_lhs, const U& xi_rhs) {     \
+        VectorBase<std::remove_const_t<T>, N> xo_vec(xi_lhs.eval());                                                     \
+        xo_vec AOP view_detail::AsVector<std::remove_const_t<T>, N>(xi_rhs);                                             \
+        return xo_vec;                                                                                                  \
+    }                                                                                                                   \
+    template<typename T, std::size_t N, typename U, REQUIRE(std::is_arithmetic_v<U> || Is_VectorOfLength_v<U, N>)>      \
+    constexpr VectorBase<std::remove_const_t<T>, N> operator OP (const U& xi_lhs, const VectorView<T, N>& xi_rhs) {     \
+        VectorBase<std::remove_const_t<T>, N> xo_vec(view_detail::AsVector<std::remove_const_t<T>, N>(xi_lhs));          \
+        xo_vec AOP xi_rhs.eval();                                                                                       \
+        return xo_vec;                                                                                                  \
+    }
+
+    M_OPERATOR(+, +=);
+    M_OPERATOR(-, -=);
+    M_OPERATOR(*, *=);
+    M_OPERATOR(/, /=);
+#undef M_OPERATOR
+
+    /**
+    * \brief given a vector view, return a vector in the same direction but with unit magnitude
+    *
+    * @param {VectorView, in}  view
+    * @param {VectorBase, out} viewed elements, normalized
+    **/
+    template<typename T, std::size_t N>
+    constexpr VectorBase<std::remove_const_t<T>, N> Normalize(const VectorView<T, N>& xi_view) {
+        VectorBase<std::remove_const_t<T>, N> xo_vec(xi_view.eval());
+        xo_vec /= length(xo_vec);
+        return xo_vec;
+    }
+
+    /**
+    * \brief return the internal ("dot") product between two vector views, or a vector view and a vector
+    *
+    * @param {VectorView/Vector, in}  a
+    * @param {VectorView/Vector, in}  b
+    * @param {T,                 out} dot(a, b)
+    **/
+    template<typename A, typename B, REQUIRE((is_VectorView_v<A> || is_VectorView_v<B>) && !std::is_same_v<A, B> &&
+                                             (Length_v<A> == Length_v<B>))>
+    constexpr std::remove_const_t<underlying_type_t<A>> dot(const A& xi_a, const B& xi_b) {
+        std::remove_const_t<underlying_type_t<A>> xo_dot{};
+        GLSLCPP_RECORD(Dot, 2 * Length_v<A>, 2 * Length_v<A> * sizeof(xo_dot));
+        for (std::size_t i{}; i < Length_v<A>; ++i) {
+            xo_dot += xi_a[i] * xi_b[i];
+        }
+        return xo_dot;
+    }
+
+    /**
+    * \brief non owning view over a COLxROW rectangular block of a matrix
+    *
+    * @param {T,      in} underlying type (const qualified for a read only view)
+    * @param {COL,    in} number of columns
+    * @param {ROW,    in} number of rows
+    * @param {Layout, in} storage layout of the viewed matrix (column major by default)
+    **/
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L> class BlockView {
+        static_assert(std::is_arithmetic<T>::value, "BlockView<T,COL,ROW> - T must be of numerical type.");
+        using _T = std::remove_const_t<T>;
+
+        // properties
+    private:
+        T* m_data;                   // block first element
+        std::size_t m_ld;            // leading dimension (number of rows (column major) or columns (row major) of the viewed matrix)
+
+        // constructors
+    public:
+
+        constexpr BlockView(T* xi_data, const std::size_t xi_ld) noexcept : m_data(xi_data), m_ld(xi_ld) {}
+
+        // a read only view can be constructed from a writable one
+        template<typename U, REQUIRE(std::is_same_v<const U, T> && !std::is_same_v<U, T>)>
+        constexpr BlockView(const BlockView<U, COL, ROW, L>& xi_view) noexcept : m_data(xi_view.data()), m_ld(xi_view.leadingDimension()) {}
+
+        BlockView(const BlockView&) noexcept = default;
+
+        // element access and queries
+    public:
+
+        // '(col, row)' element access
+        constexpr T& operator()(const std::size_t col, const std::size_t row) const {
+            assert((col < COL) && (row < ROW) && " trying to access a non existent element.");
+            return m_data[view_detail::Offset<L>(col, row, m_ld)];
+        }
+
+        constexpr T* data() const noexcept { return m_data; }
+        constexpr std::size_t leadingDimension() const noexcept { return m_ld; }
+
+        // column, row and diagonal views
+        constexpr VectorView<T, ROW> column(const std::size_t i) const {
+            assert(i < COL && " trying to access a non existent column.");
+            return VectorView<T, ROW>(m_data + view_detail::Offset<L>(i, 0, m_ld), view_detail::Offset<L>(0, 1, m_ld));
+        }
+        constexpr VectorView<T, COL> row(const std::size_t i) const {
+            assert(i < ROW && " trying to access a non existent row.");
+            return VectorView<T, COL>(m_data + view_detail::Offset<L>(0, i, m_ld), view_detail::Offset<L>(1, 0, m_ld));
+        }
+        template<std::size_t C = COL, REQUIRE(C == ROW)>
+        constexpr VectorView<T, COL> diagonal() const {
+            return VectorView<T, COL>(m_data, m_ld + 1);
+        }
+
+        // copy viewed elements into a matrix
+        constexpr MatrixBase<_T, COL, ROW, L> eval() const {
+            MatrixBase<_T, COL, ROW, L> xo_mat(_T{});
+            for (std::size_t c{}; c < COL; ++c) {
+                for (std::size_t r{}; r < ROW; ++r) {
+                    xo_mat(c, r) = m_data[view_detail::Offset<L>(c, r, m_ld)];
+                }
+            }
+            return xo_mat;
+        }
+
+        // assignment operations (viewed elements are written)
+    public:
+
+        // assign another view (through a temporary, since views might overlap)
+        BlockView& operator=(const BlockView& xi_view) {
+            return (*this = xi_view.eval());
+        }
+
+        template<typename U, REQUIRE(std::is_arithmetic_v<U>)>
+        constexpr BlockView& operator=(const U xi_value) {
+            return Apply([v = static_cast<_T>(xi_value)](T& elm, std::size_t, std::size_t) { elm = v; });
+        }
+
+        template<typename U, REQUIRE(std::is_same_v<U, MatrixBase<_T, COL, ROW, L>> || std::is_same_v<U, BlockView<const _T, COL, ROW, L>> ||
+                                     std::is_same_v<U, BlockView<_T, COL, ROW, L>>)>
+        constexpr BlockView& operator=(const U& xi_matrix) {
+            if constexpr (is_BlockView_v<U>) {
+                return (*this = xi_matrix.eval());
+            }
+            else {
+                return Apply([&xi_matrix](T& elm, const std::size_t c, const std::size_t r) { elm = xi_matrix(c, r); });
+            }
+        }
+
+        // compound operators
+    public:
+
+#define M_OPERATOR(OP)                                                                                                  \
+        template<typename U, REQUIRE(std::is_arithmetic_v<U>)>                                                          \
+        constexpr BlockView& operator OP (const U xi_value) {                                                           \
+            return Apply([v = static_cast<_T>(xi_value)](T& elm, std::size_t, std::size_t) { elm OP v; });              \
+        }
+
+        M_OPERATOR(+=);
+        M_OPERATOR(-=);
+        M_OPERATOR(*=);
+        M_OPERATOR(/=);
+#undef M_OPERATOR
+
+#define M_OPERATOR(OP)                                                                                                  \
+        template<typename U, REQUIRE(std::is_same_v<U, MatrixBase<_T, COL, ROW, L>> || std::is_same_v<U, BlockView<const _T, COL, ROW, L>> || \
+                                     std::is_same_v<U, BlockView<_T, COL, ROW, L>>)>                                       \
+        constexpr BlockView& operator OP (const U& xi_matrix) {                                                         \
+            if constexpr (is_BlockView_v<U>) {                                                                          \
+                return (*this OP xi_matrix.eval());                                                                     \
+            }                                                                                                           \
+            else {                                                                                                      \
+                return Apply([&xi_matrix](T& elm, const std::size_t c, const std::size_t r) { elm OP xi_matrix(c, r); }); \
+            }                                                                                                           \
+        }
+
+        M_OPERATOR(+=);
+        M_OPERATOR(-=);
+#undef M_OPERATOR
+
+        // internal helpers
+    private:
+
+        // apply an operation on every viewed element (operation accepts element, column and row), in storage order
+        template<class Fn> constexpr BlockView& Apply(Fn&& xi_function) {
+            static_assert(!std::is_const_v<T>, "BlockView - attempting to write through a read only view.");
+            if constexpr (L == Layout::ColumnMajor) {
+                for (std::size_t c{}; c < COL; ++c) {
+                    T* column{ m_data + c * m_ld };
+                    for (std::size_t r{}; r < ROW; ++r) {
+                        xi_function(column[r], c, r);
+                    }
+                }
+            }
+            else {
+                for (std::size_t r{}; r < ROW; ++r) {
+                    T* row{ m_data + r * m_ld };
+                    for (std::size_t c{}; c < COL; ++c) {
+                        xi_function(row[c], c, r);
+                    }
+                }
+            }
+            return *this;
+        }
+    };
+
+    // ------------------------
+    // --- view "factories" ---
+    // ------------------------
+
+    /**
+    * \brief return a view of a given column/row/diagonal of a matrix
+    *
+    * @param {MatrixBase, in}  matrix
+    * @param {size_t,     in}  column/row index
+    * @param {VectorView, out} view
+    **/
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L>
+    constexpr VectorView<T, ROW> ViewColumn(MatrixBase<T, COL, ROW, L>& xi_matrix, const std::size_t xi_index) {
+        assert(xi_index < COL && "ViewColumn - attempting to view a column which doesn't exist.");
+        constexpr std::size_t LD{ (L == Layout::ColumnMajor) ? ROW : COL };
+        return VectorView<T, ROW>(&xi_matrix.m_data[0] + view_detail::Offset<L>(xi_index, 0, LD), view_detail::Offset<L>(0, 1, LD));
+    }
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L>
+    constexpr VectorView<const T, ROW> ViewColumn(const MatrixBase<T, COL, ROW, L>& xi_matrix, const std::size_t xi_index) {
+        assert(xi_index < COL && "ViewColumn - attempting to view a column which doesn't exist.");
+        constexpr std::size_t LD{ (L == Layout::ColumnMajor) ? ROW : COL };
+        return VectorView<const T, ROW>(xi_matrix.m_data.m_data.data() + view_detail::Offset<L>(xi_index, 0, LD), view_detail::Offset<L>(0, 1, LD));
+    }
+
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L>
+    constexpr VectorView<T, COL> ViewRow(MatrixBase<T, COL, ROW, L>& xi_matrix, const std::size_t xi_index) {
+        assert(xi_index < ROW && "ViewRow - attempting to view a row which doesn't exist.");
+        constexpr std::size_t LD{ (L == Layout::ColumnMajor) ? ROW : COL };
+        return VectorView<T, COL>(&xi_matrix.m_data[0] + view_detail::Offset<L>(0, xi_index, LD), view_detail::Offset<L>(1, 0, LD));
+    }
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L>
+    constexpr VectorView<const T, COL> ViewRow(const MatrixBase<T, COL, ROW, L>& xi_matrix, const std::size_t xi_index) {
+        assert(xi_index < ROW && "ViewRow - attempting to view a row which doesn't exist.");
+        constexpr std::size_t LD{ (L == Layout::ColumnMajor) ? ROW : COL };
+        return VectorView<const T, COL>(xi_matrix.m_data.m_data.data() + view_detail::Offset<L>(0, xi_index, LD), view_detail::Offset<L>(1, 0, LD));
+    }
+
+    template<typename T, std::size_t N, Layout L>
+    constexpr VectorView<T, N> ViewDiagonal(MatrixBase<T, N, N, L>& xi_matrix) {
+        return VectorView<T, N>(&xi_matrix.m_data[0], N + 1);
+    }
+    template<typename T, std::size_t N, Layout L>
+    constexpr VectorView<const T, N> ViewDiagonal(const MatrixBase<T, N, N, L>& xi_matrix) {
+        return VectorView<const T, N>(xi_matrix.m_data.m_data.data(), N + 1);
+    }
+
+    /**
+    * \brief return a view of a block of a given matrix, where the bloc size is known at compile time
+    *
+    * @param {std::size_t, in}  column start
+    * @param {std::size_t, in}  column end
+    * @param {std::size_t, in}  row start
+    * @param {std::size_t, in}  row end
+    * @param {MatrixBase,  in}  matrix
+    * @param {BlockView,   out} view
+    **/
+    template<std::size_t COL_MIN, std::size_t COL_MAX,
+             std::size_t ROW_MIN, std::size_t ROW_MAX,
+             typename T, std::size_t COL, std::size_t ROW, Layout L,
+             REQUIRE((ROW_MIN <= ROW_MAX) && (COL_MIN <= COL_MAX) && (ROW_MAX < ROW) && (COL_MAX < COL))>
+    constexpr BlockView<T, COL_MAX - COL_MIN + 1, ROW_MAX - ROW_MIN + 1, L> ViewBlock(MatrixBase<T, COL, ROW, L>& xi_matrix) noexcept {
+        constexpr std::size_t LD{ (L == Layout::ColumnMajor) ? ROW : COL };
+        return BlockView<T, COL_MAX - COL_MIN + 1, ROW_MAX - ROW_MIN + 1, L>(&xi_matrix.m_data[0] + view_detail::Offset<L>(COL_MIN, ROW_MIN, LD), LD);
+    }
+    template<std::size_t COL_MIN, std::size_t COL_MAX,
+             std::size_t ROW_MIN, std::size_t ROW_MAX,
+             typename T, std::size_t COL, std::size_t ROW, Layout L,
+             REQUIRE((ROW_MIN <= ROW_MAX) && (COL_MIN <= COL_MAX) && (ROW_MAX < ROW) && (COL_MAX < COL))>
+    constexpr BlockView<const T, COL_MAX - COL_MIN + 1, ROW_MAX - ROW_MIN + 1, L> ViewBlock(const MatrixBase<T, COL, ROW, L>& xi_matrix) noexcept {
+        constexpr std::size_t LD{ (L == Layout::ColumnMajor) ? ROW : COL };
+        return BlockView<const T, COL_MAX - COL_MIN + 1, ROW_MAX - ROW_MIN + 1, L>(xi_matrix.m_data.m_data.data() + view_detail::Offset<L>(COL_MIN, ROW_MIN, LD), LD);
+    }
+
+    // -----------------------
+    // --- block operations ---
+    // -----------------------
+
+    /**
+    * \brief block update C = C - A * B, where every operand is either a matrix or a block view (no temporary is created).
+    *        C must not overlap A or B, and all operands must share the same layout.
+    *
+    * @param {MatrixBase/BlockView, in|out} C (COLxROW)
+    * @param {MatrixBase/BlockView, in}     A (DIMxROW)
+    * @param {MatrixBase/BlockView, in}     B (COLxDIM)
+    **/
+    template<typename T, std::size_t COL, std::size_t ROW, std::size_t DIM, Layout L,
+             template<typename, std::size_t, std::size_t, Layout> class C_, template<typename, std::size_t, std::size_t, Layout> class A_, template<typename, std::size_t, std::size_t, Layout> class B_,
+             typename TA, typename TB,
+             REQUIRE(std::is_same_v<std::remove_const_t<TA>, T> && std::is_same_v<std::remove_const_t<TB>, T>)>
+    void SubtractProduct(C_<T, COL, ROW, L>&& xio_c, const A_<TA, DIM, ROW, L>& xi_a, const B_<TB, COL, DIM, L>& xi_b) noexcept {
+        if constexpr (L == Layout::ColumnMajor) {
+            kernels::GemmSubtract(ROW, COL, DIM,
+                                  static_cast<const T*>(view_detail::Data(xi_a)), view_detail::LeadingDimension(xi_a),
+                                  static_cast<const T*>(view_detail::Data(xi_b)), view_detail::LeadingDimension(xi_b),
+                                  view_detail::Data(xio_c), view_detail::LeadingDimension(xio_c));
+        }
+        else {
+            // row major storage of A is the column major storage of transpose(A), and transpose(C - A * B) = transpose(C) - transpose(B) * transpose(A)
+            kernels::GemmSubtract(COL, ROW, DIM,
+                                  static_cast<const T*>(view_detail::Data(xi_b)), view_detail::LeadingDimension(xi_b),
+                                  static_cast<const T*>(view_detail::Data(xi_a)), view_detail::LeadingDimension(xi_a),
+                                  view_detail::Data(xio_c), view_detail::LeadingDimension(xio_c));
+        }
+    }
+    template<typename T, std::size_t COL, std::size_t ROW, std::size_t DIM, Layout L,
+             template<typename, std::size_t, std::size_t, Layout> class C_, template<typename, std::size_t, std::size_t, Layout> class A_, template<typename, std::size_t, std::size_t, Layout> class B_,
+             typename TA, typename TB,
+             REQUIRE(std::is_same_v<std::remove_const_t<TA>, T> && std::is_same_v<std::remove_const_t<TB>, T>)>
+    void SubtractProduct(C_<T, COL, ROW, L>& xio_c, const A_<TA, DIM, ROW, L>& xi_a, const B_<TB, COL, DIM, L>& xi_b) noexcept {
+        SubtractProduct(std::move(xio_c), xi_a, xi_b);
+    }
+
+}; // namespace GLSLCPP
@@ -0,0 +1,524 @@
+/**
+* GLSL++
+*
+* procedural noise (value, gradient, simplex and worley).
+* lattice points are hashed with integer arithmetic instead of permutation-table lookups,
+* so batched (structure of arrays) evaluation has no gathers and can be auto-vectorized.
+*
+* Dan Israel Malta
+**/
+#pragma once
+#include "common.h"
+#include "VectorBase.h"
+#include "Vector2.h"
+#include "Vector3.h"
+#include "Vector4.h"
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace GLSLCPP {
+
+    /**
+    * internal noise kernels (operate on plain coordinate arrays)
+    **/
+    namespace noise_detail {
+
+        // lattice coordinates mixing constants (per dimension)
+        constexpr std::uint32_t Primes[4]{ 0x8da6b343u, 0xd8163841u, 0xcb1ab31fu, 0x165667b1u };
+
+        // integer avalanche hash (a 32bit "low bias" integer mixer)
+        constexpr inline std::uint32_t Hash(std::uint32_t x) noexcept {
+            x ^= x >> 16;
+            x *= 0x7feb352du;
+            x ^= x >> 15;
+            x *= 0x846ca68bu;
+            x ^= x >> 16;
+            return x;
+        }
+
+        // hash a lattice point
+        template<std::size_t N>
+        constexpr inline std::uint32_t HashLattice(const std::array<std::int32_t, N>& xi_cell) noexcept {
+            std::uint32_t h{};
+            for (std::size_t d{}; d < N; ++d) {
+                h ^= static_cast<std::uint32_t>(xi_cell[d]) * Primes[d];
+            }
+            return Hash(h);
+        }
+
+        // convert a hash to a floating point value in the region [0, 1)
+        template<typename T> constexpr inline T ToUnit(const std::uint32_t xi_hash) noexcept {
+            return static_cast<T>(xi_hash >> 8) * static_cast<T>(1.0 / 16777216.0);
+        }
+
+        // quintic interpolation curve (6*t^5 - 15*t^4 + 10*t^3)
+        template<typename T> constexpr inline T Fade(const T t) noexcept {
+            return t * t * t * (t * (t * static_cast<T>(6) - static_cast<T>(15)) + static_cast<T>(10));
+        }
+
+        // dot product between a hashed gradient and an offset vector.
+        // gradients are the (+-1, +-1, ...) diagonals, where for N >= 3 one hashed component is zeroed (cube edges).
+        template<typename T, std::size_t N>
+        constexpr inline T GradientDot(const std::uint32_t xi_hash, const std::array<T, N>& xi_offset) noexcept {
+            const std::size_t zero{ (N >= 3) ? ((xi_hash >> 8) % N) : N };
+            T xo_dot{};
+            for (std::size_t d{}; d < N; ++d) {
+                const T sign{ static_cast<T>(static_cast<std::int32_t>((xi_hash >> d) & 1u) * 2 - 1) },
+                        mask{ static_cast<T>(d != zero) };
+                xo_dot += sign * mask * xi_offset[d];
+            }
+            return xo_dot;
+        }
+
+        // split a coordinate to its integer cell and fractional part
+        template<typename T, std::size_t N>
+        constexpr inline void Split(const std::array<T, N>& xi_p, std::array<std::int32_t, N>& xo_cell, std::array<T, N>& xo_fraction) noexcept {
+            for (std::size_t d{}; d < N; ++d) {
+                const T fl{ std::floor(xi_p[d]) };
+                xo_cell[d] = static_cast<std::int32_t>(fl);
+                xo_fraction[d] = xi_p[d] - fl;
+            }
+        }
+
+        // value noise kernel, output in the region [-1, 1]
+        template<typename T, std::size_t N>
+        constexpr inline T Value(const std::array<T, N>& xi_p) noexcept {
+            std::array<std::int32_t, N> cell{};
+            std::array<T, N> f{}, u{};
+            Split(xi_p, cell, f);
+            for (std::size_t d{}; d < N; ++d) {
+                u[d] = Fade(f[d]);
+            }
+
+            T xo_noise{};
+            for (std::size_t c{}; c < (std::size_t{ 1 } << N); ++c) {
+                std::array<std::int32_t, N> corner{};
+                T weight{ static_cast<T>(1) };
+                for (std::size_t d{}; d < N; ++d) {
+                    const std::int32_t bit{ static_cast<std::int32_t>((c >> d) & 1u) };
+                    corner[d] = cell[d] + bit;
+                    weight *= bit ? u[d] : (static_cast<T>(1) - u[d]);
+                }
+                xo_noise += weight * (static_cast<T>(2) * ToUnit<T>(HashLattice(corner)) - static_cast<T>(1));
+            }
+
+            return xo_noise;
+        }
+
+        // gradient ("perlin") noise kernel, output approximately in the region [-1, 1]
+        template<typename T, std::size_t N>
+        constexpr inline T Gradient(const std::array<T, N>& xi_p) noexcept {
+            std::array<std::int32_t, N> cell{};
+            std::array<T, N> f{}, u{};
+            Split(xi_p, cell, f);
+            for (std::size_t d{}; d < N; ++d) {
+                u[d] = Fade(f[d]);
+            }
+
+            T xo_noise{};
+            for (std::size_t c{}; c < (std::size_t{ 1 } << N); ++c) {
+                std::array<std::int32_t, N> corner{};
+                std::array<T, N> offset{};
+                T weight{ static_cast<T>(1) };
+                for (std::size_t d{}; d < N; ++d) {
+                    const std::int32_t bit{ static_cast<std::int32_t>((c >> d) & 1u) };
+                    corner[d] = cell[d] + bit;
+                    offset[d] = f[d] - static_cast<T>(bit);
+                    weight *= bit ? u[d] : (static_cast<T>(1) - u[d]);
+                }
+                xo_noise += weight * GradientDot(HashLattice(corner), offset);
+            }
+
+            return xo_noise;
+        }
+
+        // simplex corner contribution
+        template<typename T, std::size_t N>
+        constexpr inline T SimplexCorner(const std::array<std::int32_t, N>& xi_cell, const std::array<T, N>& xi_offset, const T xi_radius) noexcept {
+            T t{ xi_radius };
+            for (std::size_t d{}; d < N; ++d) {
+                t -= xi_offset[d] * xi_offset[d];
+            }
+            t = (t > T{}) ? t : T{};
+            t *= t;
+            return t * t * GradientDot(HashLattice(xi_cell), xi_offset);
+        }
+
+        // 2D simplex noise kernel, output approximately in the region [-1, 1]
+        template<typename T>
+        constexpr inline T Simplex(const std::array<T, 2>& xi_p) noexcept {
+            const T F2{ static_cast<T>(0.36602540378443864676) },   // (sqrt(3) - 1) / 2
+                    G2{ static_cast<T>(0.21132486540518711775) };   // (3 - sqrt(3)) / 6
+
+            // skew to simplex cell
+            const T s{ (xi_p[0] + xi_p[1]) * F2 },
+                    i{ std::floor(xi_p[0] + s) },
+                    j{ std::floor(xi_p[1] + s) },
+                    t{ (i + j) * G2 };
+            const std::array<T, 2> p0{ xi_p[0] - (i - t), xi_p[1] - (j - t) };
+
+            // simplex (triangle) we are in
+            const std::int32_t i1{ p0[0] > p0[1] ? 1 : 0 },
+                               j1{ 1 - i1 };
+            const std::array<T, 2> p1{ p0[0] - static_cast<T>(i1) + G2, p0[1] - static_cast<T>(j1) + G2 },
+                                   p2{ p0[0] - static_cast<T>(1) + static_cast<T>(2) * G2, p0[1] - static_cast<T>(1) + static_cast<T>(2) * G2 };
+            const std::int32_t ii{ static_cast<std::int32_t>(i) },
+                               jj{ static_cast<std::int32_t>(j) };
+
+            const T radius{ static_cast<T>(0.5) };
+            return static_cast<T>(70) * (SimplexCorner<T, 2>({ ii,      jj      }, p0, radius) +
+                                         SimplexCorner<T, 2>({ ii + i1, jj + j1 }, p1, radius) +
+                                         SimplexCorner<T, 2>({ ii + 1,  jj + 1  }, p2, radius));
+        }
+
+        // 3D simplex noise kernel, output approximately in the region [-1, 1]
+        template<typename T>
+        constexpr inline T Simplex(const std::array<T, 3>& xi_p) noexcept {
+            const T F3{ static_cast<T>(1.0 / 3.0) },
+                    G3{ static_cast<T>(1.0 / 6.0) };
+
+            // skew to simplex cell
+            const T s{ (xi_p[0] + xi_p[1] + xi_p[2]) * F3 },
+                    i{ std::floor(xi_p[0] + s) },
+                    j{ std::floor(xi_p[1] + s) },
+                    k{ std::floor(xi_p[2] + s) },
+                    t{ (i + j + k) * G3 };
+            const std::array<T, 3> p0{ xi_p[0] - (i - t), xi_p[1] - (j - t), xi_p[2] - (k - t) };
+
+            // simplex (tetrahedron) we are in - rank the offset components (branch free)
+            const std::int32_t xy{ p0[0] >= p0[1] ? 1 : 0 },
+                               yz{ p0[1] >= p0[2] ? 1 : 0 },
+                               xz{ p0[0] >= p0[2] ? 1 : 0 },
+                               i1{ xy & xz },
+                               j1{ (1 - xy) & yz },
+                               k1{ (1 - xz) & (1 - yz) },
+                               i2{ xy | xz },
+                               j2{ (1 - xy) | yz },
+                               k2{ (1 - xz) | (1 - yz) };
+
+            const std::array<T, 3> p1{ p0[0] - static_cast<T>(i1) + G3,
+                                       p0[1] - static_cast<T>(j1) + G3,
+                                       p0[2] - static_cast<T>(k1) + G3 },
+                                   p2{ p0[0] - static_cast<T>(i2) + static_cast<T>(2) * G3,
+                                       p0[1] - static_cast<T>(j2) + static_cast<T>(2) * G3,
+                                       p0[2] - static_cast<T>(k2) + static_cast<T>(2) * G3 },
+                                   p3{ p0[0] - static_cast<T>(1) + static_cast<T>(3) * G3,
+                                       p0[1] - static_cast<T>(1) + static_cast<T>(3) * G3,
+                                       p0[2] - static_cast<T>(1) + static_cast<T>(3) * G3 };
+            const std::int32_t ii{ static_cast<std::int32_t>(i) },
+                               jj{ static_cast<std::int32_t>(j) },
+                               kk{ static_cast<std::int32_t>(k) };
+
+            const T radius{ static_cast<T>(0.6) };
+            return static_cast<T>(32) * (SimplexCorner<T, 3>({ ii,      jj,      kk      }, p0, radius) +
+                                         SimplexCorner<T, 3>({ ii + i1, jj + j1, kk + k1 }, p1, radius) +
+                                         SimplexCorner<T, 3>({ ii + i2, jj + j2, kk + k2 }, p2, radius) +
+                                         SimplexCorner<T, 3>({ ii + 1,  jj + 1,  kk + 1  }, p3, radius));
+        }
+
+        // 4D simplex noise kernel, output approximately in the region [-1, 1]
+        template<typename T>
+        constexpr inline T Simplex(const std::array<T, 4>& xi_p) noexcept {
+            const T F4{ static_cast<T>(0.30901699437494742410) },   // (sqrt(5) - 1) / 4
+                    G4{ static_cast<T>(0.13819660112501051518) };   // (5 - sqrt(5)) / 20
+
+            // skew to simplex cell
+            const T s{ (xi_p[0] + xi_p[1] + xi_p[2] + xi_p[3]) * F4 };
+            std::array<T, 4> cell{}, p0{};
+            T t{};
+            for (std::size_t d{}; d < 4; ++d) {
+                cell[d] = std::floor(xi_p[d] + s);
+                t += cell[d];
+            }
+            t *= G4;
+            for (std::size_t d{}; d < 4; ++d) {
+                p0[d] = xi_p[d] - (cell[d] - t);
+            }
+
+            // simplex (pentachoron) we are in - rank of every offset component (ties are broken by index, branch free)
+            std::array<std::int32_t, 4> rank{};
+            for (std::size_t a{}; a < 4; ++a) {
+                for (std::size_t b{ a + 1 }; b < 4; ++b) {
+                    const std::int32_t greater{ p0[a] >= p0[b] ? 1 : 0 };
+                    rank[a] += greater;
+                    rank[b] += 1 - greater;
+                }
+            }
+
+            // corner 'c' (c = 1, 2, 3) steps along the components whose rank is at least 4 - c, the last corner steps along all of them
+            std::array<std::int32_t, 4> base{};
+            for (std::size_t d{}; d < 4; ++d) {
+                base[d] = static_cast<std::int32_t>(cell[d]);
+            }
+            const T radius{ static_cast<T>(0.6) };
+            T xo_noise{ SimplexCorner<T, 4>(base, p0, radius) };
+            for (std::int32_t c{ 1 }; c <= 4; ++c) {
+                std::array<std::int32_t, 4> corner{};
+                std::array<T, 4> offset{};
+                for (std::size_t d{}; d < 4; ++d) {
+                    const std::int32_t step{ rank[d] >= 4 - c ? 1 : 0 };
+                    corner[d] = base[d] + step;
+                    offset[d] = p0[d] - static_cast<T>(step) + static_cast<T>(c) * G4;
+                }
+                xo_noise += SimplexCorner<T, 4>(corner, offset, radius);
+            }
+
+            return static_cast<T>(27) * xo_noise;
+        }
+
+        // worley ("cellular") noise kernel, returns the distance to the closest feature point (F1)
+        template<typename T, std::size_t N>
+        constexpr inline T Worley(const std::array<T, N>& xi_p) noexcept {
+            constexpr std::size_t neighbours{ (N == 2) ? 9 : ((N == 3) ? 27 : 81) };
+            std::array<std::int32_t, N> cell{};
+            std::array<T, N> f{};
+            Split(xi_p, cell, f);
+
+            T minDistance{ std::numeric_limits<T>::max() };
+            for (std::size_t c{}; c < neighbours; ++c) {
+                std::array<std::int32_t, N> neighbour{};
+                std::array<T, N> offset{};
+                std::size_t index{ c };
+                for (std::size_t d{}; d < N; ++d) {
+                    offset[d] = static_cast<T>(static_cast<std::int32_t>(index % 3) - 1);
+                    neighbour[d] = cell[d] + static_cast<std::int32_t>(offset[d]);
+                    index /= 3;
+                }
+
+                // feature point within neighbouring cell
+                const std::uint32_t h{ HashLattice(neighbour) };
+                T distance{};
+                for (std::size_t d{}; d < N; ++d) {
+                    const T delta{ offset[d] + ToUnit<T>(Hash(h + static_cast<std::uint32_t>(d) * 0x9e3779b9u)) - f[d] };
+                    distance += delta * delta;
+                }
+
+                minDistance = (distance < minDistance) ? distance : minDistance;
+            }
+
+            return std::sqrt(minDistance);
+        }
+
+        // convert a vector to a coordinate array
+        template<typename T>
+        constexpr inline std::array<underlying_type_t<T>, Length_v<T>> ToCoordinates(const T& xi_p) noexcept {
+            std::array<underlying_type_t<T>, Length_v<T>> xo_p{};
+            for (std::size_t d{}; d < Length_v<T>; ++d) {
+                xo_p[d] = xi_p[d];
+            }
+            return xo_p;
+        }
+
+        // apply a noise kernel on a batch of coordinates given in structure-of-arrays form
+        template<typename T, std::size_t N, class Fn>
+        inline void Batch(const std::array<const T*, N>& xi_coordinates, T* xo_noise, const std::size_t xi_count, Fn&& xi_kernel) noexcept {
+            for (std::size_t i{}; i < xi_count; ++i) {
+                std::array<T, N> p{};
+                for (std::size_t d{}; d < N; ++d) {
+                    p[d] = xi_coordinates[d][i];
+                }
+                xo_noise[i] = xi_kernel(p);
+            }
+        }
+    };
+
+    // type trait to test if an object is a floating point vector which can be used as noise coordinate
+    template<typename T> struct is_NoiseCoordinate {
+        static constexpr bool value{ is_Vector_v<T> && (Length_v<T> >= 2) && (Length_v<T> <= 4) };
+    };
+    template<typename T> inline constexpr bool is_NoiseCoordinate_v = is_NoiseCoordinate<T>::value;
+
+    // --------------------------
+    // --- noise (per sample) ---
+    // --------------------------
+
+    /**
+    * \brief return value noise (interpolated hashed lattice values) at a given coordinate
+    *
+    * @param {Vector, in}  coordinate (2, 3 or 4 elements)
+    * @param {T,      out} noise value in the region [-1, 1]
+    **/
+    template<typename T, REQUIRE(is_NoiseCoordinate_v<T>)>
+    constexpr inline underlying_type_t<T> ValueNoise(const T& xi_p) noexcept {
+        static_assert(std::is_floating_point_v<underlying_type_t<T>>, "ValueNoise - coordinate must be of floating point type.");
+        return noise_detail::Value(noise_detail::ToCoordinates(xi_p));
+    }
+
+    /**
+    * \brief return gradient ("perlin") noise at a given coordinate
+    *
+    * @param {Vector, in}  coordinate (2, 3 or 4 elements)
+    * @param {T,      out} noise value (approximately in the region [-1, 1], zero on lattice points)
+    **/
+    template<typename T, REQUIRE(is_NoiseCoordinate_v<T>)>
+    constexpr inline underlying_type_t<T> GradientNoise(const T& xi_p) noexcept {
+        static_assert(std::is_floating_point_v<underlying_type_t<T>>, "GradientNoise - coordinate must be of floating point type.");
+        return noise_detail::Gradient(noise_detail::ToCoordinates(xi_p));
+    }
+
+    /**
+    * \brief return simplex noise at a given coordinate
+    *
+    * @param {Vector, in}  coordinate (2, 3 or 4 elements)
+    * @param {T,      out} noise value (approximately in the region [-1, 1])
+    **/
+    template<typename T, REQUIRE(is_NoiseCoordinate_v<T>)>
+    constexpr inline underlying_type_t<T> SimplexNoise(const T& xi_p) noexcept {
+        static_assert(std::is_floating_point_v<underlying_type_t<T>>, "SimplexNoise - coordinate must be of floating point type.");
+        return noise_detail::Simplex(noise_detail::ToCoordinates(xi_p));
+    }
+
+    /**
+    * \brief return worley ("cellular") noise at a given coordinate, i.e. - the distance to the closest feature point
+    *
+    * @param {Vector, in}  coordinate (2, 3 or 4 elements)
+    * @param {T,      out} distance to closest feature point
+    **/
+    template<typename T, REQUIRE(is_NoiseCoordinate_v<T>)>
+    constexpr inline underlying_type_t<T> WorleyNoise(const T& xi_p) noexcept {
+        static_assert(std::is_floating_point_v<underlying_type_t<T>>, "WorleyNoise - coordinate must be of floating point type.");
+        return noise_detail::Worley(noise_detail::ToCoordinates(xi_p));
+    }
+
+    /**
+    * \brief GLSL style noise functions: return a 1/2/3/4 elements noise value at a given coordinate.
+    *        each component is gradient noise sampled at a decorrelated offset of the coordinate.
+    *
+    * @param {Vector,   in}  coordinate (2, 3 or 4 elements)
+    * @param {T/Vector, out} noise value(s)
+    **/
+    template<typename T, REQUIRE(is_NoiseCoordinate_v<T>)>
+    constexpr inline underlying_type_t<T> noise1(const T& xi_p) noexcept {
+        return GradientNoise(xi_p);
+    }
+
+    template<typename T, REQUIRE(is_NoiseCoordinate_v<T>)>
+    constexpr inline Vector2<underlying_type_t<T>> noise2(const T& xi_p) noexcept {
+        using _T = underlying_type_t<T>;
+        auto p = noise_detail::ToCoordinates(xi_p);
+        const _T n0{ noise_detail::Gradient(p) };
+        for (auto& c : p) c += static_cast<_T>(19.19);
+        return Vector2<_T>(n0, noise_detail::Gradient(p));
+    }
+
+    template<typename T, REQUIRE(is_NoiseCoordinate_v<T>)>
+    constexpr inline Vector3<underlying_type_t<T>> noise3(const T& xi_p) noexcept {
+        using _T = underlying_type_t<T>;
+        auto p = noise_detail::ToCoordinates(xi_p);
+        const _T n0{ noise_detail::Gradient(p) };
+        for (auto& c : p) c += static_cast<_T>(19.19);
+        const _T n1{ noise_detail::Gradient(p) };
+        for (auto& c : p) c += static_cast<_T>(23.71);
+        return Vector3<_T>(n0, n1, noise_detail::Gradient(p));
+    }
+
+    template<typename T, REQUIRE(is_NoiseCoordinate_v<T>)>
+    constexpr inline Vector4<underlying_type_t<T>> noise4(const T& xi_p) noexcept {
+        using _T = underlying_type_t<T>;
+        auto p = noise_detail::ToCoordinates(xi_p);
+        const _T n0{ noise_detail::Gradient(p) };
+        for (auto& c : p) c += static_cast<_T>(19.19);
+        const _T n1{ noise_detail::Gradient(p) };
+        for (auto& c : p) c += static_cast<_T>(23.71);
+        const _T n2{ noise_detail::Gradient(p) };
+        for (auto& c : p) c += static_cast<_T>(31.37);
+        return Vector4<_T>(n0, n1, n2, noise_detail::Gradient(p));
+    }
+
+    /**
+    * \brief fractional brownian motion - sum several octaves of a given noise function
+    *
+    * @param {Vector,   in}  coordinate
+    * @param {size_t,   in}  number of octaves
+    * @param {function, in}  noise function (accepts a coordinate and return a scalar), if not given - gradient noise is used
+    * @param {T,        in}  lacunarity - frequency multiplier between octaves (default 2)
+    * @param {T,        in}  gain - amplitude multiplier between octaves (default 0.5)
+    * @param {T,        out} fbm value
+    **/
+    template<typename T, class Fn, REQUIRE(is_NoiseCoordinate_v<T> && std::is_invocable_v<Fn&, const T&>)>
+    constexpr underlying_type_t<T> fbm(const T& xi_p, const std::size_t xi_octaves, Fn&& xi_noise,
+                                       const underlying_type_t<T> xi_lacunarity = static_cast<underlying_type_t<T>>(2),
+                                       const underlying_type_t<T> xi_gain = static_cast<underlying_type_t<T>>(0.5)) {
+        using _T = underlying_type_t<T>;
+
+        T p(xi_p);
+        _T amplitude{ static_cast<_T>(1) },
+           xo_sum{};
+        for (std::size_t i{}; i < xi_octaves; ++i) {
+            xo_sum += amplitude * xi_noise(p);
+            for (std::size_t d{}; d < Length_v<T>; ++d) {
+                p[d] *= xi_lacunarity;
+            }
+            amplitude *= xi_gain;
+        }
+
+        return xo_sum;
+    }
+
+    template<typename T, REQUIRE(is_NoiseCoordinate_v<T>)>
+    constexpr underlying_type_t<T> fbm(const T& xi_p, const std::size_t xi_octaves,
+                                       const underlying_type_t<T> xi_lacunarity = static_cast<underlying_type_t<T>>(2),
+                                       const underlying_type_t<T> xi_gain = static_cast<underlying_type_t<T>>(0.5)) {
+        return fbm(xi_p, xi_octaves, [](const T& p) { return GradientNoise(p); }, xi_lacunarity, xi_gain);
+    }
+
+    // ------------------------------------------------
+    // --- noise (batched, structure of arrays form) ---
+    // ------------------------------------------------
+
+    /**
+    * \brief evaluate noise on a batch of coordinates given as structure of arrays,
+    *        i.e. - coordinate #i is {xi_coordinates[0][i], xi_coordinates[1][i], ...}.
+    *
+    * @param {array<T*, N>, in}  pointers to N coordinate streams (N = 2, 3 or 4)
+    * @param {T*,           out} noise values (must hold 'xi_count' elements)
+    * @param {size_t,       in}  number of coordinates
+    **/
+    template<typename T, std::size_t N, REQUIRE(std::is_floating_point_v<T> && (N >= 2) && (N <= 4))>
+    inline void ValueNoise(const std::array<const T*, N>& xi_coordinates, T* xo_noise, const std::size_t xi_count) noexcept {
+        noise_detail::Batch(xi_coordinates, xo_noise, xi_count, [](const std::array<T, N>& p) { return noise_detail::Value(p); });
+    }
+
+    template<typename T, std::size_t N, REQUIRE(std::is_floating_point_v<T> && (N >= 2) && (N <= 4))>
+    inline void GradientNoise(const std::array<const T*, N>& xi_coordinates, T* xo_noise, const std::size_t xi_count) noexcept {
+        noise_detail::Batch(xi_coordinates, xo_noise, xi_count, [](const std::array<T, N>& p) { return noise_detail::Gradient(p); });
+    }
+
+    template<typename T, std::size_t N, REQUIRE(std::is_floating_point_v<T> && (N >= 2) && (N <= 4))>
+    inline void SimplexNoise(const std::array<const T*, N>& xi_coordinates, T* xo_noise, const std::size_t xi_count) noexcept {
+        noise_detail::Batch(xi_coordinates, xo_noise, xi_count, [](const std::array<T, N>& p) { return noise_detail::Simplex(p); });
+    }
+
+    template<typename T, std::size_t N, REQUIRE(std::is_floating_point_v<T> && (N >= 2) && (N <= 4))>
+    inline void WorleyNoise(const std::array<const T*, N>& xi_coordinates, T* xo_noise, const std::size_t xi_count) noexcept {
+        noise_detail::Batch(xi_coordinates, xo_noise, xi_count, [](const std::array<T, N>& p) { return noise_detail::Worley(p); });
+    }
+
+    /**
+    * \brief fractional brownian motion (of gradient noise) on a batch of coordinates given as structure of arrays.
+    *
+    * @param {array<T*, N>, in}  pointers to N coordinate streams (N = 2, 3 or 4)
+    * @param {T*,           out} fbm values (must hold 'xi_count' elements)
+    * @param {size_t,       in}  number of coordinates
+    * @param {size_t,       in}  number of octaves
+    * @param {T,            in}  lacunarity - frequency multiplier between octaves (default 2)
+    * @param {T,            in}  gain - amplitude multiplier between octaves (default 0.5)
+    **/
+    template<typename T, std::size_t N, REQUIRE(std::is_floating_point_v<T> && (N >= 2) && (N <= 4))>
+    inline void fbm(const std::array<const T*, N>& xi_coordinates, T* xo_noise, const std::size_t xi_count, const std::size_t xi_octaves,
+                    const T xi_lacunarity = static_cast<T>(2), const T xi_gain = static_cast<T>(0.5)) noexcept {
+        noise_detail::Batch(xi_coordinates, xo_noise, xi_count, [xi_octaves, xi_lacunarity, xi_gain](std::array<T, N> p) {
+            T amplitude{ static_cast<T>(1) },
+              sum{};
+            for (std::size_t i{}; i < xi_octaves; ++i) {
+                sum += amplitude * noise_detail::Gradient(p);
+                for (auto& c : p) c *= xi_lacunarity;
+                amplitude *= xi_gain;
+            }
+            return sum;
+        });
+    }
+
+}; // namespace GLSLCPP
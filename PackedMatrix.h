@@ -0,0 +1,606 @@
+/**
+* GLSL++
+*
+* cubic matrices whose meaningful elements are in one triangle (symmetric and triangular matrices),
+* stored in packed format, i.e. - only the N * (N + 1) / 2 elements of one triangle are held, column after column.
+*
+* Dan Israel Malta
+**/
+#pragma once
+#include "common.h"
+#include "VectorBase.h"
+#include "MatrixBase.h"
+#include "MatrixOperations.h"
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <array>
+
+namespace GLSLCPP {
+
+    // triangular portion of a matrix
+    enum class Triangle : std::uint8_t {
+        Lower = 0,    // elements on and below the diagonal
+        Upper = 1     // elements on and above the diagonal
+    };
+
+    namespace packed_detail {
+
+        // number of elements in a packed triangle of a cubic matrix of dimension N
+        template<std::size_t N> constexpr std::size_t PackedLength{ N * (N + 1) / 2 };
+
+        // packed index of element ('col', 'row'); lower triangle requires row >= col, upper triangle requires row <= col
+        template<std::size_t N, Triangle TRI>
+        constexpr std::size_t Index(const std::size_t col, const std::size_t row) noexcept {
+            if constexpr (TRI == Triangle::Lower) {
+                return col * N - (col * (col + 1)) / 2 + row;
+            }
+            else {
+                return (col * (col + 1)) / 2 + row;
+            }
+        }
+    };
+
+    /**
+    * \brief symmetric cubic matrix (A = A^T) whose lower triangle is stored in packed format.
+    *
+    * @param {T, in} underlying type
+    * @param {N, in} matrix dimension
+    **/
+    template<typename T, std::size_t N> class SymmetricMatrix {
+        static_assert(std::is_arithmetic<T>::value, "SymmetricMatrix<T,N> - T must be of numerical type.");
+        static_assert(N > 1, "SymmetricMatrix<T,N> - N must be larger than 1.");
+
+        // properties
+    public:
+        VectorBase<T, packed_detail::PackedLength<N>> m_data;    // lower triangle, column after column
+
+        // constructors
+    public:
+
+        // identity matrix
+        constexpr SymmetricMatrix() noexcept : m_data(T{}) {
+            for (std::size_t i{}; i < N; ++i) {
+                (*this)(i, i) = static_cast<T>(1);
+            }
+        }
+
+        // all elements are set to a given value
+        explicit constexpr SymmetricMatrix(const T xi_value) noexcept : m_data(xi_value) {}
+
+        // construct from the lower triangle of a dense matrix (upper triangle is not accessed)
+        explicit constexpr SymmetricMatrix(const MatrixBase<T, N, N>& xi_matrix) noexcept {
+            for (std::size_t c{}; c < N; ++c) {
+                for (std::size_t r{ c }; r < N; ++r) {
+                    (*this)(c, r) = xi_matrix(c, r);
+                }
+            }
+        }
+
+        SymmetricMatrix(const SymmetricMatrix&) noexcept = default;
+        SymmetricMatrix(SymmetricMatrix&&) noexcept = default;
+        SymmetricMatrix& operator=(const SymmetricMatrix&) noexcept = default;
+        SymmetricMatrix& operator=(SymmetricMatrix&&) noexcept = default;
+
+        // element access and queries
+    public:
+
+        // '(col, row)' element access (both (i, j) and (j, i) refer to the same element)
+        constexpr T& operator()(const std::size_t col, const std::size_t row) {
+            assert((col < N) && (row < N) && " trying to access a non existent element.");
+            return (row >= col) ? m_data[packed_detail::Index<N, Triangle::Lower>(col, row)] : m_data[packed_detail::Index<N, Triangle::Lower>(row, col)];
+        }
+        constexpr T operator()(const std::size_t col, const std::size_t row) const {
+            assert((col < N) && (row < N) && " trying to access a non existent element.");
+            return (row >= col) ? m_data[packed_detail::Index<N, Triangle::Lower>(col, row)] : m_data[packed_detail::Index<N, Triangle::Lower>(row, col)];
+        }
+
+        constexpr std::size_t length() const noexcept { return (N * N); }
+
+        // dense copy
+        constexpr MatrixBase<T, N, N> dense() const noexcept {
+            MatrixBase<T, N, N> xo_mat(T{});
+            for (std::size_t c{}; c < N; ++c) {
+                for (std::size_t r{ c }; r < N; ++r) {
+                    xo_mat(c, r) = xo_mat(r, c) = (*this)(c, r);
+                }
+            }
+            return xo_mat;
+        }
+
+        // compound operators
+    public:
+
+        constexpr SymmetricMatrix& operator+=(const SymmetricMatrix& xi_matrix) { m_data += xi_matrix.m_data; return *this; }
+        constexpr SymmetricMatrix& operator-=(const SymmetricMatrix& xi_matrix) { m_data -= xi_matrix.m_data; return *this; }
+        constexpr SymmetricMatrix& operator*=(const T xi_value) { m_data *= xi_value; return *this; }
+        constexpr SymmetricMatrix& operator/=(const T xi_value) { m_data /= xi_value; return *this; }
+    };
+
+    /**
+    * \brief triangular cubic matrix whose non zero triangle is stored in packed format.
+    *
+    * @param {T,   in} underlying type
+    * @param {N,   in} matrix dimension
+    * @param {TRI, in} non zero triangle (Triangle::Lower or Triangle::Upper)
+    **/
+    template<typename T, std::size_t N, Triangle TRI> class TriangularMatrix {
+        static_assert(std::is_arithmetic<T>::value, "TriangularMatrix<T,N,TRI> - T must be of numerical type.");
+        static_assert(N > 1, "TriangularMatrix<T,N,TRI> - N must be larger than 1.");
+
+        // properties
+    public:
+        VectorBase<T, packed_detail::PackedLength<N>> m_data;    // non zero triangle, column after column
+
+        // constructors
+    public:
+
+        // identity matrix
+        constexpr TriangularMatrix() noexcept : m_data(T{}) {
+            for (std::size_t i{}; i < N; ++i) {
+                (*this)(i, i) = static_cast<T>(1);
+            }
+        }
+
+        // construct from the relevant triangle of a dense matrix (other triangle is not accessed)
+        explicit constexpr TriangularMatrix(const MatrixBase<T, N, N>& xi_matrix) noexcept {
+            for (std::size_t c{}; c < N; ++c) {
+                for (std::size_t r{ RowBegin(c) }; r < RowEnd(c); ++r) {
+                    (*this)(c, r) = xi_matrix(c, r);
+                }
+            }
+        }
+
+        TriangularMatrix(const TriangularMatrix&) noexcept = default;
+        TriangularMatrix(TriangularMatrix&&) noexcept = default;
+        TriangularMatrix& operator=(const TriangularMatrix&) noexcept = default;
+        TriangularMatrix& operator=(TriangularMatrix&&) noexcept = default;
+
+        // element access and queries
+    public:
+
+        // '(col, row)' element access (only elements in the non zero triangle can be written)
+        constexpr T& operator()(const std::size_t col, const std::size_t row) {
+            assert((col < N) && (row < N) && " trying to access a non existent element.");
+            assert(InTriangle(col, row) && " trying to write an element outside the triangle.");
+            return m_data[packed_detail::Index<N, TRI>(col, row)];
+        }
+        constexpr T operator()(const std::size_t col, const std::size_t row) const {
+            assert((col < N) && (row < N) && " trying to access a non existent element.");
+            return InTriangle(col, row) ? m_data[packed_detail::Index<N, TRI>(col, row)] : T{};
+        }
+
+        constexpr std::size_t length() const noexcept { return (N * N); }
+
+        // first and one past last row of the non zero portion of a given column
+        static constexpr std::size_t RowBegin(const std::size_t col) noexcept { return (TRI == Triangle::Lower) ? col : 0; }
+        static constexpr std::size_t RowEnd(const std::size_t col) noexcept { return (TRI == Triangle::Lower) ? N : col + 1; }
+
+        // dense copy
+        constexpr MatrixBase<T, N, N> dense() const noexcept {
+            MatrixBase<T, N, N> xo_mat(T{});
+            for (std::size_t c{}; c < N; ++c) {
+                for (std::size_t r{ RowBegin(c) }; r < RowEnd(c); ++r) {
+                    xo_mat(c, r) = (*this)(c, r);
+                }
+            }
+            return xo_mat;
+        }
+
+        // compound operators
+    public:
+
+        constexpr TriangularMatrix& operator+=(const TriangularMatrix& xi_matrix) { m_data += xi_matrix.m_data; return *this; }
+        constexpr TriangularMatrix& operator-=(const TriangularMatrix& xi_matrix) { m_data -= xi_matrix.m_data; return *this; }
+        constexpr TriangularMatrix& operator*=(const T xi_value) { m_data *= xi_value; return *this; }
+        constexpr TriangularMatrix& operator/=(const T xi_value) { m_data /= xi_value; return *this; }
+
+        // internal helpers
+    private:
+
+        static constexpr bool InTriangle(const std::size_t col, const std::size_t row) noexcept {
+            return (TRI == Triangle::Lower) ? (row >= col) : (row <= col);
+        }
+    };
+
+    // type trait to test if an object is a symmetric matrix
+    template<typename>                  struct is_SymmetricMatrix : public std::false_type {};
+    template<typename T, std::size_t N> struct is_SymmetricMatrix<SymmetricMatrix<T, N>> : public std::true_type {};
+    template<typename T> inline constexpr bool is_SymmetricMatrix_v = is_SymmetricMatrix<T>::value;
+
+    // type trait to test if an object is a triangular matrix
+    template<typename>                                struct is_TriangularMatrix : public std::false_type {};
+    template<typename T, std::size_t N, Triangle TRI> struct is_TriangularMatrix<TriangularMatrix<T, N, TRI>> : public std::true_type {};
+    template<typename T> inline constexpr bool is_TriangularMatrix_v = is_TriangularMatrix<T>::value;
+
+    // ---------------------------
+    // --- numerical operators ---
+    // ---------------------------
+
+    /**
+    * \brief symmetric matrix - vector multiplication (every stored element is read once)
+    *
+    * @param {SymmetricMatrix, in}  A
+    * @param {Vector,          in}  x (column vector)
+    * @param {VectorBase,      out} A * x
+    **/
+    template<typename T, std::size_t N, typename V, REQUIRE(Is_VectorOfLength_v<V, N>)>
+    constexpr VectorBase<T, N> operator*(const SymmetricMatrix<T, N>& xi_matrix, const V& xi_vector) noexcept {
+        VectorBase<T, N> xo_vec(T{});
+        const T* a{ xi_matrix.m_data.m_data.data() };
+
+        // every stored column contributes to the output below the diagonal (as a column, i.e. - "axpy") and on
+        // the diagonal (as a row, i.e. - dot product), both in the same pass over the column.
+        // small matrices are unrolled at compile time, since their columns are too short for loops.
+        if constexpr (N <= 16) {
+            static_for<0, N>([&](auto c) {
+                constexpr std::size_t C{ decltype(c)::value };
+                const T xc{ static_cast<T>(xi_vector[C]) };
+                T dot{ a[packed_detail::Index<N, Triangle::Lower>(C, C)] * xc };
+                static_for<C + 1, N>([&](auto r) {
+                    constexpr std::size_t R{ decltype(r)::value };
+                    const T acr{ a[packed_detail::Index<N, Triangle::Lower>(C, R)] };
+                    xo_vec[R] += acr * xc;
+                    dot += acr * static_cast<T>(xi_vector[R]);
+                });
+                xo_vec[C] += dot;
+            });
+        }
+        else {
+            for (std::size_t c{}; c < N; ++c) {
+                const std::size_t length{ N - c };
+                const T xc{ static_cast<T>(xi_vector[c]) };
+                T dot{ a[0] * xc };
+                for (std::size_t r{ 1 }; r < length; ++r) {
+                    xo_vec[c + r] += a[r] * xc;
+                    dot += a[r] * static_cast<T>(xi_vector[c + r]);
+                }
+                xo_vec[c] += dot;
+                a += length;
+            }
+        }
+        return xo_vec;
+    }
+
+    /**
+    * \brief triangular matrix - vector multiplication
+    *
+    * @param {TriangularMatrix, in}  A
+    * @param {Vector,           in}  x (column vector)
+    * @param {VectorBase,       out} A * x
+    **/
+    template<typename T, std::size_t N, Triangle TRI, typename V, REQUIRE(Is_VectorOfLength_v<V, N>)>
+    constexpr VectorBase<T, N> operator*(const TriangularMatrix<T, N, TRI>& xi_matrix, const V& xi_vector) noexcept {
+        using tri = TriangularMatrix<T, N, TRI>;
+        VectorBase<T, N> xo_vec(T{});
+        const T* a{ xi_matrix.m_data.m_data.data() };
+        for (std::size_t c{}; c < N; ++c) {
+            const T xc{ static_cast<T>(xi_vector[c]) };
+            const std::size_t first{ tri::RowBegin(c) },
+                              last{ tri::RowEnd(c) };
+            for (std::size_t r{ first }; r < last; ++r) {
+                xo_vec[r] += a[r - first] * xc;
+            }
+            a += last - first;
+        }
+        return xo_vec;
+    }
+
+    /**
+    * \brief symmetric/triangular matrix - matrix multiplication
+    *
+    * @param {SymmetricMatrix/TriangularMatrix, in}  A
+    * @param {MatrixBase,                       in}  B
+    * @param {MatrixBase,                       out} A * B
+    **/
+    template<typename M, typename T, std::size_t K, std::size_t N, REQUIRE((is_SymmetricMatrix_v<M> || is_TriangularMatrix_v<M>) &&
+                                                                           std::is_same_v<underlying_type_t<decltype(std::declval<M>().m_data)>, T>)>
+    constexpr MatrixBase<T, K, N> operator*(const M& xi_lhs, const MatrixBase<T, K, N>& xi_rhs) noexcept {
+        MatrixBase<T, K, N> xo_mat(T{});
+        VectorBase<T, N> column;
+        for (std::size_t k{}; k < K; ++k) {
+            for (std::size_t i{}; i < N; ++i) {
+                column[i] = xi_rhs(k, i);
+            }
+            column = xi_lhs * column;
+            for (std::size_t i{}; i < N; ++i) {
+                xo_mat(k, i) = column[i];
+            }
+        }
+        return xo_mat;
+    }
+
+    // ---------------------------------
+    // --- triangular system solvers ---
+    // ---------------------------------
+
+    /**
+    * \brief solve A * x = b, where A is triangular (by forward/backward substitution)
+    *
+    * @param {TriangularMatrix, in}  A
+    * @param {Vector,           in}  b (column vector)
+    * @param {VectorBase,       out} x (column vector)
+    **/
+    template<typename T, std::size_t N, Triangle TRI, typename V, REQUIRE(Is_VectorOfLength_v<V, N>)>
+    constexpr VectorBase<T, N> Solve(const TriangularMatrix<T, N, TRI>& xi_A, const V& xi_b) noexcept {
+        VectorBase<T, N> x;
+        for (std::size_t i{}; i < N; ++i) {
+            x[i] = static_cast<T>(xi_b[i]);
+        }
+
+        const T* a{ xi_A.m_data.m_data.data() };
+        if constexpr (TRI == Triangle::Lower) {
+            // column after column: x(k) is final once divided by diagonal, then eliminated from rows below it
+            for (std::size_t k{}; k < N; ++k) {
+                x[k] /= a[0];
+                const T xk{ x[k] };
+                for (std::size_t i{ k + 1 }; i < N; ++i) {
+                    x[i] -= a[i - k] * xk;
+                }
+                a += N - k;
+            }
+        }
+        else {
+            // last column first: x(k) is final once divided by diagonal, then eliminated from rows above it
+            for (std::size_t k{ N }; k-- > 0;) {
+                const T* ak{ a + packed_detail::Index<N, Triangle::Upper>(k, 0) };
+                x[k] /= ak[k];
+                const T xk{ x[k] };
+                for (std::size_t i{}; i < k; ++i) {
+                    x[i] -= ak[i] * xk;
+                }
+            }
+        }
+
+        return x;
+    }
+
+    /**
+    * \brief solve A^T * x = b, where A is triangular
+    *
+    * @param {TriangularMatrix, in}  A
+    * @param {Vector,           in}  b (column vector)
+    * @param {VectorBase,       out} x (column vector)
+    **/
+    template<typename T, std::size_t N, Triangle TRI, typename V, REQUIRE(Is_VectorOfLength_v<V, N>)>
+    constexpr VectorBase<T, N> SolveTransposed(const TriangularMatrix<T, N, TRI>& xi_A, const V& xi_b) noexcept {
+        VectorBase<T, N> x;
+        for (std::size_t i{}; i < N; ++i) {
+            x[i] = static_cast<T>(xi_b[i]);
+        }
+
+        // columns of A are rows of A^T, so every unknown is a dot product with a (contiguous) column
+        const T* a{ xi_A.m_data.m_data.data() };
+        if constexpr (TRI == Triangle::Lower) {
+            for (std::size_t k{ N }; k-- > 0;) {
+                const T* ak{ a + packed_detail::Index<N, Triangle::Lower>(k, 0) };
+                T sum{ x[k] };
+                for (std::size_t i{ k + 1 }; i < N; ++i) {
+                    sum -= ak[i] * x[i];
+                }
+                x[k] = sum / ak[k];
+            }
+        }
+        else {
+            for (std::size_t k{}; k < N; ++k) {
+                T sum{ x[k] };
+                for (std::size_t i{}; i < k; ++i) {
+                    sum -= a[i] * x[i];
+                }
+                x[k] = sum / a[k];
+                a += k + 1;
+            }
+        }
+
+        return x;
+    }
+
+    /**
+    * \brief solve A * X = B (or A^T * X = B), where A is triangular
+    *
+    * @param {TriangularMatrix, in}  A
+    * @param {MatrixBase,       in}  B (every column is a right hand side)
+    * @param {MatrixBase,       out} X (every column is a solution)
+    **/
+    template<typename T, std::size_t N, Triangle TRI, std::size_t K>
+    constexpr MatrixBase<T, K, N> Solve(const TriangularMatrix<T, N, TRI>& xi_A, const MatrixBase<T, K, N>& xi_B) noexcept {
+        MatrixBase<T, K, N> xo_X(T{});
+        for (std::size_t k{}; k < K; ++k) {
+            xo_X[k] = Solve(xi_A, xi_B[k]);
+        }
+        return xo_X;
+    }
+    template<typename T, std::size_t N, Triangle TRI, std::size_t K>
+    constexpr MatrixBase<T, K, N> SolveTransposed(const TriangularMatrix<T, N, TRI>& xi_A, const MatrixBase<T, K, N>& xi_B) noexcept {
+        MatrixBase<T, K, N> xo_X(T{});
+        for (std::size_t k{}; k < K; ++k) {
+            xo_X[k] = SolveTransposed(xi_A, xi_B[k]);
+        }
+        return xo_X;
+    }
+
+    // ----------------------------------------------
+    // --- symmetric matrix decompositions/solver ---
+    // ----------------------------------------------
+
+    // a symmetric matrix is symmetric...
+    template<typename T, std::size_t N>
+    constexpr bool IsSymmetric(const SymmetricMatrix<T, N>&) noexcept {
+        return true;
+    }
+
+    /**
+    * \brief given symmetric and positive definite matrix, return a lower triangular matrix 'L' such that L * L' = matrix.
+    *        (packed storage is updated column after column, every column is accessed contiguously;
+    *         matrices up to 16x16 are unrolled at compile time, since their columns are too short for loops,
+    *         and every one of their columns is calculated once from the previous columns (left looking))
+    *
+    * @param {SymmetricMatrix,  in}  matrix
+    * @param {TriangularMatrix, out} L (lower triangular)
+    **/
+    template<typename T, std::size_t N>
+    constexpr TriangularMatrix<T, N, Triangle::Lower> Cholesky(const SymmetricMatrix<T, N>& xi_matrix) noexcept {
+        TriangularMatrix<T, N, Triangle::Lower> xo_lower;
+        xo_lower.m_data = xi_matrix.m_data;
+        T* l{ &xo_lower.m_data[0] };
+
+        if constexpr (N <= 16) {
+            // left looking variant, every column is calculated once from the previous (final) columns
+            bool singular{ false };
+            static_for<0, N>([l, &singular](auto j) {
+                constexpr std::size_t J{ decltype(j)::value },
+                                      COLUMN_J{ packed_detail::Index<N, Triangle::Lower>(J, 0) };
+
+                // column j (on and below diagonal) of A minus contribution of previous columns
+                static_for<0, J>([l](auto k) {
+                    constexpr std::size_t COLUMN_K{ packed_detail::Index<N, Triangle::Lower>(decltype(k)::value, 0) };
+                    const T ljk{ l[COLUMN_K + J] };
+                    static_for<J, N>([l, ljk](auto r) { l[COLUMN_J + decltype(r)::value] -= l[COLUMN_K + decltype(r)::value] * ljk; });
+                });
+
+                // diagonal and column below it
+                const T d{ l[COLUMN_J + J] };
+                l[COLUMN_J + J] = (d > T{}) ? std::sqrt(d) : T{};
+                singular |= (l[COLUMN_J + J] == T{});
+                const T inv{ (l[COLUMN_J + J] == T{}) ? T{} : static_cast<T>(1) / l[COLUMN_J + J] };
+                static_for<J + 1, N>([l, inv](auto i) { l[COLUMN_J + decltype(i)::value] *= inv; });
+            });
+            if (!singular) return xo_lower;
+
+            // zero pivot (matrix is not positive definite) - start over with the general variant, which skips such columns
+            xo_lower.m_data = xi_matrix.m_data;
+        }
+
+        for (std::size_t j{}; j < N; ++j) {
+            T* lj{ l + packed_detail::Index<N, Triangle::Lower>(j, 0) };
+
+            // diagonal
+            const T d{ lj[j] };
+            lj[j] = (d > T{}) ? std::sqrt(d) : T{};
+            if (lj[j] == T{}) continue;
+
+            // column below diagonal
+            const T inv{ static_cast<T>(1) / lj[j] };
+            for (std::size_t i{ j + 1 }; i < N; ++i) {
+                lj[i] *= inv;
+            }
+
+            // symmetric rank one update of the trailing lower triangle
+            for (std::size_t c{ j + 1 }; c < N; ++c) {
+                T* lc{ l + packed_detail::Index<N, Triangle::Lower>(c, 0) };
+                const T ljc{ lj[c] };
+                for (std::size_t r{ c }; r < N; ++r) {
+                    lc[r] -= lj[r] * ljc;
+                }
+            }
+        }
+
+        return xo_lower;
+    }
+
+    /**
+    * \brief solve linear system A*x=b (A must be symmetric and positive definite) using Cholesky decomposition
+    *
+    * @param {SymmetricMatrix, in}  A
+    * @param {Vector,          in}  b (column vector)
+    * @param {VectorBase,      out} x (column vector)
+    **/
+    template<typename T, std::size_t N, typename V, REQUIRE(Is_VectorOfLength_v<V, N>)>
+    constexpr VectorBase<T, N> SolveCubicCholesky(const SymmetricMatrix<T, N>& xi_A, const V& xi_b) noexcept {
+        const TriangularMatrix<T, N, Triangle::Lower> L{ Cholesky(xi_A) };
+        return SolveTransposed(L, Solve(L, xi_b));
+    }
+
+    /**
+    * \brief given a symmetric matrix, return its eigenvalues (sorted from big to small) and eigenvectors using cyclic Jacobi rotations
+    *
+    * @param {SymmetricMatrix, in}  matrix
+    * @param {VectorBase,      out} eigenvalues
+    * @param {MatrixBase,      out} matrix whose columns are the normalized eigenvectors
+    * @param {bool,            out} true if algorithm converged, false otherwise
+    **/
+    template<typename T, std::size_t N>
+    bool EigenSolverSymmetric(const SymmetricMatrix<T, N>& xi_matrix, VectorBase<T, N>& xo_values, MatrixBase<T, N, N>& xo_vectors) noexcept {
+        constexpr std::size_t MAX_SWEEPS{ 50 };
+        constexpr T EPS{ std::numeric_limits<T>::epsilon() };
+
+        SymmetricMatrix<T, N> a(xi_matrix);
+        MatrixBase<T, N, N> v;
+
+        bool converged{ false };
+        for (std::size_t sweep{}; sweep <= MAX_SWEEPS; ++sweep) {
+            // convergence test (off diagonal norm relative to diagonal norm)
+            T off{},
+              diag{};
+            for (std::size_t c{}; c < N; ++c) {
+                diag += a(c, c) * a(c, c);
+                for (std::size_t r{ c + 1 }; r < N; ++r) {
+                    off += a(c, r) * a(c, r);
+                }
+            }
+            if (off <= EPS * EPS * diag) {
+                converged = true;
+                break;
+            }
+            if (sweep == MAX_SWEEPS) break;
+
+            for (std::size_t p{}; p < N - 1; ++p) {
+                for (std::size_t q{ p + 1 }; q < N; ++q) {
+                    const T apq{ a(p, q) };
+                    if (std::abs(apq) <= std::numeric_limits<T>::min()) continue;
+
+                    // rotation annihilating element (p, q)
+                    const T theta{ (a(q, q) - a(p, p)) / (static_cast<T>(2) * apq) },
+                            t{ (theta >= T{} ? static_cast<T>(1) : static_cast<T>(-1)) / (std::abs(theta) + std::sqrt(theta * theta + static_cast<T>(1))) },
+                            c{ static_cast<T>(1) / std::sqrt(t * t + static_cast<T>(1)) },
+                            s{ t * c };
+
+                    for (std::size_t k{}; k < N; ++k) {
+                        if ((k == p) || (k == q)) continue;
+                        const T akp{ a(k, p) },
+                                akq{ a(k, q) };
+                        a(k, p) = c * akp - s * akq;
+                        a(k, q) = s * akp + c * akq;
+                    }
+                    a(p, p) -= t * apq;
+                    a(q, q) += t * apq;
+                    a(p, q) = T{};
+
+                    for (std::size_t k{}; k < N; ++k) {
+                        const T vkp{ v(p, k) },
+                                vkq{ v(q, k) };
+                        v(p, k) = c * vkp - s * vkq;
+                        v(q, k) = s * vkp + c * vkq;
+                    }
+                }
+            }
+        }
+
+        // sort from big to small
+        std::array<std::size_t, N> order;
+        for (std::size_t i{}; i < N; ++i) order[i] = i;
+        std::sort(order.begin(), order.end(), [&a](const std::size_t i, const std::size_t j) { return a(i, i) > a(j, j); });
+
+        for (std::size_t i{}; i < N; ++i) {
+            xo_values[i] = a(order[i], order[i]);
+            for (std::size_t k{}; k < N; ++k) {
+                xo_vectors(i, k) = v(order[i], k);
+            }
+        }
+
+        return converged;
+    }
+
+    // 3x3 symmetric matrix eigen solver (see 'EigenSolverSymmetric3x3' in MatrixOperations.h)
+    template<typename T, typename U, REQUIRE(is_Vector<U>::value && (Length_v<U> == 3))>
+    constexpr void EigenSolverSymmetric3x3(const SymmetricMatrix<T, 3>& xi_mat, U& xo_values, MatrixBase<T, 3, 3>& xo_vectors) noexcept {
+        EigenSolverSymmetric3x3(xi_mat.dense(), xo_values, xo_vectors);
+    }
+
+    // 2x2 symmetric matrix singular value decomposition (see 'SVDsymmetric2x2' in MatrixOperations.h)
+    template<typename T, typename U, REQUIRE(is_Vector<U>::value && (Length_v<U> == 2))>
+    constexpr void SVDsymmetric2x2(const SymmetricMatrix<T, 2>& xi_mat, MatrixBase<T, 2, 2>& xo_U, U& xo_W) noexcept {
+        SVDsymmetric2x2(xi_mat.dense(), xo_U, xo_W);
+    }
+
+}; // namespace GLSLCPP
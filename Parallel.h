@@ -0,0 +1,172 @@
+/**
+* GLSL++
+*
+* minimal fork-join thread pool used by the library parallel kernels.
+*
+* Dan Israel Malta
+**/
+#pragma once
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <vector>
+#include <algorithm>
+
+namespace GLSLCPP {
+
+    /**
+    * \brief persistent pool of worker threads executing indexed tasks in a fork-join manner.
+    *        the calling thread participates in the work and 'Run' returns only once all tasks were executed.
+    *        calls to 'Run' from within a task are executed serially (no nested parallelism).
+    **/
+    class ThreadPool {
+
+        // properties
+    private:
+        std::vector<std::thread> m_workers;
+        std::mutex m_mutex,                                  // guards task state
+                   m_runMutex;                               // serializes concurrent 'Run' calls
+        std::condition_variable m_wake,
+                                m_done;
+        const std::function<void(std::size_t)>* m_task{ nullptr };
+        std::size_t m_count{},                               // number of tasks in current run
+                    m_next{},                                // next task to be executed
+                    m_completed{};                           // number of completed tasks
+        bool m_stop{ false };
+
+        // true while the current thread is executing a task
+        static bool& InsideTask() noexcept {
+            thread_local bool inside{ false };
+            return inside;
+        }
+
+        // constructors
+    public:
+
+        explicit ThreadPool(const std::size_t xi_workers) {
+            m_workers.reserve(xi_workers);
+            for (std::size_t i{}; i < xi_workers; ++i) {
+                m_workers.emplace_back([this]() { WorkerLoop(); });
+            }
+        }
+
+        ~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_wake.notify_all();
+            for (auto& worker : m_workers) {
+                worker.join();
+            }
+        }
+
+        ThreadPool(const ThreadPool&)            = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        // library wide pool (one worker per hardware thread, besides the caller)
+        static ThreadPool& Instance() {
+            static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+            return pool;
+        }
+
+        // number of threads participating in a run (workers + caller)
+        std::size_t Size() const noexcept { return m_workers.size() + 1; }
+
+        // methods
+    public:
+
+        /**
+        * \brief execute 'xi_task(i)' for i = 0...xi_count-1, return when all tasks are done
+        *
+        * @param {size_t,   in} number of tasks
+        * @param {function, in} task (accepts task index)
+        **/
+        void Run(const std::size_t xi_count, const std::function<void(std::size_t)>& xi_task) {
+            if ((xi_count <= 1) || m_workers.empty() || InsideTask()) {
+                for (std::size_t i{}; i < xi_count; ++i) {
+                    xi_task(i);
+                }
+                return;
+            }
+
+            std::lock_guard<std::mutex> run(m_runMutex);
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_task = &xi_task;
+            m_count = xi_count;
+            m_next = 0;
+            m_completed = 0;
+            m_wake.notify_all();
+
+            // participate
+            while (m_next < m_count) {
+                Execute(lock);
+            }
+            m_done.wait(lock, [this]() { return m_completed == m_count; });
+
+            m_task = nullptr;
+            m_count = 0;
+            m_next = 0;
+        }
+
+        // internal helpers
+    private:
+
+        // execute next task (lock is held on entry and on exit)
+        void Execute(std::unique_lock<std::mutex>& xio_lock) {
+            const std::size_t index{ m_next++ };
+            const std::function<void(std::size_t)>* task{ m_task };
+            xio_lock.unlock();
+
+            InsideTask() = true;
+            (*task)(index);
+            InsideTask() = false;
+
+            xio_lock.lock();
+            if (++m_completed == m_count) {
+                m_done.notify_all();
+            }
+        }
+
+        void WorkerLoop() {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            for (;;) {
+                m_wake.wait(lock, [this]() { return m_stop || (m_next < m_count); });
+                if (m_stop) return;
+                Execute(lock);
+            }
+        }
+    };
+
+    /**
+    * \brief execute 'xi_function(first, last)' over consecutive chunks of the region [0, xi_count) using the library thread pool.
+    *
+    * @param {size_t,   in} number of elements
+    * @param {size_t,   in} minimal number of elements in a chunk
+    * @param {function, in} function operating on region [first, last)
+    **/
+    template<class Fn>
+    void ParallelFor(const std::size_t xi_count, const std::size_t xi_grain, Fn&& xi_function) {
+        if (xi_count == 0) return;
+
+        ThreadPool& pool{ ThreadPool::Instance() };
+        const std::size_t grain{ std::max<std::size_t>(xi_grain, 1) },
+                          chunks{ std::min(pool.Size(), (xi_count + grain - 1) / grain) },
+                          chunk{ (xi_count + chunks - 1) / chunks };
+
+        if (chunks <= 1) {
+            xi_function(std::size_t{}, xi_count);
+            return;
+        }
+
+        pool.Run(chunks, [&](const std::size_t i) {
+            const std::size_t first{ i * chunk },
+                              last{ std::min(first + chunk, xi_count) };
+            if (first < last) {
+                xi_function(first, last);
+            }
+        });
+    }
+
+}; // namespace GLSLCPP
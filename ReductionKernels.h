@@ -0,0 +1,377 @@
+/**
+* GLSL++
+*
+* accurate reduction kernels (sum, dot product and product) operating on contiguous raw storage.
+* all kernels accumulate in several independent lanes (so they are vectorized) which are combined at the end.
+*
+* compensated kernels rely on error free transformations, they must not be compiled with value unsafe
+* floating point optimizations (i.e. - '/fp:fast' or '-ffast-math'), which are allowed to remove them.
+*
+* Dan Israel Malta
+**/
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <array>
+#include <limits>
+#include <type_traits>
+
+// true when fused multiply add is a single instruction on the target
+#if defined(FP_FAST_FMA) || defined(__FMA__)
+#define GLSLCPP_HARDWARE_FMA 1
+#else
+#define GLSLCPP_HARDWARE_FMA 0
+#endif
+
+namespace GLSLCPP {
+
+    // summation algorithm of reductions ('sum', 'dot' and 'prod')
+    enum class Summation : std::uint8_t {
+        Naive       = 0,    // left to right accumulation (error bound grows linearly with collection length)
+        Pairwise    = 1,    // tree accumulation of blocks (error bound grows logarithmically with collection length)
+        Compensated = 2     // accumulation with error free transformations (Neumaier sum, 'Dot2', compensated product),
+                            // result is as accurate as if it was accumulated in twice the working precision
+    };
+
+    namespace kernels {
+
+        namespace reduction_detail {
+
+            // number of independent accumulators (several SIMD registers worth, a lane loop this long
+            // is vectorized as a loop instead of being completely unrolled into scalar code)
+            constexpr std::size_t LANES{ 32 };
+
+            // length below which pairwise reduction accumulates directly
+            constexpr std::size_t PAIRWISE_BLOCK{ 256 };
+
+            // number of accumulators of an unrolled dot product of length N (one below 8 elements, two below 16, four below 32, eight otherwise)
+            template<std::size_t N>
+            constexpr std::size_t DOT_ACCUMULATORS{ N < 8 ? 1 : (N < 16 ? 2 : (N < 32 ? 4 : 8)) };
+
+            // combine lanes pairwise (number of lanes is a power of two)
+            template<typename T, std::size_t L, class Fn>
+            constexpr T Combine(std::array<T, L>& xio_lanes, Fn&& xi_function) noexcept {
+                for (std::size_t width{ L / 2 }; width > 0; width /= 2) {
+                    for (std::size_t k{}; k < width; ++k) {
+                        xio_lanes[k] = xi_function(xio_lanes[k], xio_lanes[k + width]);
+                    }
+                }
+                return xio_lanes[0];
+            }
+
+            // a * b + c, fused when the target has a fused multiply add instruction (otherwise 'std::fma' is emulated)
+            template<typename T>
+            inline T MultiplyAdd(const T a, const T b, const T c) noexcept {
+                if constexpr (std::is_floating_point_v<T> && (GLSLCPP_HARDWARE_FMA == 1)) {
+                    return std::fma(a, b, c);
+                } else {
+                    return a * b + c;
+                }
+            }
+
+            // Veltkamp splitting factor (2^ceil(digits / 2) + 1), splits a value into two halves whose products are exact
+            template<typename T>
+            constexpr T SPLITTER{ static_cast<T>((std::uint64_t{ 1 } << ((std::numeric_limits<T>::digits + 1) / 2)) + 1) };
+
+            // Veltkamp split, i.e. - a = high + low, where both halves have at most half the significand bits
+            template<typename T>
+            constexpr void Split(const T a, T& high, T& low) noexcept {
+                const T c{ SPLITTER<T> * a };
+                high = c - (c - a);
+                low = a - high;
+            }
+        };
+
+        /**
+        * \brief error free transformation of a sum, i.e. - a + b = s + e exactly, where s = fl(a + b)
+        *
+        * @param {T, in}  a
+        * @param {T, in}  b
+        * @param {T, out} s (rounded sum)
+        * @param {T, out} e (rounding error)
+        **/
+        template<typename T>
+        constexpr void TwoSum(const T a, const T b, T& s, T& e) noexcept {
+            s = a + b;
+            const T z{ s - a };
+            e = (a - (s - z)) + (b - z);
+        }
+
+        /**
+        * \brief error free transformation of a product, i.e. - a * b = p + e exactly, where p = fl(a * b).
+        *        uses fused multiply add when the target has it as an instruction, otherwise Dekker's product
+        *        (a library 'std::fma' is an order of magnitude slower than the 17 flops of Dekker's product).
+        *        without hardware fused multiply add, the magnitude of the operands must be below sqrt(max) / splitter.
+        *
+        * @param {T, in}  a
+        * @param {T, in}  b
+        * @param {T, out} p (rounded product)
+        * @param {T, out} e (rounding error)
+        **/
+        template<typename T>
+        inline void TwoProduct(const T a, const T b, T& p, T& e) noexcept {
+            p = a * b;
+            if constexpr (GLSLCPP_HARDWARE_FMA == 1) {
+                e = std::fma(a, b, -p);
+            } else {
+                T ah, al, bh, bl;
+                reduction_detail::Split(a, ah, al);
+                reduction_detail::Split(b, bh, bl);
+                e = ((ah * bh - p) + ah * bl + al * bh) + al * bl;
+            }
+        }
+
+        /**
+        * \brief pairwise sum, i.e. - x[0] + ... + x[n-1]
+        *
+        * @param {T*,     in}  x
+        * @param {size_t, in}  number of elements
+        * @param {T,      out} sum
+        **/
+        template<typename T>
+        T SumPairwise(const T* x, const std::size_t n) noexcept {
+            using namespace reduction_detail;
+
+            if (n > PAIRWISE_BLOCK) {
+                const std::size_t half{ (n / 2) / LANES * LANES };
+                return SumPairwise(x, half) + SumPairwise(x + half, n - half);
+            }
+
+            std::array<T, LANES> lanes{};
+            std::size_t i{};
+            for (; i + LANES <= n; i += LANES) {
+                for (std::size_t k{}; k < LANES; ++k) {
+                    lanes[k] += x[i + k];
+                }
+            }
+            T tail{};
+            for (; i < n; ++i) {
+                tail += x[i];
+            }
+
+            return Combine(lanes, [](const T a, const T b) { return a + b; }) + tail;
+        }
+
+        /**
+        * \brief compensated (Neumaier) sum, i.e. - x[0] + ... + x[n-1]
+        *
+        * @param {T*,     in}  x
+        * @param {size_t, in}  number of elements
+        * @param {T,      out} sum
+        **/
+        template<typename T>
+        T SumCompensated(const T* x, const std::size_t n) noexcept {
+            using namespace reduction_detail;
+
+            std::array<T, LANES> sums{},
+                                 errors{};
+            std::size_t i{};
+            for (; i + LANES <= n; i += LANES) {
+                for (std::size_t k{}; k < LANES; ++k) {
+                    T e;
+                    TwoSum(sums[k], x[i + k], sums[k], e);
+                    errors[k] += e;
+                }
+            }
+
+            T sum{ sums[0] },
+              error{ errors[0] };
+            for (std::size_t k{ 1 }; k < LANES; ++k) {
+                T e;
+                TwoSum(sum, sums[k], sum, e);
+                error += e + errors[k];
+            }
+            for (; i < n; ++i) {
+                T e;
+                TwoSum(sum, x[i], sum, e);
+                error += e;
+            }
+
+            return sum + error;
+        }
+
+        /**
+        * \brief pairwise dot product, i.e. - x[0] * y[0] + ... + x[n-1] * y[n-1]
+        *
+        * @param {T*,     in}  x
+        * @param {T*,     in}  y
+        * @param {size_t, in}  number of elements
+        * @param {T,      out} dot product
+        **/
+        template<typename T>
+        T DotPairwise(const T* x, const T* y, const std::size_t n) noexcept {
+            using namespace reduction_detail;
+
+            if (n > PAIRWISE_BLOCK) {
+                const std::size_t half{ (n / 2) / LANES * LANES };
+                return DotPairwise(x, y, half) + DotPairwise(x + half, y + half, n - half);
+            }
+
+            std::array<T, LANES> lanes{};
+            std::size_t i{};
+            for (; i + LANES <= n; i += LANES) {
+                for (std::size_t k{}; k < LANES; ++k) {
+                    lanes[k] += x[i + k] * y[i + k];
+                }
+            }
+            T tail{};
+            for (; i < n; ++i) {
+                tail += x[i] * y[i];
+            }
+
+            return Combine(lanes, [](const T a, const T b) { return a + b; }) + tail;
+        }
+
+        /**
+        * \brief dot product of two, three or four operands of compile time length N, i.e. - x[0] * y[0] * ... + x[N-1] * y[N-1] * ...
+        *        accumulated (using fused multiply add) in several independent accumulators, whose number is set by N.
+        *
+        * @param {N,      in}  number of elements
+        * @param {T*,     in}  x
+        * @param {T*,     in}  y
+        * @param {T*,     in}  additional operands (up to two)
+        * @param {T,      out} dot product
+        **/
+        template<std::size_t N, typename T, typename... Ts>
+        T DotUnrolled(const T* x, const T* y, const Ts*... z) noexcept {
+            static_assert(sizeof...(Ts) <= 2, "DotUnrolled - up to four operands are supported.");
+            static_assert((std::is_same_v<T, Ts> && ...), "DotUnrolled - operands must have identical underlying type.");
+            using namespace reduction_detail;
+            constexpr std::size_t ACCUMULATORS{ DOT_ACCUMULATORS<N> };
+
+            constexpr std::size_t BODY{ N - N % ACCUMULATORS };
+
+            std::array<T, ACCUMULATORS> accumulators{};
+            for (std::size_t i{}; i < BODY; i += ACCUMULATORS) {
+                for (std::size_t k{}; k < ACCUMULATORS; ++k) {
+                    accumulators[k] = MultiplyAdd((x[i + k] * ... * z[i + k]), y[i + k], accumulators[k]);
+                }
+            }
+
+            // tail is bounded by the number of remaining elements (rather than N), so its trip count is known
+            T tail{};
+            for (std::size_t k{}; k < N % ACCUMULATORS; ++k) {
+                tail = MultiplyAdd((x[BODY + k] * ... * z[BODY + k]), y[BODY + k], tail);
+            }
+
+            return Combine(accumulators, [](const T a, const T b) { return a + b; }) + tail;
+        }
+
+        /**
+        * \brief compensated dot product ('Dot2' - Ogita, Rump & Oishi), i.e. - x[0] * y[0] + ... + x[n-1] * y[n-1]
+        *
+        * @param {T*,     in}  x
+        * @param {T*,     in}  y
+        * @param {size_t, in}  number of elements
+        * @param {T,      out} dot product
+        **/
+        template<typename T>
+        T DotCompensated(const T* x, const T* y, const std::size_t n) noexcept {
+            using namespace reduction_detail;
+
+            std::array<T, LANES> sums{},
+                                 errors{};
+            std::size_t i{};
+            for (; i + LANES <= n; i += LANES) {
+                for (std::size_t k{}; k < LANES; ++k) {
+                    T p, h, q;
+                    TwoProduct(x[i + k], y[i + k], p, h);
+                    TwoSum(sums[k], p, sums[k], q);
+                    errors[k] += h + q;
+                }
+            }
+
+            T sum{ sums[0] },
+              error{ errors[0] };
+            for (std::size_t k{ 1 }; k < LANES; ++k) {
+                T q;
+                TwoSum(sum, sums[k], sum, q);
+                error += q + errors[k];
+            }
+            for (; i < n; ++i) {
+                T p, h, q;
+                TwoProduct(x[i], y[i], p, h);
+                TwoSum(sum, p, sum, q);
+                error += h + q;
+            }
+
+            return sum + error;
+        }
+
+        /**
+        * \brief pairwise product, i.e. - x[0] * ... * x[n-1]
+        *
+        * @param {T*,     in}  x
+        * @param {size_t, in}  number of elements
+        * @param {T,      out} product
+        **/
+        template<typename T>
+        T ProductPairwise(const T* x, const std::size_t n) noexcept {
+            using namespace reduction_detail;
+
+            if (n > PAIRWISE_BLOCK) {
+                const std::size_t half{ (n / 2) / LANES * LANES };
+                return ProductPairwise(x, half) * ProductPairwise(x + half, n - half);
+            }
+
+            std::array<T, LANES> lanes;
+            lanes.fill(static_cast<T>(1));
+            std::size_t i{};
+            for (; i + LANES <= n; i += LANES) {
+                for (std::size_t k{}; k < LANES; ++k) {
+                    lanes[k] *= x[i + k];
+                }
+            }
+            T tail{ static_cast<T>(1) };
+            for (; i < n; ++i) {
+                tail *= x[i];
+            }
+
+            return Combine(lanes, [](const T a, const T b) { return a * b; }) * tail;
+        }
+
+        /**
+        * \brief compensated product (Graillat), i.e. - x[0] * ... * x[n-1]
+        *
+        * @param {T*,     in}  x
+        * @param {size_t, in}  number of elements
+        * @param {T,      out} product
+        **/
+        template<typename T>
+        T ProductCompensated(const T* x, const std::size_t n) noexcept {
+            using namespace reduction_detail;
+
+            std::array<T, LANES> products,
+                                 errors{};
+            products.fill(static_cast<T>(1));
+            std::size_t i{};
+            for (; i + LANES <= n; i += LANES) {
+                for (std::size_t k{}; k < LANES; ++k) {
+                    T e;
+                    TwoProduct(products[k], x[i + k], products[k], e);
+                    errors[k] = MultiplyAdd(errors[k], x[i + k], e);
+                }
+            }
+
+            // (P + E) * (p + e) = P * p + (P * e + E * p) + E * e
+            T product{ products[0] },
+              error{ errors[0] };
+            for (std::size_t k{ 1 }; k < LANES; ++k) {
+                T e;
+                const T previous{ product };
+                TwoProduct(previous, products[k], product, e);
+                error = e + previous * errors[k] + error * products[k];
+            }
+            for (; i < n; ++i) {
+                T e;
+                const T previous{ product };
+                TwoProduct(previous, x[i], product, e);
+                error = MultiplyAdd(error, x[i], e);
+            }
+
+            return product + error;
+        }
+    };
+
+}; // namespace GLSLCPP
@@ -0,0 +1,353 @@
+/**
+* GLSL++
+*
+* sparse matrices in compressed sparse row format, whose non zero entries are either scalars (CSR)
+* or cubic blocks (BSR, i.e. - 'mat3' blocks of a system whose unknowns are 'vec3'), along with
+* a multi threaded sparse matrix - vector multiplication and (preconditioned) conjugate gradient solvers.
+*
+* vectors are given as std::vector whose elements are scalars (CSR) or vectors whose length is the block dimension (BSR).
+*
+* Dan Israel Malta
+**/
+#pragma once
+#include "common.h"
+#include "VectorBase.h"
+#include "MatrixBase.h"
+#include "MatrixOperations.h"
+#include "Parallel.h"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace GLSLCPP {
+
+    namespace sparse_detail {
+
+        // block dimension (1 for scalar entries)
+        template<typename B, typename = void> struct BlockSize { static constexpr std::size_t value{ 1 }; };
+        template<typename B>                  struct BlockSize<B, std::enable_if_t<is_MatrixBase_v<B>>> { static constexpr std::size_t value{ Columns_v<B> }; };
+
+        // underlying scalar type of a block/vector
+        template<typename B, typename = void> struct Scalar { using type = B; };
+        template<typename B>                  struct Scalar<B, std::enable_if_t<!std::is_arithmetic_v<B>>> { using type = std::remove_const_t<underlying_type_t<B>>; };
+        template<typename B> using Scalar_t = typename Scalar<B>::type;
+
+        // zero block/vector (a cubic matrix is default constructed as identity)
+        template<typename B> constexpr B Zero() noexcept {
+            if constexpr (std::is_arithmetic_v<B>) return B{};
+            else                                   return B(Scalar_t<B>{});
+        }
+
+        // i'th element of a scalar/vector
+        template<typename V> constexpr decltype(auto) Element(V& xi_v, const std::size_t i) noexcept {
+            if constexpr (std::is_arithmetic_v<std::remove_const_t<V>>) { (void)i; return (xi_v); }
+            else                                                         return xi_v[i];
+        }
+
+        // y += A * x (scalar or block)
+        template<typename B, typename V>
+        constexpr void MultiplyAdd(const B& xi_block, const V& xi_x, V& xio_y) noexcept {
+            if constexpr (std::is_arithmetic_v<B>) {
+                xio_y += xi_block * xi_x;
+            }
+            else {
+                constexpr std::size_t K{ BlockSize<B>::value };
+                for (std::size_t c{}; c < K; ++c) {
+                    const Scalar_t<B> xc{ xi_x[c] };
+                    for (std::size_t r{}; r < K; ++r) {
+                        xio_y[r] += xi_block(c, r) * xc;
+                    }
+                }
+            }
+        }
+
+        // sum(x[i] * y[i])
+        template<typename T, typename V>
+        T Dot(const std::vector<V>& xi_x, const std::vector<V>& xi_y) noexcept {
+            constexpr std::size_t K{ std::is_arithmetic_v<V> ? 1 : Length_v<V> };
+            T xo_dot{};
+            for (std::size_t i{}; i < xi_x.size(); ++i) {
+                for (std::size_t k{}; k < K; ++k) {
+                    xo_dot += static_cast<T>(Element(xi_x[i], k)) * static_cast<T>(Element(xi_y[i], k));
+                }
+            }
+            return xo_dot;
+        }
+
+        // y = a * x + b * y
+        template<typename T, typename V>
+        void Axpby(const T xi_a, const std::vector<V>& xi_x, const T xi_b, std::vector<V>& xio_y) noexcept {
+            constexpr std::size_t K{ std::is_arithmetic_v<V> ? 1 : Length_v<V> };
+            for (std::size_t i{}; i < xi_x.size(); ++i) {
+                for (std::size_t k{}; k < K; ++k) {
+                    auto& y = Element(xio_y[i], k);
+                    y = xi_a * Element(xi_x[i], k) + xi_b * y;
+                }
+            }
+        }
+    };
+
+    /**
+    * \brief a non zero entry of a sparse matrix
+    *
+    * @param {B, in} entry type (scalar or cubic block)
+    **/
+    template<typename B> struct Triplet {
+        std::size_t row;       // row (block row) index
+        std::size_t column;    // column (block column) index
+        B value;               // value
+    };
+
+    /**
+    * \brief sparse matrix in compressed sparse row format.
+    *        non zero entries are either scalars (CSR) or cubic MatrixBase blocks (BSR).
+    *
+    * @param {B, in} entry type (scalar or cubic block)
+    **/
+    template<typename B> class SparseMatrix {
+        static_assert(std::is_arithmetic_v<B> || is_Cubic<B>::value, "SparseMatrix<B> - B must be either a scalar or a cubic matrix.");
+
+        // properties
+    private:
+        std::size_t m_rows{};                       // number of (block) rows
+        std::size_t m_columns{};                    // number of (block) columns
+        std::vector<std::size_t> m_rowStart;        // row 'i' entries are in [m_rowStart[i], m_rowStart[i + 1])
+        std::vector<std::size_t> m_columnIndex;     // column of every entry (ordered within a row)
+        std::vector<B> m_values;                    // value of every entry
+
+        // constructors
+    public:
+
+        /**
+        * \brief construct from a list of non zero entries (in any order). duplicate entries are summed.
+        *
+        * @param {size_t,              in} number of (block) rows
+        * @param {size_t,              in} number of (block) columns
+        * @param {std::vector<Triplet>, in} non zero entries
+        **/
+        SparseMatrix(const std::size_t xi_rows, const std::size_t xi_columns, std::vector<Triplet<B>> xi_entries) : m_rows(xi_rows), m_columns(xi_columns) {
+            std::sort(xi_entries.begin(), xi_entries.end(), [](const Triplet<B>& a, const Triplet<B>& b) {
+                return (a.row < b.row) || ((a.row == b.row) && (a.column < b.column));
+            });
+
+            m_rowStart.assign(m_rows + 1, 0);
+            m_columnIndex.reserve(xi_entries.size());
+            m_values.reserve(xi_entries.size());
+            for (std::size_t i{}; i < xi_entries.size(); ++i) {
+                const Triplet<B>& entry{ xi_entries[i] };
+                assert((entry.row < m_rows) && (entry.column < m_columns) && " SparseMatrix entry is out of bounds.");
+
+                // duplicate entries are adjacent (after sorting)
+                if ((i > 0) && (xi_entries[i - 1].row == entry.row) && (xi_entries[i - 1].column == entry.column)) {
+                    m_values.back() += entry.value;
+                    continue;
+                }
+
+                m_columnIndex.push_back(entry.column);
+                m_values.push_back(entry.value);
+                m_rowStart[entry.row + 1] = m_values.size();
+            }
+
+            // rows without entries start where the previous row ended
+            for (std::size_t i{ 1 }; i <= m_rows; ++i) {
+                m_rowStart[i] = std::max(m_rowStart[i], m_rowStart[i - 1]);
+            }
+        }
+
+        // accessors
+    public:
+
+        std::size_t rows() const noexcept { return m_rows; }
+        std::size_t columns() const noexcept { return m_columns; }
+        std::size_t nonZeros() const noexcept { return m_values.size(); }
+        const std::vector<std::size_t>& rowStart() const noexcept { return m_rowStart; }
+        const std::vector<std::size_t>& columnIndex() const noexcept { return m_columnIndex; }
+        const std::vector<B>& values() const noexcept { return m_values; }
+        std::vector<B>& values() noexcept { return m_values; }
+
+        // methods
+    public:
+
+        // (block) entry at a given position (zero if not stored)
+        B operator()(const std::size_t xi_row, const std::size_t xi_column) const noexcept {
+            assert((xi_row < m_rows) && (xi_column < m_columns) && " trying to access a non existent element.");
+            const auto first{ m_columnIndex.begin() + m_rowStart[xi_row] },
+                       last{ m_columnIndex.begin() + m_rowStart[xi_row + 1] };
+            const auto it{ std::lower_bound(first, last, xi_column) };
+            return ((it != last) && (*it == xi_column)) ? m_values[static_cast<std::size_t>(it - m_columnIndex.begin())] : sparse_detail::Zero<B>();
+        }
+
+        /**
+        * \brief y = A * x, rows are distributed among the library thread pool.
+        *
+        * @param {std::vector, in}  x (length equal to number of columns)
+        * @param {std::vector, out} y (length equal to number of rows)
+        **/
+        template<typename V>
+        void multiply(const std::vector<V>& xi_x, std::vector<V>& xo_y) const {
+            assert(xi_x.size() == m_columns && " SparseMatrix::multiply - x length must be equal to number of columns.");
+            assert(&xi_x != &xo_y && " SparseMatrix::multiply - x and y must not be the same vector.");
+            xo_y.resize(m_rows);
+
+            constexpr std::size_t GRAIN{ std::max<std::size_t>(1, 2048 / sparse_detail::BlockSize<B>::value) };
+            ParallelFor(m_rows, GRAIN, [this, &xi_x, &xo_y](const std::size_t first, const std::size_t last) {
+                for (std::size_t i{ first }; i < last; ++i) {
+                    V yi{ sparse_detail::Zero<V>() };
+
+                    for (std::size_t k{ m_rowStart[i] }; k < m_rowStart[i + 1]; ++k) {
+                        sparse_detail::MultiplyAdd(m_values[k], xi_x[m_columnIndex[k]], yi);
+                    }
+                    xo_y[i] = yi;
+                }
+            });
+        }
+
+        // diagonal (blocks)
+        std::vector<B> diagonal() const {
+            std::vector<B> xo_diag(std::min(m_rows, m_columns));
+            for (std::size_t i{}; i < xo_diag.size(); ++i) {
+                xo_diag[i] = (*this)(i, i);
+            }
+            return xo_diag;
+        }
+    };
+
+    /**
+    * \brief (block) Jacobi preconditioner, i.e. - z = inverse(diagonal(A)) * r
+    *
+    * @param {B, in} entry type (scalar or cubic block)
+    **/
+    template<typename B> class JacobiPreconditioner {
+
+        // properties
+    private:
+        std::vector<B> m_inverse;    // inverse of every diagonal (block)
+
+        // constructors
+    public:
+
+        explicit JacobiPreconditioner(const SparseMatrix<B>& xi_matrix) : m_inverse(xi_matrix.diagonal()) {
+            for (B& d : m_inverse) {
+                if constexpr (std::is_arithmetic_v<B>) d = static_cast<B>(1) / d;
+                else                                   d = Inv(d);
+            }
+        }
+
+        // methods
+    public:
+
+        // z = M^-1 * r
+        template<typename V>
+        void apply(const std::vector<V>& xi_r, std::vector<V>& xo_z) const {
+            xo_z.resize(xi_r.size());
+            for (std::size_t i{}; i < xi_r.size(); ++i) {
+                if constexpr (std::is_arithmetic_v<V>) {
+                    xo_z[i] = m_inverse[i] * xi_r[i];
+                }
+                else {
+                    xo_z[i] = sparse_detail::Zero<V>();
+                    sparse_detail::MultiplyAdd(m_inverse[i], xi_r[i], xo_z[i]);
+                }
+            }
+        }
+    };
+
+    // identity preconditioner (i.e. - plain conjugate gradient)
+    struct IdentityPreconditioner {
+        template<typename V>
+        void apply(const std::vector<V>& xi_r, std::vector<V>& xo_z) const {
+            xo_z = xi_r;
+        }
+    };
+
+    /**
+    * \brief outcome of an iterative solver
+    *
+    * @param {T, in} residual type
+    **/
+    template<typename T> struct IterativeSolution {
+        std::size_t iterations{};    // number of iterations performed
+        T residual{};                // final relative residual norm (||b - A * x|| / ||b||)
+        bool converged{ false };     // true if residual is below requested tolerance
+    };
+
+    /**
+    * \brief solve A * x = b using preconditioned conjugate gradient (A must be symmetric and positive definite).
+    *
+    * @param {SparseMatrix,      in}     A
+    * @param {std::vector,       in}     b
+    * @param {std::vector,       in/out} x (initial guess, overwritten by solution)
+    * @param {preconditioner,    in}     object with 'apply(r, z)' method which approximates z = A^-1 * r
+    * @param {T,                 in}     relative residual tolerance
+    * @param {size_t,            in}     maximal number of iterations
+    * @param {IterativeSolution, out}    number of iterations, final relative residual and convergence flag
+    **/
+    template<typename B, typename V, class P, REQUIRE(!std::is_arithmetic_v<P>)>
+    IterativeSolution<sparse_detail::Scalar_t<B>> ConjugateGradient(const SparseMatrix<B>& xi_A, const std::vector<V>& xi_b, std::vector<V>& xio_x, const P& xi_preconditioner,
+                                                                    const sparse_detail::Scalar_t<B> xi_tolerance = static_cast<sparse_detail::Scalar_t<B>>(1e-6),
+                                                                    const std::size_t xi_maxIterations = 1000) {
+        using namespace sparse_detail;
+        using T = Scalar_t<B>;
+        assert((xi_A.rows() == xi_A.columns()) && (xi_b.size() == xi_A.rows()) && " ConjugateGradient - dimensions mismatch.");
+        xio_x.resize(xi_b.size(), Zero<V>());
+
+        IterativeSolution<T> xo_solution;
+        const T normB{ std::sqrt(Dot<T>(xi_b, xi_b)) };
+        if (normB == T{}) {
+            std::fill(xio_x.begin(), xio_x.end(), Zero<V>());
+            xo_solution.converged = true;
+            return xo_solution;
+        }
+
+        // r = b - A * x
+        std::vector<V> r, z, p, Ap;
+        xi_A.multiply(xio_x, Ap);
+        r = xi_b;
+        Axpby(static_cast<T>(-1), Ap, static_cast<T>(1), r);
+
+        xi_preconditioner.apply(r, z);
+        p = z;
+        T rz{ Dot<T>(r, z) };
+
+        xo_solution.residual = std::sqrt(Dot<T>(r, r)) / normB;
+        while ((xo_solution.residual > xi_tolerance) && (xo_solution.iterations < xi_maxIterations)) {
+            xi_A.multiply(p, Ap);
+            const T pAp{ Dot<T>(p, Ap) };
+            if (!(pAp > T{})) break;
+
+            const T alpha{ rz / pAp };
+            Axpby(alpha, p, static_cast<T>(1), xio_x);
+            Axpby(-alpha, Ap, static_cast<T>(1), r);
+            ++xo_solution.iterations;
+
+            xo_solution.residual = std::sqrt(Dot<T>(r, r)) / normB;
+            if (xo_solution.residual <= xi_tolerance) break;
+
+            xi_preconditioner.apply(r, z);
+            const T rzNew{ Dot<T>(r, z) };
+            Axpby(static_cast<T>(1), z, rzNew / rz, p);
+            rz = rzNew;
+        }
+
+        xo_solution.converged = (xo_solution.residual <= xi_tolerance);
+        return xo_solution;
+    }
+
+    // solve A * x = b using conjugate gradient (no preconditioning)
+    template<typename B, typename V>
+    IterativeSolution<sparse_detail::Scalar_t<B>> ConjugateGradient(const SparseMatrix<B>& xi_A, const std::vector<V>& xi_b, std::vector<V>& xio_x,
+                                                                    const sparse_detail::Scalar_t<B> xi_tolerance = static_cast<sparse_detail::Scalar_t<B>>(1e-6),
+                                                                    const std::size_t xi_maxIterations = 1000) {
+        return ConjugateGradient(xi_A, xi_b, xio_x, IdentityPreconditioner{}, xi_tolerance, xi_maxIterations);
+    }
+
+    // solve A * x = b using (block) Jacobi preconditioned conjugate gradient
+    template<typename B, typename V>
+    IterativeSolution<sparse_detail::Scalar_t<B>> PreconditionedConjugateGradient(const SparseMatrix<B>& xi_A, const std::vector<V>& xi_b, std::vector<V>& xio_x,
+                                                                                  const sparse_detail::Scalar_t<B> xi_tolerance = static_cast<sparse_detail::Scalar_t<B>>(1e-6),
+                                                                                  const std::size_t xi_maxIterations = 1000) {
+        return ConjugateGradient(xi_A, xi_b, xio_x, JacobiPreconditioner<B>(xi_A), xi_tolerance, xi_maxIterations);
+    }
+
+}; // namespace GLSLCPP
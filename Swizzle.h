@@ -33,14 +33,31 @@ namespace GLSLCPP {
         // constructor
     public:
 
+#ifdef GLSLCPP_TRACK_TEMPORARIES
+        // construction from other swizzle (tracked)
+        Swizzle(const Swizzle& xi_swiz) : m_pack(xi_swiz.m_pack) { GLSLCPP_TRACK(Swizzle, Copy); }
+        Swizzle& operator=(const Swizzle& xi_swiz) {
+            m_pack = xi_swiz.m_pack;
+            GLSLCPP_TRACK(Swizzle, Copy);
+            return *this;
+        }
+        Swizzle(Swizzle&& xi_swiz) noexcept : m_pack(std::move(xi_swiz.m_pack)) { GLSLCPP_TRACK(Swizzle, Move); }
+        Swizzle& operator=(Swizzle&& xi_swiz) noexcept {
+            m_pack = std::move(xi_swiz.m_pack);
+            GLSLCPP_TRACK(Swizzle, Move);
+            return *this;
+        }
+#else
         // default construction from other swizzle (checked that compiler generate reasonable constructors)
         Swizzle(const Swizzle&)            = default;
         Swizzle& operator=(const Swizzle&) = default;
         Swizzle(Swizzle&&)            noexcept = default;
         Swizzle& operator=(Swizzle&&) noexcept = default;
+#endif
 
         // copy semantics with vectors
         template<typename U> Swizzle(const U& xi_rhs, REQUIRE(Is_VectorOfLength_v<U, N>)) {
+            GLSLCPP_TRACK(Swizzle, Construction);
             constexpr std::size_t indexes[] = { Indexes... };
 
             static_for<0, N>([&](std::size_t i) {
@@ -64,6 +81,7 @@ namespace GLSLCPP {
 
         // move semantics with vectors
         template<typename U> explicit constexpr Swizzle(U&& xi_rhs, REQUIRE(Is_VectorOfLength_v<U, N>)) noexcept {
+            GLSLCPP_TRACK(Swizzle, Construction);
             constexpr std::size_t indexes[] = { Indexes... };
             auto rhs = FWD(xi_rhs);
 
@@ -110,9 +128,10 @@ namespace GLSLCPP {
         // conversion operations
     public:
 
-#define M_CAST_GLSL_VECTOR(NAME)              \
-        operator NAME() const {               \
-            return NAME(m_pack[Indexes]...);  \
+#define M_CAST_GLSL_VECTOR(NAME)                                  \
+        operator NAME() const {                                   \
+            GLSLCPP_RECORD(SwizzleConversion, 0, 2 * N * sizeof(T));  \
+            return NAME(m_pack[Indexes]...);                      \
         }
 
         M_CAST_GLSL_VECTOR(VECTOR);
@@ -0,0 +1,475 @@
+/**
+* GLSL++
+*
+* software 2D texture (mip mapped, nearest/bilinear/trilinear filtering) and GLSL style sampling functions.
+*
+* Dan Israel Malta
+**/
+#pragma once
+#include "common.h"
+#include "VectorBase.h"
+#include "Vector2.h"
+#include <array>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <assert.h>
+
+namespace GLSLCPP {
+
+    // texel storage layout
+    enum class TextureLayout : std::uint8_t {
+        Linear,    // row major
+        Morton     // 8x8 tiles (row major order), texels inside a tile are in Morton (Z) order
+    };
+
+    // texture coordinates wrapping mode
+    enum class TextureWrap : std::uint8_t {
+        Repeat,
+        MirroredRepeat,
+        Clamp          // clamp to edge
+    };
+
+    // texture filtering mode
+    enum class TextureFilter : std::uint8_t {
+        Nearest,    // nearest texel in nearest mip level
+        Bilinear,   // bilinear interpolation in nearest mip level
+        Trilinear   // bilinear interpolation in two adjacent mip levels, blended
+    };
+
+    /**
+    * internal texture utilities
+    **/
+    namespace texture_detail {
+
+        // texel component type (texels are either scalars or vectors)
+        template<typename T, bool = std::is_arithmetic_v<T>> struct Component { using type = T; };
+        template<typename T>                                  struct Component<T, false> { using type = underlying_type_t<T>; };
+
+        // map an integer coordinate to the region [0, size - 1] according to wrapping mode
+        constexpr inline std::size_t Wrap(const std::int64_t i, const std::size_t xi_size, const TextureWrap xi_wrap) noexcept {
+            const std::int64_t n{ static_cast<std::int64_t>(xi_size) };
+            if ((i >= 0) && (i < n)) {
+                return static_cast<std::size_t>(i);
+            }
+
+            switch (xi_wrap) {
+                case TextureWrap::Repeat:
+                    return static_cast<std::size_t>(((i % n) + n) % n);
+                case TextureWrap::MirroredRepeat: {
+                    const std::int64_t m{ ((i % (2 * n)) + 2 * n) % (2 * n) };
+                    return static_cast<std::size_t>((m < n) ? m : (2 * n - 1 - m));
+                }
+                default:
+                    return static_cast<std::size_t>((i < 0) ? 0 : ((i >= n) ? n - 1 : i));
+            }
+        }
+
+        // linear interpolation between two texels
+        template<typename T, typename W>
+        constexpr inline T Lerp(const T& a, const T& b, const W t) {
+            T xo_lerp(a),
+              bt(b);
+            xo_lerp *= static_cast<W>(1) - t;
+            bt *= t;
+            xo_lerp += bt;
+            return xo_lerp;
+        }
+    };
+
+    /**
+    * \brief two dimensional mip mapped texture
+    *
+    * @param {T,             in} texel type (floating point scalar or vector, i.e. - float, vec2, vec4...)
+    * @param {TextureLayout, in} texel storage layout (default is tiled Morton order)
+    **/
+    template<typename T, TextureLayout LAYOUT = TextureLayout::Morton> class Texture2D {
+        using _T = typename texture_detail::Component<T>::type;
+        static_assert(std::is_floating_point_v<_T>, "Texture2D texels must be of floating point type (scalar or vector).");
+
+        // tile side length (Morton layout)
+        static constexpr std::size_t TileShift{ 3 },
+                                     TileSize{ 1 << TileShift },
+                                     TileMask{ TileSize - 1 };
+
+        // mip level description
+        struct Level {
+            std::size_t width,
+                        height,
+                        stride,     // texels per row (linear layout) or tiles per row (Morton layout)
+                        offset;     // index of first texel in level
+        };
+
+        // properties
+    private:
+        std::vector<T> m_texels;
+        std::vector<Level> m_levels;
+        TextureWrap m_wrap{ TextureWrap::Repeat };
+        TextureFilter m_filter{ TextureFilter::Bilinear };
+
+        // constructors
+    public:
+
+        /**
+        * \brief construct a zero filled texture
+        *
+        * @param {size_t, in} width
+        * @param {size_t, in} height
+        * @param {bool,   in} true to allocate a full mip chain, false for a single level (default is true)
+        **/
+        Texture2D(const std::size_t xi_width, const std::size_t xi_height, const bool xi_mipmaps = true) {
+            assert(xi_width > 0 && xi_height > 0 && " Texture2D dimensions must be positive.");
+
+            std::size_t width{ xi_width },
+                        height{ xi_height },
+                        offset{};
+            for (;;) {
+                const std::size_t stride{ (LAYOUT == TextureLayout::Linear) ? width : ((width + TileMask) >> TileShift) },
+                                  rows{ (LAYOUT == TextureLayout::Linear) ? height : (((height + TileMask) >> TileShift) << TileShift) },
+                                  size{ (LAYOUT == TextureLayout::Linear) ? (width * height) : (stride * TileSize * rows) };
+                m_levels.push_back(Level{ width, height, stride, offset });
+                offset += size;
+
+                if (!xi_mipmaps || ((width == 1) && (height == 1))) break;
+                width  = std::max<std::size_t>(width / 2, 1);
+                height = std::max<std::size_t>(height / 2, 1);
+            }
+
+            m_texels.resize(offset, T{});
+        }
+
+        /**
+        * \brief construct a texture from row major texels and generate its mip chain
+        *
+        * @param {size_t, in} width
+        * @param {size_t, in} height
+        * @param {T*,     in} texels in row major order (width * height elements)
+        * @param {bool,   in} true to generate a full mip chain, false for a single level (default is true)
+        **/
+        Texture2D(const std::size_t xi_width, const std::size_t xi_height, const T* xi_texels, const bool xi_mipmaps = true) : Texture2D(xi_width, xi_height, xi_mipmaps) {
+            for (std::size_t y{}; y < xi_height; ++y) {
+                for (std::size_t x{}; x < xi_width; ++x) {
+                    m_texels[Address(m_levels[0], x, y)] = xi_texels[y * xi_width + x];
+                }
+            }
+            GenerateMipmaps();
+        }
+
+        // query operations
+    public:
+
+        // number of mip levels
+        std::size_t Levels() const noexcept { return m_levels.size(); }
+
+        // mip level dimensions
+        std::size_t Width(const std::size_t xi_level = 0)  const { assert(xi_level < m_levels.size()); return m_levels[xi_level].width;  }
+        std::size_t Height(const std::size_t xi_level = 0) const { assert(xi_level < m_levels.size()); return m_levels[xi_level].height; }
+
+        // sampler state
+        TextureWrap   GetWrap()   const noexcept { return m_wrap;   }
+        TextureFilter GetFilter() const noexcept { return m_filter; }
+        void SetWrap(const TextureWrap xi_wrap)       noexcept { m_wrap = xi_wrap;     }
+        void SetFilter(const TextureFilter xi_filter) noexcept { m_filter = xi_filter; }
+
+        // texel access
+    public:
+
+        // texel at integer coordinate in a given mip level
+        const T& Texel(const std::size_t x, const std::size_t y, const std::size_t xi_level = 0) const {
+            assert(xi_level < m_levels.size() && x < m_levels[xi_level].width && y < m_levels[xi_level].height);
+            return m_texels[Address(m_levels[xi_level], x, y)];
+        }
+        T& Texel(const std::size_t x, const std::size_t y, const std::size_t xi_level = 0) {
+            assert(xi_level < m_levels.size() && x < m_levels[xi_level].width && y < m_levels[xi_level].height);
+            return m_texels[Address(m_levels[xi_level], x, y)];
+        }
+
+        // rebuild all mip levels (from level 0) using a 2x2 box filter
+        void GenerateMipmaps() {
+            const _T quarter{ static_cast<_T>(0.25) };
+
+            for (std::size_t l{ 1 }; l < m_levels.size(); ++l) {
+                const Level& src{ m_levels[l - 1] },
+                             dst{ m_levels[l] };
+
+                for (std::size_t y{}; y < dst.height; ++y) {
+                    const std::size_t y0{ std::min(2 * y, src.height - 1) },
+                                      y1{ std::min(2 * y + 1, src.height - 1) };
+                    for (std::size_t x{}; x < dst.width; ++x) {
+                        const std::size_t x0{ std::min(2 * x, src.width - 1) },
+                                          x1{ std::min(2 * x + 1, src.width - 1) };
+                        T texel(m_texels[Address(src, x0, y0)]);
+                        texel += m_texels[Address(src, x1, y0)];
+                        texel += m_texels[Address(src, x0, y1)];
+                        texel += m_texels[Address(src, x1, y1)];
+                        texel *= quarter;
+                        m_texels[Address(dst, x, y)] = texel;
+                    }
+                }
+            }
+        }
+
+        // sampling operations
+    public:
+
+        /**
+        * \brief sample texture at a given (normalized) coordinate in a given level of detail
+        *
+        * @param {Vector, in}  normalized texture coordinate (2 elements)
+        * @param {T,      in}  level of detail (0 = base level, default 0)
+        * @param {T,      out} sampled value
+        **/
+        template<typename U, REQUIRE(Is_VectorOfLength_v<U, 2>)>
+        T Sample(const U& xi_uv, const _T xi_lod = _T{}) const {
+            const _T u{ static_cast<_T>(xi_uv[0]) },
+                     v{ static_cast<_T>(xi_uv[1]) };
+            T xo_texel;
+            SampleLanes<1>(&u, &v, xi_lod, &xo_texel);
+            return xo_texel;
+        }
+
+        /**
+        * \brief sample texture at a given (normalized) coordinate using explicit coordinate derivatives to select level of detail
+        *
+        * @param {Vector, in}  normalized texture coordinate (2 elements)
+        * @param {Vector, in}  texture coordinate derivative along screen x axis
+        * @param {Vector, in}  texture coordinate derivative along screen y axis
+        * @param {T,      out} sampled value
+        **/
+        template<typename U, REQUIRE(Is_VectorOfLength_v<U, 2>)>
+        T SampleGrad(const U& xi_uv, const U& xi_dPdx, const U& xi_dPdy) const {
+            const _T w{ static_cast<_T>(m_levels[0].width) },
+                     h{ static_cast<_T>(m_levels[0].height) },
+                     dx0{ static_cast<_T>(xi_dPdx[0]) * w },
+                     dx1{ static_cast<_T>(xi_dPdx[1]) * h },
+                     dy0{ static_cast<_T>(xi_dPdy[0]) * w },
+                     dy1{ static_cast<_T>(xi_dPdy[1]) * h },
+                     rho2{ std::max(dx0 * dx0 + dx1 * dx1, dy0 * dy0 + dy1 * dy1) },
+                     lod{ (rho2 > _T{}) ? static_cast<_T>(0.5) * std::log2(rho2) : _T{} };
+            return Sample(xi_uv, lod);
+        }
+
+        /**
+        * \brief sample texture at a batch of 4 or 8 (normalized) coordinates in a given level of detail
+        *
+        * @param {array<Vector, W>, in}  normalized texture coordinates
+        * @param {T,                in}  level of detail (0 = base level)
+        * @param {array<T, W>,      out} sampled values
+        **/
+        template<std::size_t W, typename U, REQUIRE(((W == 4) || (W == 8)) && Is_VectorOfLength_v<U, 2>)>
+        void Sample(const std::array<U, W>& xi_uv, const _T xi_lod, std::array<T, W>& xo_texels) const {
+            std::array<_T, W> u, v;
+            for (std::size_t i{}; i < W; ++i) {
+                u[i] = static_cast<_T>(xi_uv[i][0]);
+                v[i] = static_cast<_T>(xi_uv[i][1]);
+            }
+            SampleLanes<W>(u.data(), v.data(), xi_lod, xo_texels.data());
+        }
+
+        /**
+        * \brief sample texture at a batch of (normalized) coordinates given as structure of arrays
+        *
+        * @param {T*,     in}  'u' coordinates
+        * @param {T*,     in}  'v' coordinates
+        * @param {T*,     out} sampled values
+        * @param {size_t, in}  number of coordinates
+        * @param {T,      in}  level of detail (0 = base level, default 0)
+        **/
+        void Sample(const _T* xi_u, const _T* xi_v, T* xo_texels, const std::size_t xi_count, const _T xi_lod = _T{}) const {
+            constexpr std::size_t lanes{ 8 };
+            std::size_t i{};
+            for (; i + lanes <= xi_count; i += lanes) {
+                SampleLanes<lanes>(xi_u + i, xi_v + i, xi_lod, xo_texels + i);
+            }
+            for (; i < xi_count; ++i) {
+                SampleLanes<1>(xi_u + i, xi_v + i, xi_lod, xo_texels + i);
+            }
+        }
+
+        // internal helpers
+    private:
+
+        // texel index in storage
+        static constexpr std::size_t Address(const Level& xi_level, const std::size_t x, const std::size_t y) noexcept {
+            if constexpr (LAYOUT == TextureLayout::Linear) {
+                return xi_level.offset + y * xi_level.stride + x;
+            }
+            else {
+                const std::size_t tile{ (y >> TileShift) * xi_level.stride + (x >> TileShift) };
+                // bits of a 3 bit coordinate spread to even positions (Part1By1 of 0..7)
+                constexpr std::size_t spread[TileSize]{ 0, 1, 4, 5, 16, 17, 20, 21 };
+                return xi_level.offset + (tile << (2 * TileShift)) + (spread[x & TileMask] | (spread[y & TileMask] << 1));
+            }
+        }
+
+        // sample W lanes in a given mip level.
+        // addresses and weights of all lanes are calculated first and only then texels are fetched and blended.
+        template<std::size_t W>
+        void SampleLevel(const std::size_t xi_level, const _T* xi_u, const _T* xi_v, T* xo_texels) const {
+            const Level& level{ m_levels[xi_level] };
+            const _T width{ static_cast<_T>(level.width) },
+                     height{ static_cast<_T>(level.height) };
+
+            if (m_filter == TextureFilter::Nearest) {
+                std::array<std::size_t, W> address;
+                for (std::size_t i{}; i < W; ++i) {
+                    const std::int64_t x{ static_cast<std::int64_t>(std::floor(xi_u[i] * width)) },
+                                       y{ static_cast<std::int64_t>(std::floor(xi_v[i] * height)) };
+                    address[i] = Address(level, texture_detail::Wrap(x, level.width, m_wrap), texture_detail::Wrap(y, level.height, m_wrap));
+                }
+                for (std::size_t i{}; i < W; ++i) {
+                    xo_texels[i] = m_texels[address[i]];
+                }
+                return;
+            }
+
+            std::array<std::size_t, W> a00, a10, a01, a11;
+            std::array<_T, W> wx, wy;
+            for (std::size_t i{}; i < W; ++i) {
+                const _T x{ xi_u[i] * width - static_cast<_T>(0.5) },
+                         y{ xi_v[i] * height - static_cast<_T>(0.5) },
+                         fx{ std::floor(x) },
+                         fy{ std::floor(y) };
+                wx[i] = x - fx;
+                wy[i] = y - fy;
+
+                const std::int64_t ix{ static_cast<std::int64_t>(fx) },
+                                   iy{ static_cast<std::int64_t>(fy) };
+                const std::size_t x0{ texture_detail::Wrap(ix,     level.width,  m_wrap) },
+                                  x1{ texture_detail::Wrap(ix + 1, level.width,  m_wrap) },
+                                  y0{ texture_detail::Wrap(iy,     level.height, m_wrap) },
+                                  y1{ texture_detail::Wrap(iy + 1, level.height, m_wrap) };
+                a00[i] = Address(level, x0, y0);
+                a10[i] = Address(level, x1, y0);
+                a01[i] = Address(level, x0, y1);
+                a11[i] = Address(level, x1, y1);
+            }
+
+            for (std::size_t i{}; i < W; ++i) {
+                xo_texels[i] = texture_detail::Lerp(texture_detail::Lerp(m_texels[a00[i]], m_texels[a10[i]], wx[i]),
+                                                    texture_detail::Lerp(m_texels[a01[i]], m_texels[a11[i]], wx[i]),
+                                                    wy[i]);
+            }
+        }
+
+        // sample W lanes at a given level of detail
+        template<std::size_t W>
+        void SampleLanes(const _T* xi_u, const _T* xi_v, const _T xi_lod, T* xo_texels) const {
+            const _T maxLod{ static_cast<_T>(m_levels.size() - 1) },
+                     lod{ std::clamp(xi_lod, _T{}, maxLod) };
+
+            if (m_filter != TextureFilter::Trilinear) {
+                SampleLevel<W>(static_cast<std::size_t>(lod + static_cast<_T>(0.5)), xi_u, xi_v, xo_texels);
+                return;
+            }
+
+            const _T base{ std::floor(lod) },
+                     fraction{ lod - base };
+            const std::size_t level{ static_cast<std::size_t>(base) };
+            SampleLevel<W>(level, xi_u, xi_v, xo_texels);
+
+            if ((fraction > _T{}) && (level + 1 < m_levels.size())) {
+                std::array<T, W> coarse;
+                SampleLevel<W>(level + 1, xi_u, xi_v, coarse.data());
+                for (std::size_t i{}; i < W; ++i) {
+                    xo_texels[i] = texture_detail::Lerp(xo_texels[i], coarse[i], fraction);
+                }
+            }
+        }
+    };
+
+    // ------------------------------------
+    // --- GLSL style texture functions ---
+    // ------------------------------------
+
+    /**
+    * \brief sample a texture at a given (normalized) coordinate (base level of detail)
+    *
+    * @param {Texture2D, in}  texture
+    * @param {Vector,    in}  normalized texture coordinate
+    * @param {T,         out} sampled value
+    **/
+    template<typename T, TextureLayout LAYOUT, typename U, REQUIRE(Is_VectorOfLength_v<U, 2>)>
+    inline T texture(const Texture2D<T, LAYOUT>& xi_sampler, const U& xi_uv) {
+        return xi_sampler.Sample(xi_uv);
+    }
+
+    /**
+    * \brief sample a texture at a given (normalized) coordinate in an explicit level of detail
+    *
+    * @param {Texture2D, in}  texture
+    * @param {Vector,    in}  normalized texture coordinate
+    * @param {T,         in}  level of detail
+    * @param {T,         out} sampled value
+    **/
+    template<typename T, TextureLayout LAYOUT, typename U, typename L, REQUIRE(Is_VectorOfLength_v<U, 2> && std::is_arithmetic_v<L>)>
+    inline T textureLod(const Texture2D<T, LAYOUT>& xi_sampler, const U& xi_uv, const L xi_lod) {
+        return xi_sampler.Sample(xi_uv, static_cast<typename texture_detail::Component<T>::type>(xi_lod));
+    }
+
+    /**
+    * \brief sample a texture at a given (normalized) coordinate using explicit derivatives
+    *
+    * @param {Texture2D, in}  texture
+    * @param {Vector,    in}  normalized texture coordinate
+    * @param {Vector,    in}  texture coordinate derivative along screen x axis
+    * @param {Vector,    in}  texture coordinate derivative along screen y axis
+    * @param {T,         out} sampled value
+    **/
+    template<typename T, TextureLayout LAYOUT, typename U, REQUIRE(Is_VectorOfLength_v<U, 2>)>
+    inline T textureGrad(const Texture2D<T, LAYOUT>& xi_sampler, const U& xi_uv, const U& xi_dPdx, const U& xi_dPdy) {
+        return xi_sampler.SampleGrad(xi_uv, xi_dPdx, xi_dPdy);
+    }
+
+    /**
+    * \brief sample a texture at a batch of 4 or 8 (normalized) coordinates
+    *
+    * @param {Texture2D,        in}  texture
+    * @param {array<Vector, W>, in}  normalized texture coordinates
+    * @param {T,                in}  level of detail (only in 'textureLod')
+    * @param {array<T, W>,      out} sampled values
+    **/
+    template<typename T, TextureLayout LAYOUT, std::size_t W, typename U, REQUIRE(Is_VectorOfLength_v<U, 2>)>
+    inline std::array<T, W> texture(const Texture2D<T, LAYOUT>& xi_sampler, const std::array<U, W>& xi_uv) {
+        std::array<T, W> xo_texels;
+        xi_sampler.Sample(xi_uv, typename texture_detail::Component<T>::type{}, xo_texels);
+        return xo_texels;
+    }
+
+    template<typename T, TextureLayout LAYOUT, std::size_t W, typename U, typename L, REQUIRE(Is_VectorOfLength_v<U, 2> && std::is_arithmetic_v<L>)>
+    inline std::array<T, W> textureLod(const Texture2D<T, LAYOUT>& xi_sampler, const std::array<U, W>& xi_uv, const L xi_lod) {
+        std::array<T, W> xo_texels;
+        xi_sampler.Sample(xi_uv, static_cast<typename texture_detail::Component<T>::type>(xi_lod), xo_texels);
+        return xo_texels;
+    }
+
+    /**
+    * \brief fetch a single texel (no filtering) from a given mip level; coordinates are wrapped according to texture wrap mode
+    *
+    * @param {Texture2D, in}  texture
+    * @param {Vector,    in}  integer texel coordinate
+    * @param {size_t,    in}  mip level
+    * @param {T,         out} texel
+    **/
+    template<typename T, TextureLayout LAYOUT, typename U, REQUIRE(Is_VectorOfLength_v<U, 2>)>
+    inline T texelFetch(const Texture2D<T, LAYOUT>& xi_sampler, const U& xi_coordinate, const std::size_t xi_level) {
+        const TextureWrap wrap{ xi_sampler.GetWrap() };
+        return xi_sampler.Texel(texture_detail::Wrap(static_cast<std::int64_t>(xi_coordinate[0]), xi_sampler.Width(xi_level), wrap),
+                                texture_detail::Wrap(static_cast<std::int64_t>(xi_coordinate[1]), xi_sampler.Height(xi_level), wrap),
+                                xi_level);
+    }
+
+    /**
+    * \brief return the dimensions of a given mip level
+    *
+    * @param {Texture2D, in}  texture
+    * @param {size_t,    in}  mip level
+    * @param {ivec2,     out} {width, height}
+    **/
+    template<typename T, TextureLayout LAYOUT>
+    inline Vector2<std::int32_t> textureSize(const Texture2D<T, LAYOUT>& xi_sampler, const std::size_t xi_level) {
+        return Vector2<std::int32_t>(static_cast<std::int32_t>(xi_sampler.Width(xi_level)),
+                                     static_cast<std::int32_t>(xi_sampler.Height(xi_level)));
+    }
+
+}; // namespace GLSLCPP
@@ -0,0 +1,516 @@
+/**
+* GLSL++
+*
+* a cubic matrix along with flags describing its structure (identity, diagonal, orthonormal, affine, triangular, symmetric).
+* flags are declared (or detected once) at construction and propagated through operations,
+* so inversion, determinant, products and solvers dispatch to specialized kernels without scanning the matrix.
+*
+* Dan Israel Malta
+**/
+#pragma once
+#include "common.h"
+#include "VectorBase.h"
+#include "MatrixBase.h"
+#include "MatrixOperations.h"
+#include "Affine.h"
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+namespace GLSLCPP {
+
+    // structural properties of a cubic matrix (can be combined)
+    enum class MatrixProperty : std::uint8_t {
+        None            = 0,
+        Identity        = 1 << 0,    // A = I
+        Diagonal        = 1 << 1,    // only diagonal elements are non zero
+        Orthonormal     = 1 << 2,    // A^T * A = I
+        Affine          = 1 << 3,    // 4x4 matrix whose last row is [0, 0, 0, 1]
+        LowerTriangular = 1 << 4,    // elements above the diagonal are zero
+        UpperTriangular = 1 << 5,    // elements below the diagonal are zero
+        Symmetric       = 1 << 6     // A = A^T
+    };
+
+    constexpr MatrixProperty operator|(const MatrixProperty xi_a, const MatrixProperty xi_b) noexcept {
+        return static_cast<MatrixProperty>(static_cast<std::uint8_t>(xi_a) | static_cast<std::uint8_t>(xi_b));
+    }
+    constexpr MatrixProperty operator&(const MatrixProperty xi_a, const MatrixProperty xi_b) noexcept {
+        return static_cast<MatrixProperty>(static_cast<std::uint8_t>(xi_a) & static_cast<std::uint8_t>(xi_b));
+    }
+
+    // true if all properties in 'xi_query' are in 'xi_properties'
+    constexpr bool HasProperty(const MatrixProperty xi_properties, const MatrixProperty xi_query) noexcept {
+        return (xi_properties & xi_query) == xi_query;
+    }
+
+    namespace tracked_detail {
+
+        // constructor tag for properties which are known to hold (results of tracked operations), so they are not verified
+        struct Unchecked {};
+
+        // add properties implied by the given ones (identity is diagonal, orthonormal and affine, diagonal is triangular and symmetric...)
+        template<std::size_t N>
+        constexpr MatrixProperty Closure(MatrixProperty xi_properties) noexcept {
+            if (HasProperty(xi_properties, MatrixProperty::Identity)) {
+                xi_properties = xi_properties | MatrixProperty::Diagonal | MatrixProperty::Orthonormal;
+                if constexpr (N == 4) {
+                    xi_properties = xi_properties | MatrixProperty::Affine;
+                }
+            }
+            if (HasProperty(xi_properties, MatrixProperty::Diagonal)) {
+                xi_properties = xi_properties | MatrixProperty::LowerTriangular | MatrixProperty::UpperTriangular | MatrixProperty::Symmetric;
+            }
+            if (HasProperty(xi_properties, MatrixProperty::LowerTriangular | MatrixProperty::UpperTriangular)) {
+                xi_properties = xi_properties | MatrixProperty::Diagonal | MatrixProperty::Symmetric;
+            }
+            if constexpr (N != 4) {
+                xi_properties = xi_properties & static_cast<MatrixProperty>(~static_cast<std::uint8_t>(MatrixProperty::Affine));
+            }
+            return xi_properties;
+        }
+
+        // L^-1 for lower triangular L (column by column forward substitution)
+        template<typename M>
+        constexpr M InvLower(const M& xi_L) noexcept {
+            using _T = underlying_type_t<M>;
+            constexpr std::size_t N{ Rows_v<M> };
+
+            M xo_inv(_T{});
+            for (std::size_t j{}; j < N; ++j) {
+                xo_inv(j, j) = static_cast<_T>(1) / xi_L(j, j);
+                for (std::size_t r{ j + 1 }; r < N; ++r) {
+                    _T sum{};
+                    for (std::size_t k{ j }; k < r; ++k) {
+                        sum += xi_L(k, r) * xo_inv(j, k);
+                    }
+                    xo_inv(j, r) = -sum / xi_L(r, r);
+                }
+            }
+            return xo_inv;
+        }
+
+        // A * B for lower triangular A and B (only the non zero elements are accumulated)
+        template<typename M>
+        constexpr M MultiplyLower(const M& xi_A, const M& xi_B) noexcept {
+            using _T = underlying_type_t<M>;
+            constexpr std::size_t N{ Rows_v<M> };
+
+            M xo_mat(_T{});
+            for (std::size_t c{}; c < N; ++c) {
+                for (std::size_t k{ c }; k < N; ++k) {
+                    const _T b{ xi_B(c, k) };
+                    for (std::size_t r{ k }; r < N; ++r) {
+                        xo_mat(c, r) += xi_A(k, r) * b;
+                    }
+                }
+            }
+            return xo_mat;
+        }
+
+        // tolerance of property detection ('16 * N' epsilons relative to largest absolute element of a matrix)
+        template<typename M>
+        constexpr underlying_type_t<M> Tolerance(const M& xi_mat) noexcept {
+            using _T = underlying_type_t<M>;
+            constexpr std::size_t N{ Rows_v<M> };
+
+            _T scale{};
+            for (std::size_t c{}; c < N; ++c) {
+                for (std::size_t r{}; r < N; ++r) {
+                    scale = std::max(scale, std::abs(xi_mat(c, r)));
+                }
+            }
+            return static_cast<_T>(16 * N) * std::numeric_limits<_T>::epsilon() * scale;
+        }
+
+        template<typename M>
+        constexpr M Transposed(const M& xi_mat) noexcept {
+            constexpr std::size_t N{ Rows_v<M> };
+            M xo_mat(underlying_type_t<M>{});
+            for (std::size_t c{}; c < N; ++c) {
+                for (std::size_t r{}; r < N; ++r) {
+                    xo_mat(r, c) = xi_mat(c, r);
+                }
+            }
+            return xo_mat;
+        }
+    };
+
+    /**
+    * \brief scan a cubic matrix and return its structural properties (O(N^2), except orthonormality which is O(N^3)).
+    *        zero elements and symmetry are tested relative to largest absolute element, unit values (identity, orthonormality
+    *        and last row of affine matrix) are tested relative to one.
+    *
+    * @param {MatrixBase,     in}  matrix
+    * @param {MatrixProperty, out} properties
+    **/
+    template<typename M, REQUIRE(is_Cubic<M>::value)>
+    constexpr MatrixProperty DetectProperties(const M& xi_mat) noexcept {
+        using _T = underlying_type_t<M>;
+        constexpr std::size_t N{ Rows_v<M> };
+        constexpr _T TOL{ static_cast<_T>(16 * N) * std::numeric_limits<_T>::epsilon() };
+        const _T tol{ tracked_detail::Tolerance(xi_mat) };
+
+        bool lower{ true },
+             upper{ true },
+             symmetric{ true },
+             identity{ true },
+             orthonormal{ true };
+        for (std::size_t c{}; c < N; ++c) {
+            for (std::size_t r{}; r < N; ++r) {
+                const _T a{ xi_mat(c, r) };
+                if (r < c) lower &= (std::abs(a) <= tol);
+                if (r > c) upper &= (std::abs(a) <= tol);
+                symmetric &= (std::abs(a - xi_mat(r, c)) <= tol);
+                identity &= (std::abs(a - static_cast<_T>(c == r)) <= TOL);
+
+                _T dot{};
+                for (std::size_t k{}; k < N; ++k) {
+                    dot += xi_mat(c, k) * xi_mat(r, k);
+                }
+                orthonormal &= (std::abs(dot - static_cast<_T>(c == r)) <= TOL);
+            }
+        }
+
+        MatrixProperty xo_properties{ MatrixProperty::None };
+        if (lower)       xo_properties = xo_properties | MatrixProperty::LowerTriangular;
+        if (upper)       xo_properties = xo_properties | MatrixProperty::UpperTriangular;
+        if (symmetric)   xo_properties = xo_properties | MatrixProperty::Symmetric;
+        if (identity)    xo_properties = xo_properties | MatrixProperty::Identity;
+        if (orthonormal) xo_properties = xo_properties | MatrixProperty::Orthonormal;
+        if constexpr (N == 4) {
+            if ((std::abs(xi_mat(0, 3)) <= tol) && (std::abs(xi_mat(1, 3)) <= tol) && (std::abs(xi_mat(2, 3)) <= tol) &&
+                (std::abs(xi_mat(3, 3) - static_cast<_T>(1)) <= TOL)) {
+                xo_properties = xo_properties | MatrixProperty::Affine;
+            }
+        }
+        return tracked_detail::Closure<N>(xo_properties);
+    }
+
+    /**
+    * \brief cubic matrix with tracked structural properties.
+    *        the matrix is immutable (element access is read only), so its properties remain valid.
+    *
+    * @param {M, in} cubic matrix type (MatrixBase)
+    **/
+    template<typename M> class TrackedMatrix {
+        static_assert(is_Cubic<M>::value, "TrackedMatrix<M> - M must be a cubic matrix.");
+        static_assert(std::is_floating_point<underlying_type_t<M>>::value, "TrackedMatrix<M> - M must be of floating point type.");
+
+        // properties
+    private:
+        M m_data;
+        MatrixProperty m_properties;
+
+        // constructors
+    public:
+
+        // identity matrix
+        constexpr TrackedMatrix() noexcept : m_data(), m_properties(tracked_detail::Closure<Rows_v<M>>(MatrixProperty::Identity)) {}
+
+        // construct from a matrix whose properties are known (declared properties are verified in debug builds only)
+        explicit constexpr TrackedMatrix(const M& xi_mat, const MatrixProperty xi_properties = MatrixProperty::None) noexcept :
+            m_data(xi_mat), m_properties(tracked_detail::Closure<Rows_v<M>>(xi_properties)) {
+            assert(HasProperty(DetectProperties(m_data), m_properties) && " declared matrix properties do not hold.");
+        }
+
+        // construct from a matrix whose properties are known to hold (used by tracked operations)
+        constexpr TrackedMatrix(const M& xi_mat, const MatrixProperty xi_properties, tracked_detail::Unchecked) noexcept :
+            m_data(xi_mat), m_properties(tracked_detail::Closure<Rows_v<M>>(xi_properties)) {}
+
+        // construct from an affine transformation
+        template<typename T, REQUIRE((Rows_v<M> == 4) && std::is_same_v<T, underlying_type_t<M>>)>
+        explicit constexpr TrackedMatrix(const Affine3<T>& xi_affine) noexcept : m_data(xi_affine.dense()), m_properties(MatrixProperty::Affine) {}
+
+        TrackedMatrix(const TrackedMatrix&) noexcept = default;
+        TrackedMatrix(TrackedMatrix&&) noexcept = default;
+        TrackedMatrix& operator=(const TrackedMatrix&) noexcept = default;
+        TrackedMatrix& operator=(TrackedMatrix&&) noexcept = default;
+
+        // element access and queries
+    public:
+
+        // '(col, row)' element access (read only)
+        constexpr underlying_type_t<M> operator()(const std::size_t col, const std::size_t row) const { return m_data(col, row); }
+
+        constexpr const M& matrix() const noexcept { return m_data; }
+        constexpr MatrixProperty properties() const noexcept { return m_properties; }
+        constexpr bool is(const MatrixProperty xi_property) const noexcept { return HasProperty(m_properties, xi_property); }
+    };
+
+    // type trait to test if an object is a tracked matrix
+    template<typename>   struct is_TrackedMatrix : public std::false_type {};
+    template<typename M> struct is_TrackedMatrix<TrackedMatrix<M>> : public std::true_type {};
+    template<typename T> inline constexpr bool is_TrackedMatrix_v = is_TrackedMatrix<T>::value;
+
+    /**
+    * \brief scan a cubic matrix once and wrap it with its detected properties
+    *
+    * @param {MatrixBase,    in}  matrix
+    * @param {TrackedMatrix, out} tracked matrix
+    **/
+    template<typename M, REQUIRE(is_Cubic<M>::value)>
+    constexpr TrackedMatrix<M> Track(const M& xi_mat) noexcept {
+        return TrackedMatrix<M>(xi_mat, DetectProperties(xi_mat));
+    }
+
+    /**
+    * \brief tracked diagonal matrix
+    *
+    * @param {Vector,        in}  diagonal
+    * @param {TrackedMatrix, out} tracked diagonal matrix
+    **/
+    template<typename V, REQUIRE(is_Vector_v<V>), typename T = underlying_type_t<V>, std::size_t N = Length_v<V>>
+    constexpr TrackedMatrix<MatrixBase<T, N, N>> TrackDiagonal(const V& xi_diagonal) noexcept {
+        MatrixBase<T, N, N> diagonal(T{});
+        for (std::size_t i{}; i < N; ++i) {
+            diagonal(i, i) = xi_diagonal[i];
+        }
+        return TrackedMatrix<MatrixBase<T, N, N>>(diagonal, MatrixProperty::Diagonal, tracked_detail::Unchecked{});
+    }
+
+    // ---------------------------
+    // --- numerical operators ---
+    // ---------------------------
+
+    /**
+    * \brief tracked matrix multiplication (identity and diagonal factors are applied in O(N^2), triangular factors skip their zeros)
+    *        product keeps properties which are closed under multiplication.
+    *
+    * @param {TrackedMatrix, in}  A
+    * @param {TrackedMatrix, in}  B
+    * @param {TrackedMatrix, out} A * B
+    **/
+    template<typename M>
+    constexpr TrackedMatrix<M> operator*(const TrackedMatrix<M>& xi_lhs, const TrackedMatrix<M>& xi_rhs) noexcept {
+        constexpr std::size_t N{ Rows_v<M> };
+
+        if (xi_lhs.is(MatrixProperty::Identity)) return xi_rhs;
+        if (xi_rhs.is(MatrixProperty::Identity)) return xi_lhs;
+
+        // properties closed under multiplication
+        constexpr MatrixProperty closed{ MatrixProperty::Diagonal | MatrixProperty::Orthonormal | MatrixProperty::Affine |
+                                         MatrixProperty::LowerTriangular | MatrixProperty::UpperTriangular };
+        const MatrixProperty properties{ xi_lhs.properties() & xi_rhs.properties() & closed };
+
+        // diagonal factor scales rows (left) or columns (right) of the other factor
+        if (xi_lhs.is(MatrixProperty::Diagonal) || xi_rhs.is(MatrixProperty::Diagonal)) {
+            const bool left{ xi_lhs.is(MatrixProperty::Diagonal) };
+            const M& diagonal{ left ? xi_lhs.matrix() : xi_rhs.matrix() };
+            M xo_mat(left ? xi_rhs.matrix() : xi_lhs.matrix());
+            for (std::size_t c{}; c < N; ++c) {
+                for (std::size_t r{}; r < N; ++r) {
+                    xo_mat(c, r) *= diagonal(left ? r : c, left ? r : c);
+                }
+            }
+
+            // scaling keeps triangular structure of the other factor, but not symmetry or orthonormality
+            constexpr MatrixProperty kept{ MatrixProperty::Diagonal | MatrixProperty::LowerTriangular | MatrixProperty::UpperTriangular };
+            return TrackedMatrix<M>(xo_mat, (left ? xi_rhs.properties() : xi_lhs.properties()) & kept, tracked_detail::Unchecked{});
+        }
+
+        if (HasProperty(properties, MatrixProperty::LowerTriangular)) {
+            return TrackedMatrix<M>(tracked_detail::MultiplyLower(xi_lhs.matrix(), xi_rhs.matrix()), properties, tracked_detail::Unchecked{});
+        }
+        if (HasProperty(properties, MatrixProperty::UpperTriangular)) {
+            // (A * B)^T = B^T * A^T, where both are lower triangular
+            const M product(tracked_detail::MultiplyLower(tracked_detail::Transposed(xi_rhs.matrix()), tracked_detail::Transposed(xi_lhs.matrix())));
+            return TrackedMatrix<M>(tracked_detail::Transposed(product), properties, tracked_detail::Unchecked{});
+        }
+
+        return TrackedMatrix<M>(xi_lhs.matrix() * xi_rhs.matrix(), properties, tracked_detail::Unchecked{});
+    }
+
+    /**
+    * \brief tracked matrix - vector multiplication
+    *
+    * @param {TrackedMatrix, in}  A
+    * @param {VectorBase,    in}  x (column vector)
+    * @param {VectorBase,    out} A * x
+    **/
+    template<typename M>
+    constexpr VectorBase<underlying_type_t<M>, Rows_v<M>> operator*(const TrackedMatrix<M>& xi_mat, const VectorBase<underlying_type_t<M>, Rows_v<M>>& xi_vec) noexcept {
+        constexpr std::size_t N{ Rows_v<M> };
+        if (xi_mat.is(MatrixProperty::Identity)) return xi_vec;
+        if (xi_mat.is(MatrixProperty::Diagonal)) {
+            VectorBase<underlying_type_t<M>, N> xo_vec;
+            for (std::size_t i{}; i < N; ++i) {
+                xo_vec[i] = xi_mat(i, i) * xi_vec[i];
+            }
+            return xo_vec;
+        }
+        return xi_mat.matrix() * xi_vec;
+    }
+
+    /**
+    * \brief tracked matrix addition/subtraction (keeps diagonal, triangular and symmetric properties shared by both operands)
+    *
+    * @param {TrackedMatrix, in}  A
+    * @param {TrackedMatrix, in}  B
+    * @param {TrackedMatrix, out} A + B (A - B)
+    **/
+    template<typename M>
+    constexpr TrackedMatrix<M> operator+(const TrackedMatrix<M>& xi_lhs, const TrackedMatrix<M>& xi_rhs) noexcept {
+        constexpr MatrixProperty kept{ MatrixProperty::Diagonal | MatrixProperty::LowerTriangular | MatrixProperty::UpperTriangular | MatrixProperty::Symmetric };
+        return TrackedMatrix<M>(xi_lhs.matrix() + xi_rhs.matrix(), xi_lhs.properties() & xi_rhs.properties() & kept, tracked_detail::Unchecked{});
+    }
+    template<typename M>
+    constexpr TrackedMatrix<M> operator-(const TrackedMatrix<M>& xi_lhs, const TrackedMatrix<M>& xi_rhs) noexcept {
+        constexpr MatrixProperty kept{ MatrixProperty::Diagonal | MatrixProperty::LowerTriangular | MatrixProperty::UpperTriangular | MatrixProperty::Symmetric };
+        return TrackedMatrix<M>(xi_lhs.matrix() - xi_rhs.matrix(), xi_lhs.properties() & xi_rhs.properties() & kept, tracked_detail::Unchecked{});
+    }
+
+    /**
+    * \brief tracked matrix scaling (keeps diagonal, triangular and symmetric properties)
+    *
+    * @param {TrackedMatrix, in}  A
+    * @param {T,             in}  scalar
+    * @param {TrackedMatrix, out} A * scalar
+    **/
+    template<typename M>
+    constexpr TrackedMatrix<M> operator*(const TrackedMatrix<M>& xi_mat, const underlying_type_t<M> xi_value) noexcept {
+        constexpr MatrixProperty kept{ MatrixProperty::Diagonal | MatrixProperty::LowerTriangular | MatrixProperty::UpperTriangular | MatrixProperty::Symmetric };
+        return TrackedMatrix<M>(xi_mat.matrix() * xi_value, xi_mat.properties() & kept, tracked_detail::Unchecked{});
+    }
+
+    // -------------------------------
+    // --- operations (dispatched) ---
+    // -------------------------------
+
+    /**
+    * \brief transpose of a tracked matrix (free for symmetric matrices; lower and upper triangular properties are swapped)
+    *
+    * @param {TrackedMatrix, in}  A
+    * @param {TrackedMatrix, out} A^T
+    **/
+    template<typename M>
+    constexpr TrackedMatrix<M> Transpose(const TrackedMatrix<M>& xi_mat) noexcept {
+        if (xi_mat.is(MatrixProperty::Symmetric)) return xi_mat;
+
+        MatrixProperty properties{ xi_mat.properties() & (MatrixProperty::Orthonormal | MatrixProperty::Symmetric) };
+        if (xi_mat.is(MatrixProperty::LowerTriangular)) properties = properties | MatrixProperty::UpperTriangular;
+        if (xi_mat.is(MatrixProperty::UpperTriangular)) properties = properties | MatrixProperty::LowerTriangular;
+        return TrackedMatrix<M>(tracked_detail::Transposed(xi_mat.matrix()), properties, tracked_detail::Unchecked{});
+    }
+
+    /**
+    * \brief inverse of a tracked matrix, dispatched by its properties:
+    *        identity (free), diagonal (O(N)), orthonormal (transpose), affine (3x3 inverse and translation),
+    *        triangular (substitution), otherwise general inverse. inverse keeps all properties.
+    *        notice that assertion is the only way to test if matrix is singular (invertible).
+    *
+    * @param {TrackedMatrix, in}  A
+    * @param {TrackedMatrix, out} A^-1
+    **/
+    template<typename M>
+    constexpr TrackedMatrix<M> Inv(const TrackedMatrix<M>& xi_mat) noexcept {
+        using _T = underlying_type_t<M>;
+        constexpr std::size_t N{ Rows_v<M> };
+        const MatrixProperty properties{ xi_mat.properties() };
+
+        if (xi_mat.is(MatrixProperty::Identity)) return xi_mat;
+        if (xi_mat.is(MatrixProperty::Diagonal)) {
+            M xo_inv(xi_mat.matrix());
+            for (std::size_t i{}; i < N; ++i) {
+                assert(std::abs(xo_inv(i, i)) > tracked_detail::Tolerance(xi_mat.matrix()) && " attempting to inverse a not invertiable matrix.");
+                xo_inv(i, i) = static_cast<_T>(1) / xo_inv(i, i);
+            }
+            return TrackedMatrix<M>(xo_inv, properties, tracked_detail::Unchecked{});
+        }
+        if (xi_mat.is(MatrixProperty::Orthonormal)) {
+            return TrackedMatrix<M>(tracked_detail::Transposed(xi_mat.matrix()), properties, tracked_detail::Unchecked{});
+        }
+        if constexpr (N == 4) {
+            if (xi_mat.is(MatrixProperty::Affine)) {
+                return TrackedMatrix<M>(M(Inv(Affine3<_T>(xi_mat.matrix())).dense()), properties, tracked_detail::Unchecked{});
+            }
+        }
+        if (xi_mat.is(MatrixProperty::LowerTriangular)) {
+            return TrackedMatrix<M>(tracked_detail::InvLower(xi_mat.matrix()), properties, tracked_detail::Unchecked{});
+        }
+        if (xi_mat.is(MatrixProperty::UpperTriangular)) {
+            return TrackedMatrix<M>(tracked_detail::Transposed(tracked_detail::InvLower(tracked_detail::Transposed(xi_mat.matrix()))), properties, tracked_detail::Unchecked{});
+        }
+
+        return TrackedMatrix<M>(Inv(xi_mat.matrix()), properties, tracked_detail::Unchecked{});
+    }
+
+    /**
+    * \brief determinant of a tracked matrix (diagonal product for triangular matrices, 3x3 determinant for affine matrices)
+    *
+    * @param {TrackedMatrix, in}  A
+    * @param {T,             out} determinant
+    **/
+    template<typename M>
+    constexpr underlying_type_t<M> Determinant(const TrackedMatrix<M>& xi_mat) noexcept {
+        using _T = underlying_type_t<M>;
+        constexpr std::size_t N{ Rows_v<M> };
+
+        if (xi_mat.is(MatrixProperty::Identity)) return static_cast<_T>(1);
+        if (xi_mat.is(MatrixProperty::LowerTriangular) || xi_mat.is(MatrixProperty::UpperTriangular)) {
+            _T xo_det{ static_cast<_T>(1) };
+            for (std::size_t i{}; i < N; ++i) {
+                xo_det *= xi_mat(i, i);
+            }
+            return xo_det;
+        }
+        if constexpr (N == 4) {
+            if (xi_mat.is(MatrixProperty::Affine)) {
+                return Determinant(Affine3<_T>(xi_mat.matrix()).linear());
+            }
+        }
+
+        return Determinant(xi_mat.matrix());
+    }
+
+    /**
+    * \brief solve A * x = b for a tracked matrix A, dispatched by its properties:
+    *        identity (free), diagonal (O(N)), orthonormal (x = A^T * b), triangular (substitution), otherwise LU decomposition.
+    *
+    * @param {TrackedMatrix, in}  A
+    * @param {VectorBase,    in}  b (column vector)
+    * @param {VectorBase,    out} x (column vector)
+    **/
+    template<typename M>
+    constexpr VectorBase<underlying_type_t<M>, Rows_v<M>> Solve(const TrackedMatrix<M>& xi_A, const VectorBase<underlying_type_t<M>, Rows_v<M>>& xi_b) noexcept {
+        using _T = underlying_type_t<M>;
+        constexpr std::size_t N{ Rows_v<M> };
+
+        if (xi_A.is(MatrixProperty::Identity)) return xi_b;
+
+        VectorBase<_T, N> xo_x(xi_b);
+        if (xi_A.is(MatrixProperty::Diagonal)) {
+            for (std::size_t i{}; i < N; ++i) {
+                xo_x[i] /= xi_A(i, i);
+            }
+        } else if (xi_A.is(MatrixProperty::Orthonormal)) {
+            for (std::size_t c{}; c < N; ++c) {
+                _T sum{};
+                for (std::size_t r{}; r < N; ++r) {
+                    sum += xi_A(c, r) * xi_b[r];
+                }
+                xo_x[c] = sum;
+            }
+        } else if (xi_A.is(MatrixProperty::LowerTriangular)) {
+            for (std::size_t r{}; r < N; ++r) {
+                _T sum{ xo_x[r] };
+                for (std::size_t k{}; k < r; ++k) {
+                    sum -= xi_A(k, r) * xo_x[k];
+                }
+                xo_x[r] = sum / xi_A(r, r);
+            }
+        } else if (xi_A.is(MatrixProperty::UpperTriangular)) {
+            for (std::size_t r{ N }; r-- > 0;) {
+                _T sum{ xo_x[r] };
+                for (std::size_t k{ r + 1 }; k < N; ++k) {
+                    sum -= xi_A(k, r) * xo_x[k];
+                }
+                xo_x[r] = sum / xi_A(r, r);
+            }
+        } else {
+            xo_x = SolveSquareLU(xi_A.matrix(), xi_b);
+        }
+
+        return xo_x;
+    }
+
+}; // namespace GLSLCPP
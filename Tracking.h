@@ -0,0 +1,229 @@
+/**
+* GLSL++
+*
+* opt-in tracking of vector/matrix object lifetimes.
+* when 'GLSLCPP_TRACK_TEMPORARIES' is defined (before including the library), every construction, copy and move
+* of 'VectorBase', 'MatrixBase' and 'Swizzle' objects is counted (per object type) in counters of the calling thread.
+* counts are also attributed to the innermost active expression site ('tracking::Site'), so the temporaries created
+* by a given expression can be inspected.
+* when 'GLSLCPP_TRACK_TEMPORARIES' is not defined, tracking points expand to nothing and special members stay trivial.
+*
+* counts are inclusive, i.e. - constructing (copying) a matrix also constructs (copies) its 'VectorBase' storage, and
+* constructing (copying) a 'Vector2/3/4' constructs (copies) its 'VectorBase' storage.
+* copy assignment is counted as a copy, move assignment is counted as a move.
+* bytes copied (or moved, which for fixed size storage is a copy) by copy and move operations are counted as well.
+*
+* Dan Israel Malta
+**/
+#pragma once
+#include "Instrumentation.h"
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <map>
+#include <string>
+#include <ostream>
+#include <iomanip>
+
+namespace GLSLCPP {
+
+    namespace tracking {
+
+        // tracked object types
+        enum class Type : std::uint8_t {
+            VectorBase = 0,
+            MatrixBase = 1,
+            Swizzle    = 2,
+            Count      = 3
+        };
+
+        // tracked events
+        enum class Event : std::uint8_t {
+            Construction = 0,    // any constructor which is not a copy/move constructor
+            Copy         = 1,    // copy constructor, copy assignment
+            Move         = 2     // move constructor, move assignment
+        };
+
+        // object type name
+        constexpr const char* Name(const Type xi_type) noexcept {
+            constexpr const char* names[] = { "VectorBase", "MatrixBase", "Swizzle" };
+            return (xi_type < Type::Count) ? names[static_cast<std::size_t>(xi_type)] : "";
+        }
+
+        // counters of an object type
+        struct Counter {
+            std::uint64_t constructions{};    // number of constructions (not copy/move)
+            std::uint64_t copies{};           // number of copies
+            std::uint64_t moves{};            // number of moves
+            std::uint64_t bytes{};            // number of bytes copied or moved
+        };
+
+        // counters of all object types
+        using Counters = std::array<Counter, static_cast<std::size_t>(Type::Count)>;
+
+        /**
+        * \brief expression site - counts the objects constructed, copied and moved during its lifetime.
+        *        sites nest; an event is attributed to the innermost site of the calling thread and, when the
+        *        site ends, its counts are added to its enclosing site and to the per name table ('Sites').
+        **/
+        class Site;
+
+        namespace detail {
+            inline Counters& ThreadCounters() noexcept {
+                thread_local Counters counters{};
+                return counters;
+            }
+
+            inline Site*& ThreadSite() noexcept {
+                thread_local Site* site{ nullptr };
+                return site;
+            }
+
+            inline std::map<std::string, Counters>& ThreadSites() {
+                thread_local std::map<std::string, Counters> sites;
+                return sites;
+            }
+
+            inline void Accumulate(Counters& xio_counters, const Counters& xi_counters) noexcept {
+                for (std::size_t i{}; i < xio_counters.size(); ++i) {
+                    xio_counters[i].constructions += xi_counters[i].constructions;
+                    xio_counters[i].copies        += xi_counters[i].copies;
+                    xio_counters[i].moves         += xi_counters[i].moves;
+                    xio_counters[i].bytes         += xi_counters[i].bytes;
+                }
+            }
+
+            inline void Increment(Counter& xio_counter, const Event xi_event, const std::size_t xi_bytes) noexcept {
+                switch (xi_event) {
+                    case Event::Construction: ++xio_counter.constructions; return;
+                    case Event::Copy:         ++xio_counter.copies;        break;
+                    case Event::Move:         ++xio_counter.moves;         break;
+                }
+                xio_counter.bytes += xi_bytes;
+            }
+        };
+
+        class Site {
+            // properties
+            private:
+                std::string m_name;
+                Site* m_parent;
+                Counters m_counters{};
+
+            // constructors
+            public:
+                explicit Site(std::string xi_name) : m_name(std::move(xi_name)), m_parent(detail::ThreadSite()) {
+                    detail::ThreadSite() = this;
+                }
+
+                ~Site() {
+                    detail::ThreadSite() = m_parent;
+                    if (m_parent != nullptr) {
+                        detail::Accumulate(m_parent->m_counters, m_counters);
+                    }
+                    detail::Accumulate(detail::ThreadSites()[m_name], m_counters);
+                }
+
+                Site(const Site&)            = delete;
+                Site& operator=(const Site&) = delete;
+                Site(Site&&)                 = delete;
+                Site& operator=(Site&&)      = delete;
+
+            // methods
+            public:
+
+                // site name
+                const std::string& name() const noexcept { return m_name; }
+
+                // counts accumulated so far in this site (including ended nested sites)
+                const Counters& counters() const noexcept { return m_counters; }
+
+                // counts of a given object type accumulated so far in this site
+                const Counter& counter(const Type xi_type) const noexcept { return m_counters[static_cast<std::size_t>(xi_type)]; }
+
+                // record an event in this site
+                void record(const Type xi_type, const Event xi_event, const std::size_t xi_bytes) noexcept {
+                    detail::Increment(m_counters[static_cast<std::size_t>(xi_type)], xi_event, xi_bytes);
+                }
+        };
+
+        /**
+        * \brief record an event (in calling thread counters and innermost site)
+        *
+        * @param {Type,   in} object type
+        * @param {Event,  in} event
+        * @param {size_t, in} object size in bytes (counted for copies and moves)
+        **/
+        inline void Record(const Type xi_type, const Event xi_event, const std::size_t xi_bytes) noexcept {
+            detail::Increment(detail::ThreadCounters()[static_cast<std::size_t>(xi_type)], xi_event, xi_bytes);
+            if (Site* site{ detail::ThreadSite() }; site != nullptr) {
+                site->record(xi_type, xi_event, xi_bytes);
+            }
+        }
+
+        // return a copy of calling thread counters
+        inline Counters Snapshot() noexcept {
+            return detail::ThreadCounters();
+        }
+
+        // return a copy of calling thread per site counters (of ended sites, accumulated by site name)
+        inline std::map<std::string, Counters> Sites() {
+            return detail::ThreadSites();
+        }
+
+        // reset calling thread counters and per site counters
+        inline void Reset() {
+            detail::ThreadCounters() = Counters{};
+            detail::ThreadSites().clear();
+        }
+
+        /**
+        * \brief write a table of counters (only object types which were tracked).
+        *        stream formatting (flags) is restored on return.
+        *
+        * @param {ostream,  in|out} stream
+        * @param {Counters, in}     counters (calling thread counters by default)
+        **/
+        inline void Report(std::ostream& xio_stream, const Counters& xi_counters = Snapshot()) {
+            const std::ios_base::fmtflags flags{ xio_stream.flags() };
+
+            xio_stream << std::left << std::setw(14) << "object" << std::right << std::setw(16) << "constructions"
+                       << std::setw(14) << "copies" << std::setw(14) << "moves" << std::setw(14) << "bytes" << '\n';
+            for (std::size_t i{}; i < xi_counters.size(); ++i) {
+                const Counter& counter{ xi_counters[i] };
+                if (counter.constructions + counter.copies + counter.moves == 0) continue;
+
+                xio_stream << std::left << std::setw(14) << Name(static_cast<Type>(i)) << std::right << std::setw(16) << counter.constructions
+                           << std::setw(14) << counter.copies << std::setw(14) << counter.moves << std::setw(14) << counter.bytes << '\n';
+            }
+
+            xio_stream.flags(flags);
+        }
+
+        /**
+        * \brief write a table of counters per expression site
+        *
+        * @param {ostream, in|out} stream
+        * @param {map,     in}     per site counters (calling thread per site counters by default)
+        **/
+        inline void Report(std::ostream& xio_stream, const std::map<std::string, Counters>& xi_sites) {
+            for (const auto& site : xi_sites) {
+                xio_stream << site.first << ":\n";
+                Report(xio_stream, site.second);
+            }
+        }
+    };
+
+}; // namespace GLSLCPP
+
+// tracking point: GLSLCPP_TRACK(object type, event), placed in the special members of the tracked object (whose size is recorded)
+#ifdef GLSLCPP_TRACK_TEMPORARIES
+#define GLSLCPP_TRACK(TYPE, EVENT)                                                                                             \
+    do {                                                                                                                       \
+        if (!GLSLCPP_CONSTANT_EVALUATED()) {                                                                                   \
+            ::GLSLCPP::tracking::Record(::GLSLCPP::tracking::Type::TYPE, ::GLSLCPP::tracking::Event::EVENT, sizeof(*this));    \
+        }                                                                                                                      \
+    } while (false)
+#else
+#define GLSLCPP_TRACK(TYPE, EVENT) do {} while (false)
+#endif
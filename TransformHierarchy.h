@@ -0,0 +1,318 @@
+/**
+* GLSL++
+*
+* flat transformation hierarchy (scene graph) whose world transformations are propagated from parents to children.
+* nodes are stored in breadth first order as separate arrays of parent index, local and world transformation and dirty flag,
+* so every level is a contiguous range whose nodes depend only on the previous level (and can be updated in parallel),
+* and the children of a contiguous range of nodes are a contiguous range of the next level.
+*
+* Dan Israel Malta
+**/
+#pragma once
+#include "common.h"
+#include "MatrixBase.h"
+#include "Parallel.h"
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <utility>
+#include <cstdint>
+
+namespace GLSLCPP {
+
+    namespace hierarchy_detail {
+
+        /**
+        * \brief C = A * B for column major 4x4 matrices.
+        *        every column of C is a linear combination of the columns of A, so it maps to four wide multiply-adds.
+        *
+        * @param {T*, in}  A
+        * @param {T*, in}  B
+        * @param {T*, out} C
+        **/
+        template<typename T>
+        constexpr void Multiply4x4(const T* a, const T* b, T* c) noexcept {
+            // accumulate in registers, so stores to C do not force A and B to be reloaded
+            T out[16]{};
+            for (std::size_t j{}; j < 4; ++j) {
+                const T b0{ b[j * 4] },
+                        b1{ b[j * 4 + 1] },
+                        b2{ b[j * 4 + 2] },
+                        b3{ b[j * 4 + 3] };
+                for (std::size_t r{}; r < 4; ++r) {
+                    out[j * 4 + r] = a[r] * b0 + a[4 + r] * b1 + a[8 + r] * b2 + a[12 + r] * b3;
+                }
+            }
+            for (std::size_t i{}; i < 16; ++i) {
+                c[i] = out[i];
+            }
+        }
+    };
+
+    /**
+    * \brief hierarchy of 4x4 transformations, where world transformation of a node is its parent world transformation
+    *        multiplied by its own local transformation (world transformation of a root is its local transformation).
+    *
+    *        nodes are identified by the index returned from 'add' (a parent must be added before its children).
+    *        changing a local transformation marks the node as dirty, and 'update' recomputes the world transformations
+    *        of dirty nodes and their descendants only, one level at a time, distributing every level among the library thread pool.
+    *
+    * @param {T, in} underlying type
+    **/
+    template<typename T = float> class TransformHierarchy {
+        static_assert(std::is_floating_point<T>::value, "TransformHierarchy<T> - T must be of floating point type.");
+
+        // aliases
+    public:
+        using matrix_type = MatrixBase<T, 4, 4>;
+        static constexpr std::size_t npos{ std::numeric_limits<std::size_t>::max() };    // parent of a root
+
+        // properties
+    private:
+        // per slot (breadth first ordered) storage
+        std::vector<std::size_t> m_parent;                                // slot of parent (npos for roots)
+        std::vector<matrix_type> m_local;                                 // local transformation
+        std::vector<matrix_type> m_world;                                 // world transformation
+        std::vector<std::uint8_t> m_dirty;                                // world transformation should be recomputed
+        std::vector<std::size_t> m_depth;                                 // depth (0 for roots)
+        std::vector<std::size_t> m_node;                                  // node of a slot
+        std::vector<std::size_t> m_childStart;                            // children of slots [a, b) occupy slots [m_childStart[a], m_childStart[b])
+
+        // per node/level storage
+        std::vector<std::size_t> m_slot;                                  // slot of a node
+        std::vector<std::pair<std::size_t, std::size_t>> m_dirtyRange;    // range of slots whose local transformation changed, per level
+        std::size_t m_levels{};                                           // number of levels
+        std::size_t m_firstDirtyLevel{ npos };                            // first level with a changed local transformation
+        bool m_ordered{ true };                                           // slots are breadth first ordered
+
+        // constructors
+    public:
+
+        TransformHierarchy() : m_childStart{ 0 } {}
+
+        TransformHierarchy(const TransformHierarchy&) = default;
+        TransformHierarchy(TransformHierarchy&&) noexcept = default;
+        TransformHierarchy& operator=(const TransformHierarchy&) = default;
+        TransformHierarchy& operator=(TransformHierarchy&&) noexcept = default;
+
+        // accessors
+    public:
+
+        std::size_t size() const noexcept { return m_slot.size(); }
+        std::size_t parent(const std::size_t xi_node) const noexcept {
+            assert(xi_node < size() && " TransformHierarchy - node does not exist.");
+            const std::size_t p{ m_parent[m_slot[xi_node]] };
+            return (p == npos) ? npos : m_node[p];
+        }
+        const matrix_type& local(const std::size_t xi_node) const noexcept {
+            assert(xi_node < size() && " TransformHierarchy - node does not exist.");
+            return m_local[m_slot[xi_node]];
+        }
+
+        // world transformation (as of last 'update')
+        const matrix_type& world(const std::size_t xi_node) const noexcept {
+            assert(xi_node < size() && " TransformHierarchy - node does not exist.");
+            return m_world[m_slot[xi_node]];
+        }
+
+        // depth of a node (0 for roots)
+        std::size_t depth(const std::size_t xi_node) const noexcept {
+            assert(xi_node < size() && " TransformHierarchy - node does not exist.");
+            return m_depth[m_slot[xi_node]];
+        }
+
+        // methods
+    public:
+
+        /**
+        * \brief add a node
+        *
+        * @param {matrix_type, in}  local transformation
+        * @param {size_t,      in}  parent node (npos for a root; must already exist)
+        * @param {size_t,      out} node
+        **/
+        std::size_t add(const matrix_type& xi_local, const std::size_t xi_parent = npos) {
+            assert((xi_parent == npos || xi_parent < size()) && " TransformHierarchy::add - parent must be added before its children.");
+            const std::size_t node{ size() },
+                              parent{ (xi_parent == npos) ? npos : m_slot[xi_parent] };
+
+            // appended slots keep parents ahead of their children, but break breadth first order until next 'update'
+            m_slot.push_back(m_local.size());
+            m_parent.push_back(parent);
+            m_local.push_back(xi_local);
+            m_world.push_back(xi_local);
+            m_dirty.push_back(1);
+            m_depth.push_back((parent == npos) ? 0 : m_depth[parent] + 1);
+            m_node.push_back(node);
+            m_ordered = false;
+            return node;
+        }
+
+        /**
+        * \brief set local transformation of a node (world transformations of it and its descendants are recomputed at next 'update')
+        *
+        * @param {size_t,      in} node
+        * @param {matrix_type, in} local transformation
+        **/
+        void setLocal(const std::size_t xi_node, const matrix_type& xi_local) noexcept {
+            assert(xi_node < size() && " TransformHierarchy - node does not exist.");
+            const std::size_t slot{ m_slot[xi_node] };
+            m_local[slot] = xi_local;
+            m_dirty[slot] = 1;
+
+            // changed ranges are rebuilt when slots are ordered
+            if (m_ordered) {
+                const std::size_t level{ m_depth[slot] };
+                auto& range = m_dirtyRange[level];
+                range.first = std::min(range.first, slot);
+                range.second = std::max(range.second, slot + 1);
+                m_firstDirtyLevel = std::min(m_firstDirtyLevel, level);
+            }
+        }
+
+        /**
+        * \brief recompute world transformations of dirty nodes and their descendants.
+        *        levels are processed in order, starting at the first level with a changed local transformation.
+        *        at every level only the children of the range visited at previous level and the changed nodes are visited,
+        *        and they are distributed among the library thread pool.
+        *
+        * @param {size_t, out} number of world transformations which were recomputed
+        **/
+        std::size_t update() {
+            order();
+
+            constexpr std::size_t GRAIN{ 1024 };
+            std::atomic<std::size_t> updated{ 0 };
+            std::size_t previousFirst{},
+                        previousLast{};
+            for (std::size_t d{ m_firstDirtyLevel }; d < m_levels; ++d) {
+                // children of range visited at previous level, extended to the nodes whose local transformation changed
+                std::size_t first{ m_childStart[previousFirst] },
+                            last{ m_childStart[previousLast] };
+                auto& changed = m_dirtyRange[d];
+                if (changed.first < changed.second) {
+                    first = (first < last) ? std::min(first, changed.first) : changed.first;
+                    last = std::max(last, changed.second);
+                }
+                changed = { npos, 0 };
+
+                ParallelFor(last - first, GRAIN, [this, first, &updated](const std::size_t xi_first, const std::size_t xi_last) {
+                    // raw pointers, since stores to flags (bytes) might otherwise alias the vectors
+                    const std::size_t* parent{ m_parent.data() };
+                    const matrix_type* local{ m_local.data() };
+                    matrix_type* world{ m_world.data() };
+                    std::uint8_t* dirty{ m_dirty.data() };
+
+                    std::size_t count{};
+                    for (std::size_t s{ first + xi_first }; s < first + xi_last; ++s) {
+                        const std::size_t p{ parent[s] };
+
+                        if (p == npos) {
+                            if (dirty[s] == 0) continue;
+                            world[s] = local[s];
+                        }
+                        else {
+                            if ((dirty[s] | dirty[p]) == 0) continue;
+                            hierarchy_detail::Multiply4x4(world[p].m_data.m_data.data(), local[s].m_data.m_data.data(), world[s].m_data.m_data.data());
+                            dirty[s] = 1;
+                        }
+                        ++count;
+                    }
+                    updated += count;
+                });
+
+                // previous level flags are no longer needed
+                std::fill(m_dirty.begin() + static_cast<std::ptrdiff_t>(previousFirst), m_dirty.begin() + static_cast<std::ptrdiff_t>(previousLast), std::uint8_t{});
+                previousFirst = first;
+                previousLast = last;
+            }
+            std::fill(m_dirty.begin() + static_cast<std::ptrdiff_t>(previousFirst), m_dirty.begin() + static_cast<std::ptrdiff_t>(previousLast), std::uint8_t{});
+            m_firstDirtyLevel = npos;
+
+            return updated;
+        }
+
+        // internal helpers
+    private:
+
+        // rearrange slots in breadth first order (roots and siblings keep their relative order)
+        void order() {
+            if (m_ordered) return;
+            const std::size_t count{ m_local.size() };
+
+            // children of every slot (compressed, in slot order)
+            std::vector<std::size_t> start(count + 1, 0),
+                                     children(count);
+            for (std::size_t s{}; s < count; ++s) {
+                if (m_parent[s] != npos) {
+                    ++start[m_parent[s] + 1];
+                }
+            }
+            for (std::size_t s{}; s < count; ++s) {
+                start[s + 1] += start[s];
+            }
+            {
+                std::vector<std::size_t> next(start.begin(), start.end() - 1);
+                for (std::size_t s{}; s < count; ++s) {
+                    if (m_parent[s] != npos) {
+                        children[next[m_parent[s]]++] = s;
+                    }
+                }
+            }
+
+            // breadth first traversal ('sorted[new slot] = old slot')
+            std::vector<std::size_t> sorted;
+            sorted.reserve(count);
+            for (std::size_t s{}; s < count; ++s) {
+                if (m_parent[s] == npos) {
+                    sorted.push_back(s);
+                }
+            }
+            m_childStart.assign(count + 1, count);
+            for (std::size_t i{}; i < count; ++i) {
+                const std::size_t s{ sorted[i] };
+                m_childStart[i] = sorted.size();
+                sorted.insert(sorted.end(), children.begin() + static_cast<std::ptrdiff_t>(start[s]), children.begin() + static_cast<std::ptrdiff_t>(start[s + 1]));
+            }
+
+            std::vector<std::size_t> target(count);
+            for (std::size_t i{}; i < count; ++i) {
+                target[sorted[i]] = i;
+            }
+            const auto permute = [&sorted, count](auto& xio_array) {
+                std::remove_reference_t<decltype(xio_array)> permuted(count);
+                for (std::size_t i{}; i < count; ++i) {
+                    permuted[i] = xio_array[sorted[i]];
+                }
+                xio_array.swap(permuted);
+            };
+            permute(m_local);
+            permute(m_world);
+            permute(m_dirty);
+            permute(m_depth);
+            permute(m_node);
+            permute(m_parent);
+            for (std::size_t i{}; i < count; ++i) {
+                if (m_parent[i] != npos) {
+                    m_parent[i] = target[m_parent[i]];
+                }
+                m_slot[m_node[i]] = i;
+            }
+
+            // changed ranges
+            m_levels = (count > 0) ? m_depth.back() + 1 : 0;
+            m_dirtyRange.assign(m_levels, { npos, 0 });
+            m_firstDirtyLevel = npos;
+            for (std::size_t i{}; i < count; ++i) {
+                if (m_dirty[i] == 0) continue;
+                auto& range = m_dirtyRange[m_depth[i]];
+                range.first = std::min(range.first, i);
+                range.second = i + 1;
+                m_firstDirtyLevel = std::min(m_firstDirtyLevel, m_depth[i]);
+            }
+            m_ordered = true;
+        }
+    };
+
+}; // namespace GLSLCPP
@@ -84,6 +84,15 @@ namespace GLSLCPP {
             });
         }
 
+#ifdef GLSLCPP_TRACK_TEMPORARIES
+        // copy semantics (tracked 'VectorBase' storage has non trivial copy/move, so they are forwarded to it)
+        constexpr Vector2(const Vector2& xi_vec) : m_data(xi_vec.m_data) {}
+        constexpr Vector2& operator=(const Vector2& xi_vec) { m_data = xi_vec.m_data; return *this; }
+
+        // move semantics
+        constexpr Vector2(Vector2&& xi_vec) noexcept : m_data(std::move(xi_vec.m_data)) {}
+        constexpr Vector2& operator=(Vector2&& xi_vec) noexcept { m_data = std::move(xi_vec.m_data); return *this; }
+#else
         // copy semantics
         Vector2(const Vector2&)            = default;
         Vector2& operator=(const Vector2&) = default;
@@ -91,6 +100,7 @@ namespace GLSLCPP {
         // move semantics
         Vector2(Vector2&&)            noexcept = default;
         Vector2& operator=(Vector2&&) noexcept = default;
+#endif
 
         // cast as VectorBase
         template<typename U> operator VectorBase<U, 2>() const {
@@ -198,6 +198,15 @@ namespace GLSLCPP {
             });
         }
 
+#ifdef GLSLCPP_TRACK_TEMPORARIES
+        // copy semantics (tracked 'VectorBase' storage has non trivial copy/move, so they are forwarded to it)
+        constexpr Vector3(const Vector3& xi_vec) : m_data(xi_vec.m_data) {}
+        constexpr Vector3& operator=(const Vector3& xi_vec) { m_data = xi_vec.m_data; return *this; }
+
+        // move semantics
+        constexpr Vector3(Vector3&& xi_vec) noexcept : m_data(std::move(xi_vec.m_data)) {}
+        constexpr Vector3& operator=(Vector3&& xi_vec) noexcept { m_data = std::move(xi_vec.m_data); return *this; }
+#else
         // copy semantics
         Vector3(const Vector3&)            = default;
         Vector3& operator=(const Vector3&) = default;
@@ -205,6 +214,7 @@ namespace GLSLCPP {
         // move semantics
         Vector3(Vector3&&)            noexcept = default;
         Vector3& operator=(Vector3&&) noexcept = default;
+#endif
 
         // casting
         template<typename U> operator VectorBase<U, 3>() const {
@@ -1116,6 +1116,15 @@ template<typename T> union Vector4 {
             });
         }
 
+#ifdef GLSLCPP_TRACK_TEMPORARIES
+        // copy semantics (tracked 'VectorBase' storage has non trivial copy/move, so they are forwarded to it)
+        constexpr Vector4(const Vector4& xi_vec) : m_data(xi_vec.m_data) {}
+        constexpr Vector4& operator=(const Vector4& xi_vec) { m_data = xi_vec.m_data; return *this; }
+
+        // move semantics
+        constexpr Vector4(Vector4&& xi_vec) noexcept : m_data(std::move(xi_vec.m_data)) {}
+        constexpr Vector4& operator=(Vector4&& xi_vec) noexcept { m_data = std::move(xi_vec.m_data); return *this; }
+#else
         // copy semantics
         Vector4(const Vector4&)            = default;
         Vector4& operator=(const Vector4&) = default;
@@ -1123,6 +1132,7 @@ template<typename T> union Vector4 {
         // move semantics
         Vector4(Vector4&&)            noexcept = default;
         Vector4& operator=(Vector4&&) noexcept = default;
+#endif
 
         // cast
         template<typename U> operator VectorBase<U, 4>() const {
@@ -31,31 +31,35 @@ namespace GLSLCPP {
     public:
 
         // default constructor
-        VectorBase() : m_data() {}
+        VectorBase() : m_data() { GLSLCPP_TRACK(VectorBase, Construction); }
 
         // construct using a single value
         template<typename U> explicit constexpr
         VectorBase(const U xi_value = U{}, REQUIRE(is_ArithmeticConvertible_v<U, T>)) {
+            GLSLCPP_TRACK(VectorBase, Construction);
             m_data.fill(static_cast<T>(xi_value));
         }
 
         // construct using N individual values (of same type)
         template<typename ...Us, REQUIRE((sizeof...(Us) == N) && Are_ArithmeticConvertible<T, Us...>::value)>
-        explicit constexpr VectorBase(Us... xi_values) : m_data({ static_cast<T>(xi_values)... }) {}
+        explicit constexpr VectorBase(Us... xi_values) : m_data({ static_cast<T>(xi_values)... }) { GLSLCPP_TRACK(VectorBase, Construction); }
 
         // construct from a swizzle
         template<typename U> explicit constexpr VectorBase(U&& s, REQUIRE(is_SwizzleOfLength_v<U, N>)) noexcept {
+            GLSLCPP_TRACK(VectorBase, Construction);
             s.Pack(std::forward<U>(m_data));
         }
 
         // construct from any Vector object (copied object size must be equal or larger to constructed one size)
         template<typename U> explicit constexpr VectorBase(const U& v, REQUIRE(Is_VectorOfLength_v<U, N>)) {
+            GLSLCPP_TRACK(VectorBase, Construction);
             for_each(m_data, [&, i = 0](auto & elm) mutable {
                 elm = static_cast<T>(v[i]);
                 ++i;
             });
         }
         template<typename U> explicit constexpr VectorBase(U&& v, REQUIRE(Is_VectorOfLength_v<U, N>)) noexcept {
+            GLSLCPP_TRACK(VectorBase, Construction);
             for_each(m_data, [&, i = 0](auto & elm) mutable {
                 elm = static_cast<T>(std::move(v[i]));
                 ++i;
@@ -64,12 +68,14 @@ namespace GLSLCPP {
 
         // construct based upon a function whos input argument is element index
         constexpr explicit VectorBase(const std::function<T(std::size_t)>& xi_func) {
+            GLSLCPP_TRACK(VectorBase, Construction);
             for_each(m_data, [&, i = 0](auto & elm) mutable {
                 elm = xi_func(i);
                 ++i;
             });
         }
         constexpr explicit VectorBase(std::function<T(std::size_t)>&& xi_func) noexcept {
+            GLSLCPP_TRACK(VectorBase, Construction);
             for_each(m_data, [&, i = 0](auto & elm) mutable {
                 elm = xi_func(i);
                 ++i;
@@ -92,6 +98,23 @@ namespace GLSLCPP {
             return *this;
         }
 
+#ifdef GLSLCPP_TRACK_TEMPORARIES
+        // copy semantics (tracked)
+        constexpr VectorBase(const VectorBase& xi_vec) : m_data(xi_vec.m_data) { GLSLCPP_TRACK(VectorBase, Copy); }
+        constexpr VectorBase& operator=(const VectorBase& xi_vec) {
+            m_data = xi_vec.m_data;
+            GLSLCPP_TRACK(VectorBase, Copy);
+            return *this;
+        }
+
+        // move semantics (tracked)
+        constexpr VectorBase(VectorBase&& xi_vec) noexcept : m_data(std::move(xi_vec.m_data)) { GLSLCPP_TRACK(VectorBase, Move); }
+        constexpr VectorBase& operator=(VectorBase&& xi_vec) noexcept {
+            m_data = std::move(xi_vec.m_data);
+            GLSLCPP_TRACK(VectorBase, Move);
+            return *this;
+        }
+#else
         // copy semantics
         VectorBase(const VectorBase&) = default;
         VectorBase& operator=(const VectorBase&) = default;
@@ -99,6 +122,7 @@ namespace GLSLCPP {
         // move semantics
         VectorBase(VectorBase&&)            noexcept = default;
         VectorBase& operator=(VectorBase&&) noexcept = default;
+#endif
 
         // operator overloading
     public:
@@ -0,0 +1,869 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++, C#, and Java: http://www.viva64.com
+#include "GLSL++.h"
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <memory>
+#include <cmath>
+
+using namespace GLSLCPP;
+
+/**
+* \brief return the average execution time (in seconds) of a given callable
+*
+* @param {function, in}  callable to measure
+* @param {size_t,   in}  amount of repetitions
+* @param {double,   out} average execution time [sec]
+**/
+template<class Fn> double Measure(Fn&& xi_function, const std::size_t xi_repetitions) {
+    xi_function();  // warm up
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (std::size_t i{}; i < xi_repetitions; ++i) {
+        xi_function();
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    return std::chrono::duration<double>(end - start).count() / static_cast<double>(xi_repetitions);
+}
+
+// prevent the optimizer from discarding a benchmarked value
+template<typename T> void DoNotOptimize(const T xi_value) {
+    static volatile T sink;
+    sink = xi_value;
+    (void)sink;
+}
+
+// -----------------------
+// --- noise benchmark ---
+// -----------------------
+void NoiseBenchmark() {
+    constexpr std::size_t count{ 1 << 16 };
+    std::vector<float> x(count), y(count), z(count), out(count);
+    for (std::size_t i{}; i < count; ++i) {
+        x[i] = static_cast<float>(i % 256) * 0.173f;
+        y[i] = static_cast<float>(i / 256) * 0.219f;
+        z[i] = static_cast<float>(i % 17) * 0.311f;
+    }
+    const std::array<const float*, 3> coordinates{ x.data(), y.data(), z.data() };
+
+    const auto report = [count](const char* xi_name, const double xi_seconds) {
+        std::cout << "  " << xi_name << ": " << static_cast<double>(count) / xi_seconds * 1e-6 << " Msamples/sec" << std::endl;
+    };
+
+    std::cout << "noise (3D, " << count << " samples):" << std::endl;
+    report("gradient, per sample", Measure([&]() {
+        for (std::size_t i{}; i < count; ++i) out[i] = GradientNoise(vec3(x[i], y[i], z[i]));
+        DoNotOptimize(out.back());
+    }, 20));
+    report("gradient, batch     ", Measure([&]() { GradientNoise(coordinates, out.data(), count); DoNotOptimize(out.back()); }, 20));
+    report("value, batch        ", Measure([&]() { ValueNoise(coordinates, out.data(), count);    DoNotOptimize(out.back()); }, 20));
+    report("simplex, batch      ", Measure([&]() { SimplexNoise(coordinates, out.data(), count);  DoNotOptimize(out.back()); }, 20));
+    report("worley, batch       ", Measure([&]() { WorleyNoise(coordinates, out.data(), count);   DoNotOptimize(out.back()); }, 20));
+    report("fbm (5 octaves)     ", Measure([&]() { fbm(coordinates, out.data(), count, 5);        DoNotOptimize(out.back()); }, 20));
+}
+
+// -------------------------
+// --- texture benchmark ---
+// -------------------------
+
+// sample a texture over a rotated grid (rows of the grid are traversed along the rotated direction)
+template<TextureLayout LAYOUT> double RotatedSampling(const Texture2D<float, LAYOUT>& xi_texture, const float xi_angle, const std::size_t xi_samples) {
+    const float c{ std::cos(xi_angle) / static_cast<float>(xi_samples) },
+                s{ std::sin(xi_angle) / static_cast<float>(xi_samples) };
+    std::vector<float> u(xi_samples), v(xi_samples), out(xi_samples);
+
+    return Measure([&]() {
+        for (std::size_t j{}; j < xi_samples; ++j) {
+            const float y{ static_cast<float>(j) - 0.5f * static_cast<float>(xi_samples) };
+            for (std::size_t i{}; i < xi_samples; ++i) {
+                const float x{ static_cast<float>(i) - 0.5f * static_cast<float>(xi_samples) };
+                u[i] = 0.5f + c * x - s * y;
+                v[i] = 0.5f + s * x + c * y;
+            }
+            xi_texture.Sample(u.data(), v.data(), out.data(), xi_samples);
+            DoNotOptimize(out.back());
+        }
+    }, 3);
+}
+
+void TextureBenchmark() {
+    constexpr std::size_t size{ 2048 };
+    std::vector<float> texels(size * size);
+    for (std::size_t i{}; i < texels.size(); ++i) {
+        texels[i] = static_cast<float>(i % 251);
+    }
+
+    Texture2D<float, TextureLayout::Linear> linear(size, size, texels.data(), false);
+    Texture2D<float, TextureLayout::Morton> tiled(size, size, texels.data(), false);
+
+    std::cout << "texture (" << size << "x" << size << ", bilinear, rotated access):" << std::endl;
+    for (const float degrees : { 0.0f, 30.0f, 60.0f, 90.0f }) {
+        const float angle{ degrees * 3.14159265f / 180.0f };
+        const double samples{ static_cast<double>(size * size) },
+                     linearTime{ RotatedSampling(linear, angle, size) },
+                     tiledTime{ RotatedSampling(tiled, angle, size) };
+        std::cout << "  " << degrees << " deg: linear " << samples / linearTime * 1e-6 << " Msamples/sec, "
+                  << "tiled " << samples / tiledTime * 1e-6 << " Msamples/sec" << std::endl;
+    }
+}
+
+// ---------------------
+// --- SVD benchmark ---
+// ---------------------
+template<std::size_t N> void SVDBenchmarkOfSize() {
+    // matrices are allocated on the heap (a 128x128 double matrix occupies 128KB)
+    auto A = std::make_unique<MatrixBase<double, N, N>>(0.0);
+    auto U = std::make_unique<MatrixBase<double, N, N>>(0.0);
+    auto V = std::make_unique<MatrixBase<double, N, N>>();
+    VectorBase<double, N> S;
+    for (std::size_t i{}; i < N * N; ++i) {
+        A->m_data[i] = std::sin(static_cast<double>(i) * 0.731) + ((i % (N + 1)) == 0 ? 2.0 : 0.0);
+    }
+
+    const double fast{ Measure([&]() { SVDfast(*A, *U, S, *V); DoNotOptimize(S[0]); }, 3) },
+                 jacobi{ Measure([&]() { SVDjacobi(*A, *U, S, *V); DoNotOptimize(S[0]); }, 3) };
+    std::cout << "  " << N << "x" << N << ": SVDfast " << fast * 1e3 << " [ms], SVDjacobi " << jacobi * 1e3 << " [ms]" << std::endl;
+}
+
+void SVDBenchmark() {
+    std::cout << "SVD (" << ThreadPool::Instance().Size() << " threads):" << std::endl;
+    SVDBenchmarkOfSize<32>();
+    SVDBenchmarkOfSize<64>();
+    SVDBenchmarkOfSize<128>();
+}
+
+// -----------------------------------------------------------
+// --- givens rotation / householder reflection (in place) ---
+// -----------------------------------------------------------
+template<std::size_t N> void ReflectionBenchmarkOfSize() {
+    auto A = std::make_unique<MatrixBase<double, N, N>>(0.0);
+    for (std::size_t i{}; i < N * N; ++i) {
+        A->m_data[i] = std::sin(static_cast<double>(i) * 0.731);
+    }
+    VectorBase<double, N> v;
+    for (std::size_t i{}; i < N; ++i) {
+        v[i] = std::cos(static_cast<double>(i) * 0.377);
+    }
+    v = Normalize(v);
+    const double c{ std::cos(0.3) },
+                 s{ std::sin(0.3) };
+
+    const double givensDense{ Measure([&]() { *A = GivensRotation<double, N>(c, s, N / 2) * *A; DoNotOptimize(A->m_data[0]); }, 20) },
+                 givensInPlace{ Measure([&]() { ApplyGivens(*A, N / 2, N / 2 + 1, c, s); DoNotOptimize(A->m_data[0]); }, 20) },
+                 householderDense{ Measure([&]() { *A = Householder(v) * *A; DoNotOptimize(A->m_data[0]); }, 20) },
+                 householderInPlace{ Measure([&]() { ApplyHouseholder(*A, v, 2.0); DoNotOptimize(A->m_data[0]); }, 20) };
+    std::cout << "  " << N << "x" << N << ": givens - dense " << givensDense * 1e6 << " [us], in place " << givensInPlace * 1e6 << " [us]; "
+              << "householder - dense " << householderDense * 1e6 << " [us], in place " << householderInPlace * 1e6 << " [us]" << std::endl;
+}
+
+void ReflectionBenchmark() {
+    std::cout << "givens rotation / householder reflection:" << std::endl;
+    ReflectionBenchmarkOfSize<16>();
+    ReflectionBenchmarkOfSize<64>();
+    ReflectionBenchmarkOfSize<128>();
+}
+
+// ----------------------------------------------
+// --- rank updates (covariance accumulation) ---
+// ----------------------------------------------
+template<std::size_t N> void RankUpdateBenchmarkOfSize() {
+    constexpr std::size_t COUNT{ 256 };
+    auto A = std::make_unique<MatrixBase<double, N, N>>(0.0);
+    std::vector<VectorBase<double, N>> samples(COUNT);
+    for (std::size_t k{}; k < COUNT; ++k) {
+        for (std::size_t i{}; i < N; ++i) {
+            samples[k][i] = std::sin(static_cast<double>(k * N + i) * 0.173);
+        }
+    }
+
+    const double outer{ Measure([&]() { for (const auto& x : samples) *A += OuterProduct(x, x); DoNotOptimize(A->m_data[0]); }, 5) },
+                 ger{ Measure([&]() { for (const auto& x : samples) RankOneUpdate(*A, 1.0, x, x); DoNotOptimize(A->m_data[0]); }, 5) },
+                 syr{ Measure([&]() { for (const auto& x : samples) SymmetricRankOneUpdate(*A, 1.0, x); DoNotOptimize(A->m_data[0]); }, 5) },
+                 gerk{ Measure([&]() { RankKUpdate(*A, 1.0, samples.begin(), samples.end(), samples.begin()); DoNotOptimize(A->m_data[0]); }, 5) },
+                 syrk{ Measure([&]() { SymmetricRankKUpdate(*A, 1.0, samples.begin(), samples.end()); DoNotOptimize(A->m_data[0]); }, 5) };
+    std::cout << "  " << N << "x" << N << " (" << COUNT << " vectors): A += OuterProduct " << outer * 1e3 << " [ms], RankOneUpdate " << ger * 1e3
+              << " [ms], SymmetricRankOneUpdate " << syr * 1e3 << " [ms], RankKUpdate " << gerk * 1e3 << " [ms], SymmetricRankKUpdate " << syrk * 1e3 << " [ms]" << std::endl;
+}
+
+void RankUpdateBenchmark() {
+    std::cout << "rank updates:" << std::endl;
+    RankUpdateBenchmarkOfSize<16>();
+    RankUpdateBenchmarkOfSize<64>();
+    RankUpdateBenchmarkOfSize<128>();
+}
+
+// --------------------------------------------------
+// --- structured solvers (Toeplitz, VanDerMonde) ---
+// --------------------------------------------------
+template<std::size_t N> void StructuredSolverBenchmarkOfSize() {
+    VectorBase<double, N> t, v, b;
+    for (std::size_t i{}; i < N; ++i) {
+        t[i] = std::pow(0.7, static_cast<double>(i));
+        v[i] = -1.0 + 2.0 * static_cast<double>(i) / static_cast<double>(N - 1);
+        b[i] = std::sin(static_cast<double>(i) * 0.3);
+    }
+
+    const double toeplitzLU{ Measure([&]() { auto A = std::make_unique<MatrixBase<double, N, N>>(Toeplitz(t)); DoNotOptimize(SolveSquareLU(*A, b)[0]); }, 20) },
+                 levinson{ Measure([&]() { DoNotOptimize(SolveToeplitz(t, b)[0]); }, 20) },
+                 vanDerMondeLU{ Measure([&]() { auto A = std::make_unique<MatrixBase<double, N, N>>(Transpose(VanDerMonde(v))); DoNotOptimize(SolveSquareLU(*A, b)[0]); }, 20) },
+                 bjorckPereyra{ Measure([&]() { DoNotOptimize(SolveVanDerMondeTransposed(v, b)[0]); }, 20) };
+    std::cout << "  " << N << ": Toeplitz - LU " << toeplitzLU * 1e6 << " [us], Levinson " << levinson * 1e6 << " [us]; "
+              << "interpolation - LU " << vanDerMondeLU * 1e6 << " [us], Bjorck-Pereyra " << bjorckPereyra * 1e6 << " [us]" << std::endl;
+}
+
+void StructuredSolverBenchmark() {
+    std::cout << "structured solvers:" << std::endl;
+    StructuredSolverBenchmarkOfSize<16>();
+    StructuredSolverBenchmarkOfSize<64>();
+    StructuredSolverBenchmarkOfSize<128>();
+}
+
+// ---------------------------
+// --- eigen decomposition ---
+// ---------------------------
+template<std::size_t N> void EigenBenchmarkOfSize() {
+    MatrixBase<double, N, N> A(0.0),
+                             UW(0.0),
+                             V;
+    for (std::size_t c{}; c < N; ++c) {
+        for (std::size_t r{}; r <= c; ++r) {
+            A(c, r) = A(r, c) = std::sin(static_cast<double>(c * N + r) * 0.731) + ((c == r) ? 2.0 : 0.0);
+        }
+    }
+    const SymmetricMatrix<double, N> packed(A);
+    VectorBase<double, N> values, imaginary;
+
+    const double svd{ Measure([&]() { SVDfast(A, UW, values, V); DoNotOptimize(values[0]); }, 200) },
+                 jacobi{ Measure([&]() { EigenSolverSymmetric(packed, values, V); DoNotOptimize(values[0]); }, 200) },
+                 ql{ Measure([&]() { EigenSolverSymmetric(A, values, V); DoNotOptimize(values[0]); }, 200) },
+                 qlValues{ Measure([&]() { EigenValuesSymmetric(A, values); DoNotOptimize(values[0]); }, 200) },
+                 hessenberg{ Measure([&]() { EigenValues(A, values, imaginary); DoNotOptimize(values[0]); }, 200) };
+    std::cout << "  " << N << "x" << N << ": SVDfast " << svd * 1e6 << " [us], Jacobi (packed) " << jacobi * 1e6 << " [us], tridiagonal QL " << ql * 1e6
+              << " [us], tridiagonal QL (values) " << qlValues * 1e6 << " [us], hessenberg QR (values) " << hessenberg * 1e6 << " [us]" << std::endl;
+}
+
+void EigenBenchmark() {
+    std::cout << "symmetric eigen decomposition:" << std::endl;
+    EigenBenchmarkOfSize<6>();
+    EigenBenchmarkOfSize<16>();
+    EigenBenchmarkOfSize<32>();
+}
+
+// ----------------------------------
+// --- Lanczos (top eigenvectors) ---
+// ----------------------------------
+template<std::size_t N, bool DENSE> void LanczosBenchmarkOfSize() {
+    constexpr std::size_t K{ 8 };
+    auto A = std::make_unique<MatrixBase<double, N, N>>(0.0);
+    auto V = std::make_unique<MatrixBase<double, N, N>>(0.0);
+    MatrixBase<double, K, N> X(0.0);
+    VectorBase<double, N> values;
+    VectorBase<double, K> lambda;
+
+    // covariance like matrix: 32 decaying principal directions on top of isotropic noise
+    for (std::size_t p{}; p < 32; ++p) {
+        VectorBase<double, N> x;
+        for (std::size_t i{}; i < N; ++i) {
+            x[i] = std::fmod(std::sin(static_cast<double>(p) * 12.9898 + static_cast<double>(i) * 78.233) * 43758.5453, 1.0);
+        }
+        RankOneUpdate(*A, 1.0 / static_cast<double>(1 + p * p), x, x);
+    }
+    for (std::size_t i{}; i < N; ++i) {
+        (*A)(i, i) += 0.01;
+    }
+
+    const double lanczos{ Measure([&]() { EigenSolverLanczos(*A, lambda, X); DoNotOptimize(lambda[0]); }, 5) };
+    std::cout << "  " << N << "x" << N << ": Lanczos (top " << K << ") " << lanczos * 1e3 << " [ms]";
+    if constexpr (DENSE) {
+        const double ql{ Measure([&]() { EigenSolverSymmetric(*A, values, *V); DoNotOptimize(values[0]); }, 1) };
+        std::cout << ", tridiagonal QL (all) " << ql * 1e3 << " [ms]";
+    }
+    std::cout << std::endl;
+}
+
+void LanczosBenchmark() {
+    std::cout << "Lanczos top eigenpairs:" << std::endl;
+    LanczosBenchmarkOfSize<256, true>();
+    LanczosBenchmarkOfSize<512, true>();
+    LanczosBenchmarkOfSize<1024, false>();
+}
+
+// ----------------------------------------
+// --- 3x3 polar decomposition benchmark ---
+// ----------------------------------------
+template<typename T> void PolarDecompositionBenchmarkOfType(const char* xi_type) {
+    using mat = MatrixBase<T, 3, 3>;
+    constexpr std::size_t count{ 1 << 16 };
+
+    // deformation gradients - identity plus noise
+    std::vector<T> a(9 * count), r(9 * count), s(9 * count);
+    for (std::size_t i{}; i < 9 * count; ++i) {
+        a[i] = static_cast<T>(0.3 * std::sin(static_cast<double>(i) * 0.377) + ((i / count) % 4 == 0 ? 1.0 : 0.0));
+    }
+    std::array<const T*, 9> A;
+    std::array<T*, 9> R, S;
+    for (std::size_t j{}; j < 9; ++j) {
+        A[j] = a.data() + j * count;
+        R[j] = r.data() + j * count;
+        S[j] = s.data() + j * count;
+    }
+
+    const auto report = [count](const char* xi_name, const double xi_seconds) {
+        std::cout << "  " << xi_name << ": " << static_cast<double>(count) / xi_seconds * 1e-6 << " Mmatrices/sec" << std::endl;
+    };
+
+    std::cout << "3x3 polar decomposition (" << xi_type << ", " << count << " matrices):" << std::endl;
+    report("per matrix          ", Measure([&]() {
+        mat Ai, Ri, Si;
+        for (std::size_t i{}; i < count; ++i) {
+            for (std::size_t j{}; j < 9; ++j) Ai.m_data[j] = A[j][i];
+            PolarDecomposition3x3(Ai, Ri, Si);
+            for (std::size_t j{}; j < 9; ++j) R[j][i] = Ri.m_data[j];
+        }
+        DoNotOptimize(r.back());
+    }, 10));
+    report("batch (R and S)     ", Measure([&]() { PolarDecomposition3x3(A, R, S, count); DoNotOptimize(r.back()); }, 10));
+    report("batch (R only)      ", Measure([&]() { PolarRotation3x3(A, R, count);         DoNotOptimize(r.back()); }, 10));
+    report("SVD                 ", Measure([&]() {
+        mat Ai, U, V;
+        VectorBase<T, 3> W;
+        for (std::size_t i{}; i < count; ++i) {
+            for (std::size_t j{}; j < 9; ++j) Ai.m_data[j] = A[j][i];
+            SVD(Ai, U, W, V);
+            DoNotOptimize(W[0]);
+        }
+    }, 10));
+}
+
+void PolarDecompositionBenchmark() {
+    PolarDecompositionBenchmarkOfType<float>("float");
+    PolarDecompositionBenchmarkOfType<double>("double");
+}
+
+// ------------------------------------------
+// --- affine transformation vs 4x4 matrix ---
+// ------------------------------------------
+template<typename T> void AffineBenchmarkOfType(const char* xi_type) {
+    using mat = MatrixBase<T, 4, 4>;
+    constexpr std::size_t count{ 1 << 14 };
+
+    // rigid local transformations of a binary tree hierarchy (parent of transform #i is #(i - 1) / 2)
+    std::vector<mat> local(count), world(count);
+    std::vector<Affine3<T>> localAffine(count), worldAffine(count);
+    for (std::size_t i{}; i < count; ++i) {
+        const T angle{ static_cast<T>(0.001 * static_cast<double>(i)) };
+        mat m;
+        m(0, 0) = m(1, 1) = std::cos(angle);
+        m(0, 1) = std::sin(angle);
+        m(1, 0) = -m(0, 1);
+        m(3, 0) = static_cast<T>(0.1);
+        m(3, 2) = static_cast<T>(0.01 * static_cast<double>(i % 7));
+        local[i] = m;
+        localAffine[i] = Affine3<T>(m);
+    }
+
+    const auto report = [count](const char* xi_name, const double xi_seconds) {
+        std::cout << "  " << xi_name << ": " << static_cast<double>(count) / xi_seconds * 1e-6 << " Mtransforms/sec" << std::endl;
+    };
+
+    std::cout << "affine transformation (" << xi_type << ", " << count << " transforms):" << std::endl;
+    report("compose, mat4          ", Measure([&]() {
+        world[0] = local[0];
+        for (std::size_t i{ 1 }; i < count; ++i) world[i] = world[(i - 1) / 2] * local[i];
+        DoNotOptimize(world.back()(3, 0));
+    }, 50));
+    report("compose, Affine3       ", Measure([&]() {
+        worldAffine[0] = localAffine[0];
+        for (std::size_t i{ 1 }; i < count; ++i) worldAffine[i] = worldAffine[(i - 1) / 2] * localAffine[i];
+        DoNotOptimize(worldAffine.back()(3, 0));
+    }, 50));
+    report("inverse, mat4          ", Measure([&]() {
+        for (std::size_t i{}; i < count; ++i) world[i] = Inv(local[i]);
+        DoNotOptimize(world.back()(3, 0));
+    }, 50));
+    report("inverse, Affine3       ", Measure([&]() {
+        for (std::size_t i{}; i < count; ++i) worldAffine[i] = Inv(localAffine[i]);
+        DoNotOptimize(worldAffine.back()(3, 0));
+    }, 50));
+    report("rigid inverse, Affine3 ", Measure([&]() {
+        for (std::size_t i{}; i < count; ++i) worldAffine[i] = InvRigid(localAffine[i]);
+        DoNotOptimize(worldAffine.back()(3, 0));
+    }, 50));
+    report("point, mat4            ", Measure([&]() {
+        VectorBase<T, 4> p(T{}, T{}, T{}, static_cast<T>(1));
+        for (std::size_t i{}; i < count; ++i) p = local[i] * p;
+        DoNotOptimize(p[0]);
+    }, 50));
+    report("point, Affine3         ", Measure([&]() {
+        VectorBase<T, 3> p(T{});
+        for (std::size_t i{}; i < count; ++i) p = TransformPoint(localAffine[i], p);
+        DoNotOptimize(p[0]);
+    }, 50));
+}
+
+void AffineBenchmark() {
+    AffineBenchmarkOfType<float>("float");
+    AffineBenchmarkOfType<double>("double");
+}
+
+// ----------------------------------------------
+// --- tracked matrix properties vs plain ops ---
+// ----------------------------------------------
+void TrackedMatrixBenchmarkOf4x4() {
+    constexpr std::size_t count{ 1 << 12 };
+
+    // rigid, rotation and diagonal 4x4 transformations
+    std::vector<TrackedMatrix<dmat4>> rigid, rotation, diagonal;
+    for (std::size_t i{}; i < count; ++i) {
+        const double angle{ 0.001 * static_cast<double>(i) };
+        dmat4 m;
+        m(0, 0) = m(1, 1) = std::cos(angle);
+        m(0, 1) = std::sin(angle);
+        m(1, 0) = -m(0, 1);
+        rotation.emplace_back(m, MatrixProperty::Orthonormal);
+        m(3, 0) = 0.1;
+        m(3, 2) = 0.01 * static_cast<double>(i % 7);
+        rigid.emplace_back(m, MatrixProperty::Affine);
+        diagonal.push_back(TrackDiagonal(dvec4(1.0 + angle, 2.0, 0.5, 1.0)));
+    }
+
+    std::cout << "tracked matrix properties (4x4 inverse, " << count << " matrices) [ns/matrix]:" << std::endl;
+    const auto report = [count](const char* xi_name, const std::vector<TrackedMatrix<dmat4>>& xi_matrices) {
+        dmat4 out;
+        const double plain{ Measure([&]() { for (const auto& m : xi_matrices) out = Inv(m.matrix()); DoNotOptimize(out(3, 0)); }, 50) },
+                     tracked{ Measure([&]() { for (const auto& m : xi_matrices) out = Inv(m).matrix(); DoNotOptimize(out(3, 0)); }, 50) };
+        std::cout << "  " << xi_name << ": plain " << plain / count * 1e9 << ", tracked " << tracked / count * 1e9 << std::endl;
+    };
+    report("affine     ", rigid);
+    report("orthonormal", rotation);
+    report("diagonal   ", diagonal);
+}
+
+template<std::size_t N> void TrackedMatrixBenchmarkOfSize() {
+    MatrixBase<double, N, N> lower(0.0);
+    VectorBase<double, N> b;
+    for (std::size_t c{}; c < N; ++c) {
+        b[c] = std::cos(static_cast<double>(c));
+        for (std::size_t r{ c }; r < N; ++r) {
+            lower(c, r) = std::sin(static_cast<double>(c * N + r) * 0.377) + ((c == r) ? 2.0 : 0.0);
+        }
+    }
+    const TrackedMatrix<MatrixBase<double, N, N>> L(lower, MatrixProperty::LowerTriangular);
+
+    MatrixBase<double, N, N> out;
+    VectorBase<double, N> x;
+    const double invPlain{ Measure([&]() { out = Inv(lower); DoNotOptimize(out(0, 0)); }, 200) },
+                 invTracked{ Measure([&]() { out = Inv(L).matrix(); DoNotOptimize(out(0, 0)); }, 200) },
+                 mulPlain{ Measure([&]() { out = lower * lower; DoNotOptimize(out(0, 0)); }, 200) },
+                 mulTracked{ Measure([&]() { out = (L * L).matrix(); DoNotOptimize(out(0, 0)); }, 200) },
+                 solvePlain{ Measure([&]() { x = SolveSquareLU(lower, b); DoNotOptimize(x[0]); }, 200) },
+                 solveTracked{ Measure([&]() { x = Solve(L, b); DoNotOptimize(x[0]); }, 200) };
+
+    std::cout << "  lower triangular " << N << "x" << N << " (plain / tracked) [us]: inverse " << invPlain * 1e6 << " / " << invTracked * 1e6
+              << ", product " << mulPlain * 1e6 << " / " << mulTracked * 1e6 << ", solve " << solvePlain * 1e6 << " / " << solveTracked * 1e6 << std::endl;
+}
+
+void TrackedMatrixBenchmark() {
+    TrackedMatrixBenchmarkOf4x4();
+    TrackedMatrixBenchmarkOfSize<16>();
+    TrackedMatrixBenchmarkOfSize<64>();
+}
+
+// -------------------------------------------------
+// --- transform hierarchy world propagation ---
+// -------------------------------------------------
+void TransformHierarchyBenchmarkOfSize(const std::size_t xi_count) {
+    // rigid local transformations of a 4-ary tree (parent of node #i is #(i - 1) / 4)
+    std::vector<mat4> local(xi_count), world(xi_count);
+    std::vector<std::size_t> parent(xi_count);
+    TransformHierarchy<float> hierarchy;
+    for (std::size_t i{}; i < xi_count; ++i) {
+        const float angle{ 0.001f * static_cast<float>(i % 1000) };
+        mat4 m;
+        m(0, 0) = m(1, 1) = std::cos(angle);
+        m(0, 1) = std::sin(angle);
+        m(1, 0) = -m(0, 1);
+        m(3, 0) = 0.1f;
+        local[i] = m;
+        parent[i] = (i == 0) ? TransformHierarchy<float>::npos : (i - 1) / 4;
+        hierarchy.add(m, parent[i]);
+    }
+    hierarchy.update();
+
+    // one percent of the nodes, chosen among the deepest levels
+    std::vector<std::size_t> moving;
+    for (std::size_t i{ xi_count - 1 }; moving.size() < xi_count / 100; i -= 97) {
+        moving.push_back(i);
+    }
+
+    std::size_t updated{};
+    const double serial{ Measure([&]() {
+                     world[0] = local[0];
+                     for (std::size_t i{ 1 }; i < xi_count; ++i) world[i] = world[parent[i]] * local[i];
+                     DoNotOptimize(world.back()(3, 0));
+                 }, 10) },
+                 full{ Measure([&]() {
+                     hierarchy.setLocal(0, local[0]);
+                     updated = hierarchy.update();
+                     DoNotOptimize(hierarchy.world(xi_count - 1)(3, 0));
+                 }, 10) };
+    const std::size_t fullCount{ updated };
+    const double partial{ Measure([&]() {
+        for (const std::size_t i : moving) hierarchy.setLocal(i, local[i]);
+        updated = hierarchy.update();
+        DoNotOptimize(hierarchy.world(xi_count - 1)(3, 0));
+    }, 10) };
+
+    std::cout << "  " << xi_count << " nodes: serial mat4 loop " << static_cast<double>(xi_count) / serial * 1e-6
+              << ", hierarchy (all dirty) " << static_cast<double>(fullCount) / full * 1e-6
+              << " [Mnodes/sec], hierarchy (" << updated << " dirty nodes) " << partial * 1e6 << " [us]" << std::endl;
+}
+
+void TransformHierarchyBenchmark() {
+    std::cout << "transform hierarchy (" << ThreadPool::Instance().Size() << " threads):" << std::endl;
+    TransformHierarchyBenchmarkOfSize(1 << 17);
+    TransformHierarchyBenchmarkOfSize(1 << 20);
+}
+
+// --------------------------------------
+// --- Householder QR / least squares ---
+// --------------------------------------
+template<std::size_t COL, std::size_t ROW> void LeastSquaresBenchmarkOfSize() {
+    constexpr std::size_t rhs{ 32 };
+    auto A  = std::make_unique<MatrixBase<double, COL, ROW>>(0.0);
+    auto QR = std::make_unique<MatrixBase<double, COL, ROW>>(0.0);
+    auto B  = std::make_unique<MatrixBase<double, rhs, ROW>>(0.0);
+    VectorBase<double, COL> tau;
+    for (std::size_t i{}; i < COL * ROW; ++i) A->m_data[i] = std::sin(static_cast<double>(i) * 0.377);
+    for (std::size_t i{}; i < rhs * ROW; ++i) B->m_data[i] = std::cos(static_cast<double>(i) * 0.119);
+
+    const double unblocked{ Measure([&]() { QRhouseholder<1>(*A, *QR, tau); DoNotOptimize(tau[0]); }, 20) },
+                 blocked4{ Measure([&]() { QRhouseholder<4>(*A, *QR, tau); DoNotOptimize(tau[0]); }, 20) },
+                 blocked8{ Measure([&]() { QRhouseholder<8>(*A, *QR, tau); DoNotOptimize(tau[0]); }, 20) },
+                 reuse{ Measure([&]() { const auto X = SolveLeastSquares(*QR, tau, *B); DoNotOptimize(X(0, 0)); }, 20) };
+
+    std::cout << "  " << ROW << "x" << COL << ": factorization (panel 1/4/8) " << unblocked * 1e6 << " / " << blocked4 * 1e6 << " / " << blocked8 * 1e6
+              << " [us], " << rhs << " right hand sides with reused factorization " << reuse * 1e6 << " [us]" << std::endl;
+}
+
+void LeastSquaresBenchmark() {
+    std::cout << "Householder QR least squares:" << std::endl;
+    LeastSquaresBenchmarkOfSize<6, 1000>();
+    LeastSquaresBenchmarkOfSize<12, 2000>();
+    LeastSquaresBenchmarkOfSize<20, 4000>();
+}
+
+// ----------------------
+// --- LU / inversion ---
+// ----------------------
+template<std::size_t N> void LUBenchmarkOfSize() {
+    auto A  = std::make_unique<MatrixBase<double, N, N>>(0.0);
+    auto LU_ = std::make_unique<MatrixBase<double, N, N>>(0.0);
+    VectorBase<std::size_t, N> pivot;
+    std::int32_t sign{};
+    for (std::size_t i{}; i < N * N; ++i) {
+        A->m_data[i] = std::sin(static_cast<double>(i) * 0.517) + ((i % (N + 1)) == 0 ? 2.0 : 0.0);
+    }
+
+    const double unblocked{ Measure([&]() { LUblocked<1>(*A, *LU_, pivot, sign); DoNotOptimize(LU_->m_data[0]); }, 10) },
+                 blocked8{ Measure([&]() { LUblocked<8>(*A, *LU_, pivot, sign); DoNotOptimize(LU_->m_data[0]); }, 10) },
+                 blocked16{ Measure([&]() { LUblocked<16>(*A, *LU_, pivot, sign); DoNotOptimize(LU_->m_data[0]); }, 10) },
+                 blocked32{ Measure([&]() { LUblocked<32>(*A, *LU_, pivot, sign); DoNotOptimize(LU_->m_data[0]); }, 10) },
+                 det{ Measure([&]() { DoNotOptimize(Determinant(*A)); }, 10) },
+                 inv{ Measure([&]() { auto I = std::make_unique<MatrixBase<double, N, N>>(Inv(*A)); DoNotOptimize(I->m_data[0]); }, 10) };
+
+    std::cout << "  " << N << "x" << N << ": LU (panel 1/8/16/32) " << unblocked * 1e3 << " / " << blocked8 * 1e3 << " / " << blocked16 * 1e3 << " / " << blocked32 * 1e3
+              << " [ms], Determinant " << det * 1e3 << " [ms], Inv " << inv * 1e3 << " [ms]" << std::endl;
+}
+
+void LUBenchmark() {
+    std::cout << "LU decomposition:" << std::endl;
+    LUBenchmarkOfSize<32>();
+    LUBenchmarkOfSize<64>();
+    LUBenchmarkOfSize<128>();
+}
+
+// -----------------------------
+// --- factorization objects ---
+// -----------------------------
+template<std::size_t N> void FactorizationBenchmarkOfSize() {
+    constexpr std::size_t rhs{ 64 };
+    auto A = std::make_unique<MatrixBase<double, N, N>>(0.0);
+    for (std::size_t c{}; c < N; ++c) {
+        for (std::size_t r{}; r < N; ++r) {
+            (*A)(c, r) = 1.0 / static_cast<double>(1 + c + r) + (c == r ? 2.0 : 0.0);
+        }
+    }
+    std::vector<VectorBase<double, N>> b(rhs);
+    for (std::size_t k{}; k < rhs; ++k) {
+        for (std::size_t i{}; i < N; ++i) b[k][i] = std::sin(static_cast<double>(k * N + i));
+    }
+
+    const double lu{ Measure([&]() { for (const auto& bk : b) DoNotOptimize(SolveSquareLU(*A, bk)[0]); }, 5) },
+                 luCached{ Measure([&]() {
+                     const LUFactor<MatrixBase<double, N, N>> factor(*A);
+                     for (const auto& bk : b) DoNotOptimize(factor.solve(bk)[0]);
+                 }, 5) },
+                 chol{ Measure([&]() { for (const auto& bk : b) DoNotOptimize(SolveCubicCholesky(*A, bk)[0]); }, 5) },
+                 cholCached{ Measure([&]() {
+                     const CholeskyFactor<MatrixBase<double, N, N>> factor(*A);
+                     for (const auto& bk : b) DoNotOptimize(factor.solve(bk)[0]);
+                 }, 5) };
+
+    std::cout << "  " << N << "x" << N << ", " << rhs << " right hand sides: LU " << lu * 1e3 << " -> " << luCached * 1e3
+              << " [ms], Cholesky " << chol * 1e3 << " -> " << cholCached * 1e3 << " [ms]" << std::endl;
+}
+
+void FactorizationBenchmark() {
+    std::cout << "repeated solutions (factorize per call -> cached factorization):" << std::endl;
+    FactorizationBenchmarkOfSize<8>();
+    FactorizationBenchmarkOfSize<32>();
+    FactorizationBenchmarkOfSize<64>();
+}
+
+// -------------------
+// --- dot product ---
+// -------------------
+template<std::size_t N> void DotBenchmarkOfSize() {
+    using vec = VectorBase<float, N>;
+    constexpr std::size_t count{ N < 65536 ? 65536 / N : 1 };
+    std::vector<vec> a(count + 3, vec(0.0f));
+    for (std::size_t j{}; j < a.size(); ++j) {
+        for (std::size_t i{}; i < N; ++i) a[j][i] = static_cast<float>(std::sin(static_cast<double>(j * N + i)));
+    }
+
+    // previous implementation - a single accumulator
+    const auto serial = [](const vec& x, const vec& y, const vec* z, const vec* w) {
+        float xo_dot{};
+        for (std::size_t i{}; i < N; ++i) {
+            float temp{ x[i] * y[i] };
+            if (z != nullptr) temp *= (*z)[i];
+            if (w != nullptr) temp *= (*w)[i];
+            xo_dot += temp;
+        }
+        return xo_dot;
+    };
+
+    const std::size_t repetitions{ (std::size_t{ 1 } << 24) / (N * count) + 1 };
+    const auto throughput = [repetitions](const double xi_time) { return static_cast<double>(N * count * repetitions) / xi_time * 1e-9; };
+    const auto run = [&](auto&& xi_dot) {
+        return throughput(Measure([&]() {
+            float total{};
+            for (std::size_t r{}; r < repetitions; ++r) {
+                for (std::size_t j{}; j < count; ++j) {
+                    const std::size_t k{ (j + r) % count };
+                    total += xi_dot(a[k], a[k + 1], a[k + 2], a[k + 3]);
+                }
+            }
+            DoNotOptimize(total);
+        }, 3));
+    };
+
+    const double serial2{ run([&](const vec& x, const vec& y, const vec&, const vec&) { return serial(x, y, nullptr, nullptr); }) },
+                 serial3{ run([&](const vec& x, const vec& y, const vec& z, const vec&) { return serial(x, y, &z, nullptr); }) },
+                 serial4{ run([&](const vec& x, const vec& y, const vec& z, const vec& w) { return serial(x, y, &z, &w); }) },
+                 unrolled2{ run([](const vec& x, const vec& y, const vec&, const vec&) { return dot(x, y); }) },
+                 unrolled3{ run([](const vec& x, const vec& y, const vec& z, const vec&) { return dot(x, y, z); }) },
+                 unrolled4{ run([](const vec& x, const vec& y, const vec& z, const vec& w) { return dot(x, y, z, w); }) };
+
+    std::cout << "  N = " << N << " [G elements/sec]: two operands " << serial2 << " -> " << unrolled2 << ", three operands " << serial3
+              << " -> " << unrolled3 << ", four operands " << serial4 << " -> " << unrolled4 << std::endl;
+}
+
+void DotBenchmark() {
+    std::cout << "dot product (single accumulator -> unrolled accumulators):" << std::endl;
+    DotBenchmarkOfSize<4>();
+    DotBenchmarkOfSize<16>();
+    DotBenchmarkOfSize<256>();
+    DotBenchmarkOfSize<4096>();
+}
+
+// ---------------------------
+// --- accurate reductions ---
+// ---------------------------
+template<std::size_t N> void SummationBenchmarkOfSize() {
+    auto x = std::make_unique<VectorBase<float, N>>(0.0f);
+    auto y = std::make_unique<VectorBase<float, N>>(0.0f);
+    for (std::size_t i{}; i < N; ++i) {
+        (*x)[i] = static_cast<float>(std::sin(static_cast<double>(i)));
+        (*y)[i] = static_cast<float>(std::cos(static_cast<double>(i)));
+    }
+
+    const std::size_t repetitions{ (std::size_t{ 1 } << 26) / N };
+    const auto throughput = [repetitions](const double xi_time) { return static_cast<double>(N * repetitions) / xi_time * 1e-9; };
+    const double sumNaive{ Measure([&]() { for (std::size_t r{}; r < repetitions; ++r) DoNotOptimize(sum(*x)); }, 3) },
+                 sumPairwise{ Measure([&]() { for (std::size_t r{}; r < repetitions; ++r) DoNotOptimize(sum<Summation::Pairwise>(*x)); }, 3) },
+                 sumCompensated{ Measure([&]() { for (std::size_t r{}; r < repetitions; ++r) DoNotOptimize(sum<Summation::Compensated>(*x)); }, 3) },
+                 dotNaive{ Measure([&]() { for (std::size_t r{}; r < repetitions; ++r) DoNotOptimize(dot(*x, *y)); }, 3) },
+                 dotPairwise{ Measure([&]() { for (std::size_t r{}; r < repetitions; ++r) DoNotOptimize(dot<Summation::Pairwise>(*x, *y)); }, 3) },
+                 dotCompensated{ Measure([&]() { for (std::size_t r{}; r < repetitions; ++r) DoNotOptimize(dot<Summation::Compensated>(*x, *y)); }, 3) };
+
+    std::cout << "  " << N << " floats [G elements/sec]: sum naive " << throughput(sumNaive) << ", pairwise " << throughput(sumPairwise)
+              << ", compensated " << throughput(sumCompensated) << "; dot naive " << throughput(dotNaive) << ", pairwise " << throughput(dotPairwise)
+              << ", compensated " << throughput(dotCompensated) << std::endl;
+}
+
+void SummationBenchmark() {
+    std::cout << "accurate reductions:" << std::endl;
+    SummationBenchmarkOfSize<4096>();
+    SummationBenchmarkOfSize<65536>();
+}
+
+// -----------------------------------------
+// --- mixed precision LU (float/double) ---
+// -----------------------------------------
+template<std::size_t N> void MixedPrecisionBenchmarkOfSize() {
+    // a batch of moderately ill conditioned systems (condition ~1e4), each solved once
+    constexpr std::size_t count{ 256 };
+    std::vector<MatrixBase<double, N, N>> A(count, MatrixBase<double, N, N>(0.0));
+    std::vector<VectorBase<double, N>> b(count);
+    for (std::size_t k{}; k < count; ++k) {
+        for (std::size_t c{}; c < N; ++c) {
+            for (std::size_t r{}; r < N; ++r) {
+                A[k](c, r) = 1.0 / static_cast<double>(1 + c + r) + (c == r ? 1e-3 * static_cast<double>(1 + k % 7) : 0.0) +
+                             1e-2 * std::sin(static_cast<double>(k + c * N + r));
+            }
+        }
+        for (std::size_t i{}; i < N; ++i) b[k][i] = std::cos(static_cast<double>(k * N + i));
+    }
+
+    std::size_t iterations{};
+    double backwardError{};
+    VectorBase<double, N> x;
+    const double lu{ Measure([&]() { for (std::size_t k{}; k < count; ++k) DoNotOptimize(SolveSquareLU(A[k], b[k])[0]); }, 5) },
+                 mixed{ Measure([&]() {
+                     iterations = 0;
+                     for (std::size_t k{}; k < count; ++k) {
+                         const RefinementSolution<double> solution{ SolveMixedPrecisionLU(A[k], b[k], x) };
+                         iterations += solution.iterations;
+                         backwardError = std::max(backwardError, solution.backwardError);
+                         DoNotOptimize(x[0]);
+                     }
+                 }, 5) };
+
+    std::cout << "  " << N << "x" << N << ", " << count << " systems: double LU " << lu * 1e3 << " [ms], mixed precision LU " << mixed * 1e3
+              << " [ms] (" << static_cast<double>(iterations) / count << " refinement steps per system, backward error <= " << backwardError << ")" << std::endl;
+}
+
+void MixedPrecisionBenchmark() {
+    std::cout << "mixed precision solution:" << std::endl;
+    MixedPrecisionBenchmarkOfSize<6>();
+    MixedPrecisionBenchmarkOfSize<16>();
+    MixedPrecisionBenchmarkOfSize<32>();
+    MixedPrecisionBenchmarkOfSize<64>();
+}
+
+// ---------------------------------------------
+// --- packed symmetric / triangular storage ---
+// ---------------------------------------------
+template<std::size_t N> void PackedBenchmarkOfSize() {
+    // a batch of covariance matrices which does not fit in cache
+    constexpr std::size_t count{ (1u << 25) / (sizeof(double) * N * N) };
+    std::vector<MatrixBase<double, N, N>> A(count, MatrixBase<double, N, N>(0.0));
+    for (std::size_t c{}; c < N; ++c) {
+        for (std::size_t r{}; r < N; ++r) {
+            A[0](c, r) = 1.0 / static_cast<double>(1 + c + r) + (c == r ? 2.0 : 0.0);
+        }
+    }
+    for (auto& a : A) a = A[0];
+    std::vector<SymmetricMatrix<double, N>> S(count, SymmetricMatrix<double, N>(A[0]));
+    VectorBase<double, N> x;
+    for (std::size_t i{}; i < N; ++i) x[i] = std::sin(static_cast<double>(i));
+
+    // products are stored and factorizations are sampled at their last element (which depends on all others),
+    // so no part of a product or a factorization can be discarded
+    std::vector<VectorBase<double, N>> y(count);
+    const double dense{ Measure([&]() { for (std::size_t k{}; k < count; ++k) y[k] = A[k] * x; DoNotOptimize(y.back()[0]); }, 5) },
+                 packed{ Measure([&]() { for (std::size_t k{}; k < count; ++k) y[k] = S[k] * x; DoNotOptimize(y.back()[0]); }, 5) },
+                 cholDense{ Measure([&]() { for (const auto& a : A) DoNotOptimize(Cholesky(a)(N - 1, N - 1)); }, 5) },
+                 cholPacked{ Measure([&]() { for (const auto& s : S) DoNotOptimize(Cholesky(s)(N - 1, N - 1)); }, 5) };
+
+    std::cout << "  " << count << " matrices of " << N << "x" << N << " (" << sizeof(A[0]) << " -> " << sizeof(S[0]) << " [bytes] each): matrix * vector "
+              << dense * 1e3 << " -> " << packed * 1e3 << " [ms], Cholesky " << cholDense * 1e3 << " -> " << cholPacked * 1e3 << " [ms]" << std::endl;
+}
+
+void PackedBenchmark() {
+    std::cout << "symmetric matrices (dense -> packed):" << std::endl;
+    PackedBenchmarkOfSize<6>();
+    PackedBenchmarkOfSize<16>();
+    PackedBenchmarkOfSize<64>();
+}
+
+// ----------------------------------------
+// --- sparse matrix / iterative solvers ---
+// ----------------------------------------
+void SparseBenchmarkOfSize(const std::size_t n) {
+    // vector valued 3D laplacian (7 point stencil of 'mat3' blocks) over a n x n x n grid, with varying stiffness
+    const std::size_t count{ n * n * n };
+    const auto index = [n](const std::size_t x, const std::size_t y, const std::size_t z) { return (z * n + y) * n + x; };
+    std::vector<Triplet<mat3>> entries;
+    entries.reserve(7 * count);
+    for (std::size_t z{}; z < n; ++z) {
+        for (std::size_t y{}; y < n; ++y) {
+            for (std::size_t x{}; x < n; ++x) {
+                const std::size_t i{ index(x, y, z) };
+                const float stiffness{ 1.0f + 9.0f * static_cast<float>((x / 4 + y / 4 + z / 4) % 2) };
+                entries.push_back({ i, i, mat3(6.0f * stiffness + 0.1f, 0.5f, 0.0f,
+                                               0.5f, 6.0f * stiffness + 0.1f, 0.5f,
+                                               0.0f, 0.5f, 6.0f * stiffness + 0.1f) });
+                const auto couple = [&](const std::size_t j) { entries.push_back({ i, j, mat3() * -1.0f }); };
+                if (x > 0)     couple(index(x - 1, y, z));
+                if (x + 1 < n) couple(index(x + 1, y, z));
+                if (y > 0)     couple(index(x, y - 1, z));
+                if (y + 1 < n) couple(index(x, y + 1, z));
+                if (z > 0)     couple(index(x, y, z - 1));
+                if (z + 1 < n) couple(index(x, y, z + 1));
+            }
+        }
+    }
+    const SparseMatrix<mat3> A(count, count, entries);
+
+    std::vector<vec3> x(count), b;
+    for (std::size_t i{}; i < count; ++i) x[i] = vec3(std::sin(static_cast<float>(i)), std::cos(static_cast<float>(i)), 1.0f);
+    A.multiply(x, b);
+
+    std::vector<vec3> y;
+    const double spmv{ Measure([&]() { A.multiply(x, y); DoNotOptimize(y[0][0]); }, 20) };
+
+    IterativeSolution<float> cg, pcg;
+    const double cgTime{ Measure([&]() { std::vector<vec3> s; cg = ConjugateGradient(A, b, s, 1e-5f, 2000); }, 1) },
+                 pcgTime{ Measure([&]() { std::vector<vec3> s; pcg = PreconditionedConjugateGradient(A, b, s, 1e-5f, 2000); }, 1) };
+
+    std::cout << "  " << n << "^3 grid (" << 3 * count << " unknowns, " << A.nonZeros() << " blocks): SpMV " << spmv * 1e3
+              << " [ms], CG " << cg.iterations << " iterations in " << cgTime * 1e3 << " [ms], block Jacobi PCG " << pcg.iterations
+              << " iterations in " << pcgTime * 1e3 << " [ms]" << std::endl;
+}
+
+void SparseBenchmark() {
+    std::cout << "sparse 3D laplacian (" << ThreadPool::Instance().Size() << " threads):" << std::endl;
+    SparseBenchmarkOfSize(16);
+    SparseBenchmarkOfSize(32);
+    SparseBenchmarkOfSize(64);
+}
+
+int main() {
+    NoiseBenchmark();
+    TextureBenchmark();
+    SVDBenchmark();
+    ReflectionBenchmark();
+    RankUpdateBenchmark();
+    StructuredSolverBenchmark();
+    EigenBenchmark();
+    LanczosBenchmark();
+    PolarDecompositionBenchmark();
+    AffineBenchmark();
+    TrackedMatrixBenchmark();
+    TransformHierarchyBenchmark();
+    LeastSquaresBenchmark();
+    LUBenchmark();
+    DotBenchmark();
+    SummationBenchmark();
+    FactorizationBenchmark();
+    MixedPrecisionBenchmark();
+    PackedBenchmark();
+    SparseBenchmark();
+
+    return 1;
+}
@@ -12,6 +12,8 @@
 #include<utility>
 #include<functional>
 #include<tuple>
+#include "Instrumentation.h"
+#include "Tracking.h"
 
 namespace GLSLCPP {
 
@@ -19,9 +21,15 @@ namespace GLSLCPP {
     * forward declaration
     **/
 
+    // matrix storage layout
+    enum class Layout : std::uint8_t {
+        ColumnMajor = 0,    // columns are contiguous (GLSL, default)
+        RowMajor    = 1     // rows are contiguous (i.e. - DirectX style buffers)
+    };
+
     // base objects
     template<typename T, std::size_t N> class VectorBase;                                                   // general N elements vector
-    template<typename T, std::size_t COL, std::size_t ROW> class MatrixBase;                                // general ROWxCOL matrix
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L = Layout::ColumnMajor> class MatrixBase; // general ROWxCOL matrix
     template<class VECTOR, typename T, std::size_t N, bool Unique, std::size_t ... Indexes> class Swizzle;  // general swizzling ("index changer") object
 
     // first generation objects
@@ -98,11 +106,20 @@ namespace GLSLCPP {
     template<typename T> inline constexpr bool is_Swizzle_v = is_Swizzle<T>::value;
 
     // type trait to test if an object is of type MatrixBase
-    template<typename>                                     struct is_MatrixBase : public std::false_type {};
-    template<typename T, std::size_t COL, std::size_t ROW> struct is_MatrixBase<MatrixBase<T, COL, ROW>> : public std::true_type {};
+    template<typename>                                               struct is_MatrixBase : public std::false_type {};
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L> struct is_MatrixBase<MatrixBase<T, COL, ROW, L>> : public std::true_type {};
     template<typename T> inline constexpr bool is_MatrixBase_v = is_MatrixBase<T>::value;
     template<typename U> constexpr bool isMatrixBase(const U&) { return is_MatrixBase<U>::value; }
 
+    // type trait to test if an object is of type MatrixBase with row major layout
+    template<typename>                                     struct is_RowMajor : public std::false_type {};
+    template<typename T, std::size_t COL, std::size_t ROW> struct is_RowMajor<MatrixBase<T, COL, ROW, Layout::RowMajor>> : public std::true_type {};
+    template<typename T> inline constexpr bool is_RowMajor_v = is_RowMajor<T>::value;
+    template<typename U> constexpr bool isRowMajor(const U&) { return is_RowMajor<U>::value; }
+
+    // storage layout of a matrix type
+    template<typename T> inline constexpr Layout Layout_v = is_RowMajor_v<T> ? Layout::RowMajor : Layout::ColumnMajor;
+
     // type trait to test if an object is of type Vector2
     template<typename>   struct is_Vector2 : public std::false_type {};
     template<typename T> struct is_Vector2<Vector2<T>> : public std::true_type {};
@@ -162,7 +179,7 @@ namespace GLSLCPP {
     // get the number of elements in an object (if object is not defined in this header - his size is 0)
     template<typename>                                                                    struct Length { static constexpr std::size_t value{ 0 }; };
     template<typename T, std::size_t N>                                                   struct Length<VectorBase<T, N>> { static constexpr std::size_t value{ N }; };
-    template<typename T, std::size_t COL, std::size_t ROW>                                struct Length<MatrixBase<T, COL, ROW>> { static constexpr std::size_t value{ ROW * COL }; };
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L>                      struct Length<MatrixBase<T, COL, ROW, L>> { static constexpr std::size_t value{ ROW * COL }; };
     template<class TYPE, typename T, std::size_t N, bool Unique, std::size_t ... Indexes> struct Length<Swizzle<TYPE, T, N, Unique, Indexes...>> { static constexpr std::size_t value{ N }; };
     template<typename T>                                                                  struct Length<Vector2<T>> { static constexpr std::size_t value{ 2 }; };
     template<typename T>                                                                  struct Length<Vector3<T>> { static constexpr std::size_t value{ 3 }; };
@@ -202,13 +219,13 @@ namespace GLSLCPP {
 
 
     // get MatrixBase number of rows
-    template<typename>                                     struct Rows { static constexpr std::size_t value{ 0 }; };
-    template<typename T, std::size_t COL, std::size_t ROW> struct Rows<MatrixBase<T, COL, ROW>> { static constexpr std::size_t value{ ROW }; };
+    template<typename>                                               struct Rows { static constexpr std::size_t value{ 0 }; };
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L> struct Rows<MatrixBase<T, COL, ROW, L>> { static constexpr std::size_t value{ ROW }; };
     template<typename T> inline constexpr std::size_t Rows_v = Rows<T>::value;
 
     // get MatrixBase number of columns
-    template<typename>                                     struct Columns { static constexpr std::size_t value{ 0 }; };
-    template<typename T, std::size_t COL, std::size_t ROW> struct Columns<MatrixBase<T, COL, ROW>> { static constexpr std::size_t value{ COL }; };
+    template<typename>                                               struct Columns { static constexpr std::size_t value{ 0 }; };
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L> struct Columns<MatrixBase<T, COL, ROW, L>> { static constexpr std::size_t value{ COL }; };
     template<typename T> inline constexpr std::size_t Columns_v = Columns<T>::value;
 
     // test if a matrix is cubic
@@ -224,16 +241,16 @@ namespace GLSLCPP {
     template<typename T>                                   struct is_iterate_able<Vector3<T>> : public std::true_type {};
     template<typename T>                                   struct is_iterate_able<Vector4<T>> : public std::true_type {};
     template<typename T, std::size_t N>                    struct is_iterate_able<VectorBase<T, N>> : public std::true_type {};
-    template<typename T, std::size_t COL, std::size_t ROW> struct is_iterate_able<MatrixBase<T, COL, ROW>> : public std::true_type {};
+    template<typename T, std::size_t COL, std::size_t ROW, Layout L> struct is_iterate_able<MatrixBase<T, COL, ROW, L>> : public std::true_type {};
     template<typename T> inline constexpr bool is_iterate_able_v = is_iterate_able<T>::value;
 
     // test if an object underlying type is 'bool'
-    template<typename>                         struct is_UnderlyingBool : public std::false_type {};
-    template<>                                 struct is_UnderlyingBool<Vector2<bool>> : public std::true_type {};
-    template<>                                 struct is_UnderlyingBool<Vector3<bool>> : public std::true_type {};
-    template<>                                 struct is_UnderlyingBool<Vector4<bool>> : public std::true_type {};
-    template<std::size_t N>                    struct is_UnderlyingBool<VectorBase<bool, N>> : public std::true_type {};
-    template<std::size_t COL, std::size_t ROW> struct is_UnderlyingBool<MatrixBase<bool, COL, ROW>> : public std::true_type {};
+    template<typename>                                   struct is_UnderlyingBool : public std::false_type {};
+    template<>                                           struct is_UnderlyingBool<Vector2<bool>> : public std::true_type {};
+    template<>                                           struct is_UnderlyingBool<Vector3<bool>> : public std::true_type {};
+    template<>                                           struct is_UnderlyingBool<Vector4<bool>> : public std::true_type {};
+    template<std::size_t N>                              struct is_UnderlyingBool<VectorBase<bool, N>> : public std::true_type {};
+    template<std::size_t COL, std::size_t ROW, Layout L> struct is_UnderlyingBool<MatrixBase<bool, COL, ROW, L>> : public std::true_type {};
     template<typename T> inline constexpr bool is_UnderlyingBool_v = is_UnderlyingBool<T>::value;
     template<typename U> constexpr bool isUnderlyingBool(const U&) { return is_UnderlyingBool<U>::value; }
 
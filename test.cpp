@@ -1,8 +1,20 @@
 // This is an open source non-commercial project. Dear PVS-Studio, please check it.
 // PVS-Studio Static Code Analyzer for C, C++, C#, and Java: http://www.viva64.com
+// tests run against the library as its users build it. define 'GLSLCPP_TEST_INSTRUMENTATION' (i.e. - '/D GLSLCPP_TEST_INSTRUMENTATION')
+// to run them against the instrumented library instead, which also runs the instrumentation tests and copy counting checks.
+#ifdef GLSLCPP_TEST_INSTRUMENTATION
+#define GLSLCPP_INSTRUMENT         // count calls, flops and bytes of library entry points (see 'InstrumentationTest')
+#define GLSLCPP_TRACK_TEMPORARIES  // count constructions, copies and moves of vectors/matrices/swizzles (see 'InPlaceTest' and 'TrackingTest')
+constexpr bool Instrumented{ true };
+#else
+constexpr bool Instrumented{ false };
+#endif
 #include "GLSL++.h"
 #include <iostream>
 #include <assert.h>
+#include <sstream>
+#include <thread>
+#include <memory>
 #include "ExecutionTimer.h"
 
 using namespace GLSLCPP;
@@ -234,6 +246,24 @@ void VectorBaseTest() {
         assert(static_cast<int>(dot(VectorBase<int, 3>(5, 0, 0), VectorBase<int, 3>(1,2,3))) == 5);
 
         assert(static_cast<int>(dot(c, d, g)) == 20);
+        assert(dot(e, f, e) == -1030);
+        assert(dot(e, f, e, f) == 4534);
+        assert(dot(e, f, VectorBase<int, 5>(1, 1, 1, 1, 1)) == dot(e, f));
+
+        // dot product of long vectors (several accumulators)
+        VectorBase<double, 37> h, k;
+        double hk{}, hhk{}, hhkk{};
+        for (std::size_t i{}; i < 37; ++i) {
+            h[i] = static_cast<double>(i % 5) - 2.0;
+            k[i] = static_cast<double>(i % 7) + 1.0;
+            hk += h[i] * k[i];
+            hhk += h[i] * h[i] * k[i];
+            hhkk += h[i] * h[i] * k[i] * k[i];
+        }
+        assert(dot(h, k) == hk);
+        assert(dot(h, h, k) == hhk);
+        assert(dot(h, h, k, k) == hhkk);
+        assert(dot(h) == dot(h, h));
 
         // min element
         assert(min(c) == 1);
@@ -1863,6 +1893,37 @@ void MatrixBaseTest() {
                                      0.0f,   0.0f,  1.0f);
         assert(gv0 == gvEq);
 
+        // apply givens rotation and householder reflection in place
+        {
+            MatrixBase<double, 3, 3> A(1.0, 2.0, 3.0,
+                                       4.0, 5.0, 6.0,
+                                       7.0, 8.0, 10.0),
+                                     Ag(A), Ah(A), At(A);
+            ApplyGivens(Ag, 1, 2, 0.6, 0.8);
+            const MatrixBase<double, 3, 3> Gref(GivensRotation<double, 3>(0.6, 0.8, 1) * A);
+
+            // rotation of columns (A * G^T)
+            ApplyGivens(AsTransposed(At), 0, 1, 0.6, 0.8);
+            const MatrixBase<double, 3, 3> Tref(A * Transpose(GivensRotation<double, 3>(0.6, 0.8, 0)));
+            for (std::size_t i{}; i < 9; ++i) {
+                assert(std::abs(Ag.m_data[i] - Gref.m_data[i]) < 1e-12);
+                assert(std::abs(At.m_data[i] - Tref.m_data[i]) < 1e-12);
+            }
+
+            const dvec3 v(Normalize(dvec3(1.0, -2.0, 2.0)));
+            ApplyHouseholder(Ah, v, 2.0);
+            const MatrixBase<double, 3, 3> Href(Householder(v) * A);
+            for (std::size_t i{}; i < 9; ++i) {
+                assert(std::abs(Ah.m_data[i] - Href.m_data[i]) < 1e-12);
+            }
+
+            // a reflection is its own inverse
+            ApplyHouseholder(Ah, v, 2.0);
+            for (std::size_t i{}; i < 9; ++i) {
+                assert(std::abs(Ah.m_data[i] - A.m_data[i]) < 1e-12);
+            }
+        }
+
         // create a toeplitz matrix
         auto topl = Toeplitz(a);
         auto topleq = MatrixBase<int, 3, 3>(1, 2, 3,
@@ -2091,6 +2152,50 @@ void MatrixBaseTest() {
                                        0.0069310172768664207, -0.0039293956215305575,   0.0022336742967629690, -0.020403230836399913,  0.015167934884301080);
         assert(inv == luIv);
 
+        // blocked LU decomposition (matrices larger than 8x8)
+        {
+            constexpr std::size_t N{ 21 };
+            MatrixBase<double, N, N> A(0.0), lub, lu1;
+            for (std::size_t i{}; i < N * N; ++i) {
+                A.m_data[i] = std::sin(static_cast<double>(i) * 0.913) + ((i % (N + 1)) == 0 ? 0.5 : 0.0);
+            }
+
+            // panel width does not change the decomposition
+            VectorBase<std::size_t, N> pivb, piv1;
+            std::int32_t signb{}, sign1{};
+            LUblocked<4>(A, lub, pivb, signb);
+            LUblocked<N>(A, lu1, piv1, sign1);
+            assert(signb == sign1);
+            for (std::size_t i{}; i < N; ++i) {
+                assert(pivb[i] == piv1[i]);
+            }
+            for (std::size_t i{}; i < N * N; ++i) {
+                assert(std::abs(lub.m_data[i] - lu1.m_data[i]) < 1e-10);
+            }
+
+            // P * A = L * U
+            MatrixBase<double, N, N> L(GetLowerTriangular(lub)), U(GetUpperTriangular(lub));
+            SetDiagonal(L, VectorBase<double, N>(1.0));
+            const MatrixBase<double, N, N> LU_(L * U);
+            for (std::size_t c{}; c < N; ++c) {
+                for (std::size_t r{}; r < N; ++r) {
+                    assert(std::abs(LU_(c, r) - A(c, pivb[r])) < 1e-10);
+                }
+            }
+
+            // determinant and inverse
+            double detLU{ static_cast<double>(signb) };
+            for (std::size_t i{}; i < N; ++i) detLU *= lub(i, i);
+            assert(std::abs(Determinant(A) - detLU) <= 1e-12 * std::abs(detLU));
+
+            const MatrixBase<double, N, N> I(Inv(A) * A);
+            for (std::size_t c{}; c < N; ++c) {
+                for (std::size_t r{}; r < N; ++r) {
+                    assert(std::abs(I(c, r) - (c == r ? 1.0 : 0.0)) < 1e-9);
+                }
+            }
+        }
+
         // QR decomposition (gram schmidt)
         MatrixBase<double, 3, 3> QR33( 1, 1, 0,
                                        1, 0, 1,
@@ -2175,6 +2280,64 @@ void MatrixBaseTest() {
         assert(w == weq);
         assert(vt == vteq);
         assert(us == useq);
+
+        // blocked (one sided) jacobi SVD decomposition (odd number of blocks)
+        MatrixBase<double, 5, 5> uj, vj;
+        VectorBase<double, 5> sj;
+        flag = SVDjacobi<2>(a5, uj, sj, vj);
+        assert(flag == true);
+        for (std::size_t i{}; i < 5; ++i) {
+            assert(std::abs(sj[i] - weq[i]) < 1e-10);
+        }
+        for (std::size_t c{}; c < 5; ++c) {
+            for (std::size_t r{}; r < 5; ++r) {
+                double usvt{};
+                for (std::size_t k{}; k < 5; ++k) {
+                    usvt += uj(k, r) * sj[k] * vj(k, c);
+                }
+                assert(std::abs(usvt - a5(c, r)) < 1e-10);
+            }
+        }
+
+        // blocked jacobi SVD decomposition of a rectangular matrix and of a matrix large enough to be solved in parallel
+        const auto CheckSVD = [](const auto& A) {
+            using mat_t = std::decay_t<decltype(A)>;
+            constexpr std::size_t COL{ Columns_v<mat_t> },
+                                  ROW{ Rows_v<mat_t> };
+            mat_t u(0.0);
+            VectorBase<double, COL> s;
+            MatrixBase<double, COL, COL> v;
+            assert(SVDjacobi<4>(A, u, s, v) == true);
+
+            for (std::size_t i{ 1 }; i < COL; ++i) {
+                assert(s[i - 1] >= s[i]);
+            }
+            for (std::size_t i{}; i < COL; ++i) {
+                for (std::size_t j{}; j < COL; ++j) {
+                    double uu{}, vv{};
+                    for (std::size_t k{}; k < ROW; ++k) uu += u(i, k) * u(j, k);
+                    for (std::size_t k{}; k < COL; ++k) vv += v(i, k) * v(j, k);
+                    assert(std::abs(uu - static_cast<double>(i == j)) < 1e-10);
+                    assert(std::abs(vv - static_cast<double>(i == j)) < 1e-10);
+                }
+            }
+            for (std::size_t c{}; c < COL; ++c) {
+                for (std::size_t r{}; r < ROW; ++r) {
+                    double usvt{};
+                    for (std::size_t k{}; k < COL; ++k) {
+                        usvt += u(k, r) * s[k] * v(k, c);
+                    }
+                    assert(std::abs(usvt - A(c, r)) < 1e-9);
+                }
+            }
+        };
+
+        MatrixBase<double, 6, 9> rect(0.0);
+        MatrixBase<double, 40, 40> large;
+        for (std::size_t i{}; i < 54; ++i)   rect.m_data[i]  = std::sin(static_cast<double>(i * i) * 0.37);
+        for (std::size_t i{}; i < 1600; ++i) large.m_data[i] = std::cos(static_cast<double>(i) * 1.7) + ((i % 41) == 0 ? 3.0 : 0.0);
+        CheckSVD(rect);
+        CheckSVD(large);
     }
 
     // linear equation system solver
@@ -2205,6 +2368,69 @@ void MatrixBaseTest() {
         xc = SolveQR(spd, bc);
         xceq = VectorBase<double, 3>(257.61111111110677, -70.555555555554392, 11.111111111110915);
         assert(xc == xceq);
+
+        // least squares using blocked Householder QR decomposition
+        {
+            constexpr std::size_t COL{ 11 },
+                                  ROW{ 60 };
+            MatrixBase<double, COL, ROW> A(0.0), qr(0.0), qr1(0.0);
+            VectorBase<double, COL> tau, tau1, xtrue;
+            for (std::size_t c{}; c < COL; ++c) {
+                xtrue[c] = static_cast<double>(c) - 4.5;
+                for (std::size_t r{}; r < ROW; ++r) {
+                    A(c, r) = std::sin(static_cast<double>(c * ROW + r) * 0.61) + ((c == r) ? 2.0 : 0.0);
+                }
+            }
+
+            // blocked and unblocked factorizations agree
+            QRhouseholder<4>(A, qr, tau);
+            QRhouseholder<1>(A, qr1, tau1);
+            for (std::size_t i{}; i < COL * ROW; ++i) {
+                assert(std::abs(qr.m_data[i] - qr1.m_data[i]) < 1e-12);
+            }
+
+            // R diagonal magnitude match Givens QR
+            MatrixBase<double, COL, ROW> Qg(0.0);
+            MatrixBase<double, COL, COL> Rg(0.0);
+            QRgivensRotations(A, Qg, Rg);
+            for (std::size_t i{}; i < COL; ++i) {
+                assert(std::abs(std::abs(qr(i, i)) - std::abs(Rg(i, i))) < 1e-10);
+            }
+
+            // consistent system is solved exactly
+            VectorBase<double, ROW> b;
+            for (std::size_t r{}; r < ROW; ++r) {
+                b[r] = 0.0;
+                for (std::size_t c{}; c < COL; ++c) b[r] += A(c, r) * xtrue[c];
+            }
+            VectorBase<double, COL> xls(SolveLeastSquares(qr, tau, b));
+            for (std::size_t c{}; c < COL; ++c) {
+                assert(std::abs(xls[c] - xtrue[c]) < 1e-10);
+            }
+
+            // inconsistent system - residual is orthogonal to A columns
+            MatrixBase<double, 3, ROW> B(0.0);
+            for (std::size_t r{}; r < ROW; ++r) {
+                B(0, r) = b[r];
+                B(1, r) = std::cos(static_cast<double>(r));
+                B(2, r) = static_cast<double>(r % 7);
+            }
+            const MatrixBase<double, 3, COL> X(SolveLeastSquares(A, B));
+            for (std::size_t n{}; n < 3; ++n) {
+                for (std::size_t c{}; c < COL; ++c) {
+                    double atr{};
+                    for (std::size_t r{}; r < ROW; ++r) {
+                        double ax{};
+                        for (std::size_t k{}; k < COL; ++k) ax += A(k, r) * X(n, k);
+                        atr += A(c, r) * (ax - B(n, r));
+                    }
+                    assert(std::abs(atr) < 1e-9);
+                }
+            }
+            for (std::size_t c{}; c < COL; ++c) {
+                assert(std::abs(X(0, c) - xtrue[c]) < 1e-10);
+            }
+        }
     }
 
     // specialized 2X2 matrix operations
@@ -2267,6 +2493,2067 @@ void MatrixBaseTest() {
     std::cout << "MatrixBase test successfully finished." << std::endl;
 }
 
+// ----------------------------
+// --- noise functions test ---
+// ----------------------------
+void NoiseTest() {
+    // determinism and lattice behavior
+    {
+        vec3 p(1.25f, -3.5f, 7.75f);
+        assert(GradientNoise(p) == GradientNoise(p));
+        assert(ValueNoise(p) == ValueNoise(p));
+        assert(SimplexNoise(p) == SimplexNoise(p));
+        assert(WorleyNoise(p) == WorleyNoise(p));
+
+        // gradient noise vanishes on lattice points
+        assert(GradientNoise(vec2(3.0f, -7.0f)) == 0.0f);
+        assert(GradientNoise(vec3(3.0f, -7.0f, 11.0f)) == 0.0f);
+        assert(GradientNoise(vec4(3.0f, -7.0f, 11.0f, 2.0f)) == 0.0f);
+    }
+
+    // range and continuity
+    {
+        float maxValue{}, maxGradient{}, maxSimplex{}, maxSimplex4{}, maxStep{}, maxStep4{};
+        for (std::size_t i{}; i < 20000; ++i) {
+            const float x{ static_cast<float>(i) * 0.0137f - 50.0f },
+                        y{ static_cast<float>(i % 97) * 0.731f },
+                        z{ static_cast<float>(i % 31) * 1.377f };
+            const vec3 p(x, y, z);
+            const float v{ ValueNoise(p) },
+                        g{ GradientNoise(p) },
+                        s{ SimplexNoise(p) },
+                        w{ WorleyNoise(p) };
+
+            maxValue    = std::max(maxValue,    std::abs(v));
+            maxGradient = std::max(maxGradient, std::abs(g));
+            maxSimplex  = std::max(maxSimplex,  std::abs(s));
+            assert(w >= 0.0f && w < 2.0f);
+
+            const vec3 q(x + 1e-3f, y, z);
+            maxStep = std::max(maxStep, std::abs(GradientNoise(q) - g));
+
+            const vec4 p4(x, y, z, static_cast<float>(i % 13) * 0.577f);
+            const float s4{ SimplexNoise(p4) };
+            maxSimplex4 = std::max(maxSimplex4, std::abs(s4));
+            maxStep4 = std::max(maxStep4, std::abs(SimplexNoise(vec4(x, y, z, p4.w + 1e-3f)) - s4));
+        }
+        assert(maxValue <= 1.0f);
+        assert(maxGradient <= 1.0f);
+        assert(maxSimplex <= 1.1f);
+        assert(maxSimplex4 <= 1.1f && maxSimplex4 > 0.3f);
+        assert(maxStep < 1e-2f);
+        assert(maxStep4 < 1e-2f);
+    }
+
+    // GLSL style noise and fbm
+    {
+        const vec2 p(0.3f, 0.7f);
+        const vec4 n4{ noise4(p) };
+        assert(n4.x == noise1(p));
+        assert(n4.x != n4.y);
+
+        const float f1{ fbm(p, 1) },
+                    f5{ fbm(p, 5) },
+                    fw{ fbm(p, 3, [](const vec2& c) { return WorleyNoise(c); }) };
+        assert(f1 == GradientNoise(p));
+        assert(std::abs(f5) <= 2.0f);
+        assert(fw >= 0.0f);
+
+        // lacunarity and gain
+        const float f2{ fbm(p, 2, 3.0f) },
+                    f2g{ fbm(p, 2, 3.0f, 0.25f) };
+        assert(std::abs(f2 - (GradientNoise(p) + 0.5f * GradientNoise(p * 3.0f))) < 1e-6f);
+        assert(std::abs(f2g - (GradientNoise(p) + 0.25f * GradientNoise(p * 3.0f))) < 1e-6f);
+        assert(std::abs(fbm(p, 3, [](const vec2& c) { return ValueNoise(c); }, 3.0f, 0.25f) -
+                        (ValueNoise(p) + 0.25f * ValueNoise(p * 3.0f) + 0.0625f * ValueNoise(p * 9.0f))) < 1e-6f);
+    }
+
+    // structure of arrays batches match the per sample functions
+    {
+        constexpr std::size_t count{ 37 };
+        float x[count], y[count], z[count], out[count];
+        for (std::size_t i{}; i < count; ++i) {
+            x[i] = static_cast<float>(i) * 0.37f - 3.0f;
+            y[i] = static_cast<float>(i) * -0.21f + 1.0f;
+            z[i] = static_cast<float>(i) * 0.11f;
+        }
+        const std::array<const float*, 3> coordinates{ x, y, z };
+
+        GradientNoise(coordinates, out, count);
+        for (std::size_t i{}; i < count; ++i) assert(out[i] == GradientNoise(vec3(x[i], y[i], z[i])));
+
+        ValueNoise(coordinates, out, count);
+        for (std::size_t i{}; i < count; ++i) assert(out[i] == ValueNoise(vec3(x[i], y[i], z[i])));
+
+        SimplexNoise(coordinates, out, count);
+        for (std::size_t i{}; i < count; ++i) assert(out[i] == SimplexNoise(vec3(x[i], y[i], z[i])));
+
+        const std::array<const float*, 4> coordinates4{ x, y, z, x };
+        SimplexNoise(coordinates4, out, count);
+        for (std::size_t i{}; i < count; ++i) assert(out[i] == SimplexNoise(vec4(x[i], y[i], z[i], x[i])));
+
+        WorleyNoise(coordinates, out, count);
+        for (std::size_t i{}; i < count; ++i) assert(out[i] == WorleyNoise(vec3(x[i], y[i], z[i])));
+
+        fbm(coordinates, out, count, 4);
+        for (std::size_t i{}; i < count; ++i) assert(std::abs(out[i] - fbm(vec3(x[i], y[i], z[i]), 4)) < 1e-6f);
+    }
+
+    std::cout << "Noise test successfully finished." << std::endl;
+}
+
+// --------------------
+// --- texture test ---
+// --------------------
+void TextureTest() {
+    // 4x4 texture whose texel value is its row major index
+    float texels[16];
+    for (std::size_t i{}; i < 16; ++i) texels[i] = static_cast<float>(i);
+
+    Texture2D<float> tiled(4, 4, texels);
+    Texture2D<float, TextureLayout::Linear> linear(4, 4, texels);
+
+    // mip chain
+    {
+        assert(tiled.Levels() == 3);
+        assert(tiled.Width(1) == 2 && tiled.Height(2) == 1);
+        assert(tiled.Texel(0, 0, 1) == 2.5f);
+        assert(tiled.Texel(0, 0, 2) == 7.5f);
+        assert(textureSize(tiled, 1).x == 2);
+        assert(texelFetch(tiled, ivec2(5, -1), 0) == 13.0f);
+    }
+
+    // nearest and bilinear filtering
+    {
+        tiled.SetFilter(TextureFilter::Nearest);
+        assert(texture(tiled, vec2(0.125f, 0.125f)) == 0.0f);
+        assert(texture(tiled, vec2(0.9f, 0.4f)) == 7.0f);
+
+        tiled.SetFilter(TextureFilter::Bilinear);
+        assert(texture(tiled, vec2(0.125f, 0.125f)) == 0.0f);
+        assert(texture(tiled, vec2(0.25f, 0.125f)) == 0.5f);
+        assert(texture(tiled, vec2(0.25f, 0.25f)) == 2.5f);
+
+        // wrapping modes at the border
+        tiled.SetWrap(TextureWrap::Clamp);
+        assert(texture(tiled, vec2(0.0f, 0.125f)) == 0.0f);
+        tiled.SetWrap(TextureWrap::Repeat);
+        assert(texture(tiled, vec2(0.0f, 0.125f)) == 1.5f);
+        tiled.SetWrap(TextureWrap::MirroredRepeat);
+        assert(texture(tiled, vec2(1.125f, 0.125f)) == 3.0f);
+        tiled.SetWrap(TextureWrap::Repeat);
+    }
+
+    // level of detail selection
+    {
+        tiled.SetFilter(TextureFilter::Bilinear);
+        assert(textureLod(tiled, vec2(0.5f, 0.5f), 2.0f) == 7.5f);
+
+        tiled.SetFilter(TextureFilter::Trilinear);
+        const vec2 uv(0.3f, 0.6f);
+        const float l0{ textureLod(tiled, uv, 0.0f) },
+                    l1{ textureLod(tiled, uv, 1.0f) },
+                    half{ textureLod(tiled, uv, 0.5f) };
+        assert(std::abs(half - 0.5f * (l0 + l1)) < 1e-5f);
+        assert(textureGrad(tiled, uv, vec2(0.5f, 0.0f), vec2(0.0f, 0.5f)) == textureLod(tiled, uv, 1.0f));
+    }
+
+    // layouts and batches produce the same samples
+    {
+        linear.SetFilter(TextureFilter::Trilinear);
+        std::array<vec2, 8> uv;
+        for (std::size_t i{}; i < 8; ++i) uv[i] = vec2(static_cast<float>(i) * 0.173f - 0.4f, static_cast<float>(i) * 0.311f);
+
+        const auto batch = textureLod(tiled, uv, 0.7f);
+        for (std::size_t i{}; i < 8; ++i) {
+            assert(batch[i] == textureLod(tiled, uv[i], 0.7f));
+            assert(batch[i] == textureLod(linear, uv[i], 0.7f));
+        }
+
+        float u[11], v[11], out[11];
+        for (std::size_t i{}; i < 11; ++i) {
+            u[i] = static_cast<float>(i) * 0.093f;
+            v[i] = 1.0f - static_cast<float>(i) * 0.051f;
+        }
+        linear.Sample(u, v, out, 11);
+        for (std::size_t i{}; i < 11; ++i) assert(out[i] == texture(tiled, vec2(u[i], v[i])));
+    }
+
+    // vector texels
+    {
+        std::vector<vec4> colors(9 * 5);
+        for (std::size_t i{}; i < colors.size(); ++i) colors[i] = vec4(static_cast<float>(i), 1.0f, 0.0f, 0.5f);
+
+        Texture2D<vec4> image(9, 5, colors.data());
+        assert(image.Levels() == 4);
+        const vec4 c{ texture(image, vec2(1.5f / 9.0f, 0.5f / 5.0f)) };
+        assert(c.x == 1.0f && c.y == 1.0f && c.z == 0.0f && c.w == 0.5f);
+    }
+
+    std::cout << "Texture test successfully finished." << std::endl;
+}
+
+
+void FactorizationTest() {
+    // a well conditioned symmetric positive definite matrix and a few right hand sides
+    constexpr std::size_t N{ 12 };
+    MatrixBase<double, N, N> A(0.0);
+    for (std::size_t c{}; c < N; ++c) {
+        for (std::size_t r{}; r < N; ++r) {
+            A(c, r) = 1.0 / static_cast<double>(1 + c + r) + (c == r ? 2.0 : 0.0);
+        }
+    }
+    VectorBase<double, N> b;
+    MatrixBase<double, 3, N> B(0.0);
+    for (std::size_t r{}; r < N; ++r) {
+        b[r] = std::sin(static_cast<double>(r));
+        B(0, r) = b[r];
+        B(1, r) = static_cast<double>(r);
+        B(2, r) = std::cos(static_cast<double>(3 * r));
+    }
+
+    const auto residual = [&A](const auto& x, const auto& rhs) {
+        double xo_max{};
+        for (std::size_t r{}; r < N; ++r) {
+            double ax{};
+            for (std::size_t c{}; c < N; ++c) ax += A(c, r) * x[c];
+            xo_max = std::max(xo_max, std::abs(ax - rhs[r]));
+        }
+        return xo_max;
+    };
+    const auto isIdentity = [](const MatrixBase<double, N, N>& I, const double tol) {
+        for (std::size_t c{}; c < N; ++c) {
+            for (std::size_t r{}; r < N; ++r) {
+                if (std::abs(I(c, r) - (c == r ? 1.0 : 0.0)) > tol) return false;
+            }
+        }
+        return true;
+    };
+
+    const double det{ Determinant(A) };
+
+    // LU
+    {
+        const LUFactor<MatrixBase<double, N, N>> lu(A);
+        assert(residual(lu.solve(b), b) < 1e-12);
+
+        const MatrixBase<double, 3, N> X(lu.solve(B));
+        for (std::size_t k{}; k < 3; ++k) {
+            assert(residual(X[k], B[k]) < 1e-11);
+        }
+
+        assert(std::abs(lu.determinant() - det) < 1e-10 * std::abs(det));
+        assert(isIdentity(lu.inverse() * A, 1e-10));
+
+        // small matrix, same results as the functional interface
+        MatrixBase<double, 3, 3> a3(4.0, 1.0, 2.0,
+                                    1.0, 5.0, 3.0,
+                                    2.0, 3.0, 6.0);
+        const VectorBase<double, 3> b3(1.0, 2.0, 3.0),
+                                    x3(LUFactor<MatrixBase<double, 3, 3>>(a3).solve(b3)),
+                                    y3(SolveSquareLU(a3, b3));
+        for (std::size_t i{}; i < 3; ++i) {
+            assert(std::abs(x3[i] - y3[i]) < 1e-14);
+        }
+    }
+
+    // Cholesky
+    {
+        CholeskyFactor<MatrixBase<double, N, N>> chol(A);
+        assert(residual(chol.solve(b), b) < 1e-12);
+        const MatrixBase<double, 3, N> X(chol.solve(B));
+        for (std::size_t k{}; k < 3; ++k) {
+            assert(residual(X[k], B[k]) < 1e-11);
+        }
+        assert(std::abs(chol.determinant() - det) < 1e-10 * std::abs(det));
+        assert(isIdentity(chol.inverse() * A, 1e-10));
+
+        // rank one update matches decomposition of updated matrix
+        VectorBase<double, N> v;
+        for (std::size_t i{}; i < N; ++i) v[i] = 0.5 * std::cos(static_cast<double>(i));
+        MatrixBase<double, N, N> Aup(A);
+        for (std::size_t c{}; c < N; ++c) {
+            for (std::size_t r{}; r < N; ++r) {
+                Aup(c, r) += v[c] * v[r];
+            }
+        }
+        chol.update(v);
+        const CholeskyFactor<MatrixBase<double, N, N>> cholUp(Aup);
+        for (std::size_t i{}; i < N * N; ++i) {
+            assert(std::abs(chol.lower().m_data[i] - cholUp.lower().m_data[i]) < 1e-12);
+        }
+
+        // downdate restores the original decomposition
+        assert(chol.downdate(v));
+        const CholeskyFactor<MatrixBase<double, N, N>> chol0(A);
+        for (std::size_t i{}; i < N * N; ++i) {
+            assert(std::abs(chol.lower().m_data[i] - chol0.lower().m_data[i]) < 1e-12);
+        }
+
+        // downdate which loses positive definiteness is rejected
+        VectorBase<double, N> big(0.0);
+        big[0] = 10.0;
+        const MatrixBase<double, N, N> before(chol.lower());
+        assert(!chol.downdate(big));
+        for (std::size_t i{}; i < N * N; ++i) {
+            assert(chol.lower().m_data[i] == before.m_data[i]);
+        }
+    }
+
+    // QR
+    {
+        const QRFactor<MatrixBase<double, N, N>> qr(A);
+        assert(residual(qr.solve(b), b) < 1e-12);
+        assert(std::abs(qr.determinant() - det) < 1e-10 * std::abs(det));
+        assert(isIdentity(qr.inverse() * A, 1e-10));
+
+        // rectangular - pseudo inverse times A is I
+        MatrixBase<double, 4, 9> R(0.0);
+        for (std::size_t i{}; i < 36; ++i) R.m_data[i] = std::sin(static_cast<double>(i * i) * 0.3);
+        const QRFactor<MatrixBase<double, 4, 9>> qrR(R);
+        const MatrixBase<double, 9, 4> pinv(qrR.inverse());
+        for (std::size_t c{}; c < 4; ++c) {
+            for (std::size_t r{}; r < 4; ++r) {
+                double prc{};
+                for (std::size_t k{}; k < 9; ++k) prc += pinv(k, r) * R(c, k);
+                assert(std::abs(prc - (c == r ? 1.0 : 0.0)) < 1e-10);
+            }
+        }
+    }
+
+    // mixed precision LU (float factorization, double residuals)
+    {
+        using Mixed = MixedPrecisionLUFactor<MatrixBase<double, N, N>, float>;
+        VectorBase<double, N> x;
+        const RefinementSolution<double> solution{ Mixed(A).solve(b, x) };
+        assert(solution.converged);
+        assert(solution.iterations >= 1);
+        assert(solution.backwardError <= Mixed::DefaultTolerance());
+        assert(residual(x, b) < 1e-13);
+
+        // small systems are factorized in working precision by default, so they are solved without refinement
+        VectorBase<double, N> direct;
+        const RefinementSolution<double> small{ SolveMixedPrecisionLU(A, b, direct) };
+        assert(small.converged);
+        assert(small.iterations == 0);
+        assert(small.backwardError <= Mixed::DefaultTolerance());
+        assert(residual(direct, b) < 1e-13);
+        const RefinementSolution<double> smallFactor{ MixedPrecisionLUFactor<MatrixBase<double, N, N>>(A).solve(b, x) };
+        assert(smallFactor.converged && (smallFactor.iterations == 0));
+
+        // a single float factorization serves several right hand sides
+        const Mixed factor(A);
+        for (std::size_t k{}; k < 3; ++k) {
+            VectorBase<double, N> bk, xk;
+            for (std::size_t r{}; r < N; ++r) bk[r] = B(k, r);
+            assert(factor.solve(bk, xk).converged);
+            assert(residual(xk, bk) < 1e-12);
+        }
+
+        // ill conditioned (Hilbert 5x5, condition ~5e5) - more refinement steps, double accuracy
+        MatrixBase<double, 5, 5> H(0.0);
+        for (std::size_t c{}; c < 5; ++c) {
+            for (std::size_t r{}; r < 5; ++r) H(c, r) = 1.0 / static_cast<double>(1 + c + r);
+        }
+        const VectorBase<double, 5> ones(1.0);
+        const VectorBase<double, 5> h(H * ones);
+        VectorBase<double, 5> y;
+        const RefinementSolution<double> hilbert{ MixedPrecisionLUFactor<MatrixBase<double, 5, 5>, float>(H).solve(h, y) };
+        assert(hilbert.converged);
+        assert(hilbert.iterations > solution.iterations);
+        for (std::size_t i{}; i < 5; ++i) assert(std::abs(y[i] - 1.0) < 1e-9);
+
+        // too ill conditioned for float factorization (Hilbert 10x10, condition ~1.6e13) - reported as not converged
+        MatrixBase<double, 10, 10> H10(0.0);
+        for (std::size_t c{}; c < 10; ++c) {
+            for (std::size_t r{}; r < 10; ++r) H10(c, r) = 1.0 / static_cast<double>(1 + c + r);
+        }
+        VectorBase<double, 10> y10;
+        const RefinementSolution<double> failure{ MixedPrecisionLUFactor<MatrixBase<double, 10, 10>, float>(H10).solve(VectorBase<double, 10>(1.0), y10, 1e-15, 5) };
+        assert(!failure.converged);
+        assert(failure.iterations <= 5);
+
+        // large systems are factorized in float by default
+        constexpr std::size_t K{ 64 };
+        MatrixBase<double, K, K> D(0.0);
+        VectorBase<double, K> d, z;
+        for (std::size_t c{}; c < K; ++c) {
+            for (std::size_t r{}; r < K; ++r) D(c, r) = 1.0 / static_cast<double>(1 + c + r) + (c == r ? 1.0 : 0.0);
+            d[c] = std::cos(static_cast<double>(c));
+        }
+        using Large = MixedPrecisionLUFactor<MatrixBase<double, K, K>>;
+        const RefinementSolution<double> large{ SolveMixedPrecisionLU(D, d, z) };
+        assert(large.converged);
+        assert(large.iterations >= 1);
+        assert(large.backwardError <= Large::DefaultTolerance());
+    }
+}
+
+// bytes copied (or moved) by MatrixBase copy and move operations while executing a callable (zero unless 'Instrumented')
+template<class Fn> std::uint64_t MatrixBytesCopied(Fn&& xi_function) {
+    const auto bytes = []() { return tracking::Snapshot()[static_cast<std::size_t>(tracking::Type::MatrixBase)].bytes; };
+    const std::uint64_t before{ bytes() };
+    xi_function();
+    return bytes() - before;
+}
+
+void InPlaceTest() {
+    constexpr std::size_t N{ 16 };
+    using mat = MatrixBase<double, N, N>;
+    constexpr std::size_t matrixBytes{ sizeof(double) * N * N };
+
+    mat A(0.0);
+    for (std::size_t c{}; c < N; ++c) {
+        for (std::size_t r{}; r < N; ++r) {
+            A(c, r) = 1.0 / static_cast<double>(1 + c + r) + (c == r ? 2.0 : 0.0);
+        }
+    }
+
+    const auto copied = [](auto&& xi_function) { return MatrixBytesCopied(xi_function); };
+
+    // transpose
+    {
+        mat T1(0.0), T2(0.0), T3(A);
+        const std::size_t byValue{ copied([&]() { T1 = Transpose(A); }) },
+                          into{ copied([&]() { TransposeInto(T2, A); }) },
+                          inPlace{ copied([&]() { TransposeInPlace(T3); }) };
+        assert(!Instrumented || byValue >= matrixBytes);
+        assert(!Instrumented || into == 0);
+        assert(!Instrumented || inPlace == 0);
+        assert(T1 == T2);
+        assert(T1 == T3);
+
+        // aliased destination
+        mat T4(A);
+        TransposeInto(T4, T4);
+        assert(T4 == T1);
+        TransposeInPlace(T4);
+        assert(T4 == A);
+
+        MatrixBase<double, 3, 5> R(0.0);
+        MatrixBase<double, 5, 3> Rt(0.0);
+        for (std::size_t i{}; i < 15; ++i) R.m_data[i] = static_cast<double>(i);
+        TransposeInto(Rt, R);
+        for (std::size_t c{}; c < 3; ++c) {
+            for (std::size_t r{}; r < 5; ++r) {
+                assert(Rt(r, c) == R(c, r));
+            }
+        }
+    }
+
+    // inverse
+    {
+        mat I1(0.0), I2(0.0), I3(A);
+        const std::size_t byValue{ copied([&]() { I1 = Inv(A); }) },
+                          into{ copied([&]() { InvInto(I2, A); }) };
+        assert(!Instrumented || into == matrixBytes);    // LU decomposition
+        assert(!Instrumented || into < byValue);
+        assert(I1 == I2);
+
+        // aliased destination
+        InvInto(I3, I3);
+        assert(I3 == I1);
+
+        // small matrices
+        mat3 a3(4.0f, 1.0f, 2.0f,
+                1.0f, 5.0f, 3.0f,
+                2.0f, 3.0f, 6.0f), a3inv(a3);
+        InvInto(a3inv, a3inv);
+        assert(a3inv == Inv(a3));
+    }
+
+    // cholesky
+    {
+        mat L1(0.0), L2(A);
+        const std::size_t byValue{ copied([&]() { L1 = Cholesky(A); }) },
+                          inPlace{ copied([&]() { CholeskyInPlace(L2); }) };
+        assert(!Instrumented || byValue >= matrixBytes);
+        assert(!Instrumented || inPlace == 0);
+        assert(L1 == L2);
+        assert(Cholesky(mat(A)) == L1);
+    }
+
+    // orthonormalization, outer product and blocks
+    {
+        mat Q(A);
+        const std::size_t byValue{ copied([&]() { Q = Orthonormalize(A); }) },
+                          inPlace{ copied([&, B = A]() mutable { OrthonormalizeInPlace(B); }) };
+        assert(!Instrumented || inPlace < byValue);
+        mat Q2(A);
+        OrthonormalizeInPlace(Q2);
+        assert(Q == Q2);
+
+        VectorBase<double, N> x(1.5), y;
+        for (std::size_t i{}; i < N; ++i) y[i] = static_cast<double>(i);
+        mat O(0.0);
+        assert(copied([&]() { OuterProductInto(O, x, y); }) == 0 || !Instrumented);
+        assert(O == OuterProduct(x, y));
+        assert(copied([&]() { RankOneUpdate(O, -1.0, y, x); }) == 0 || !Instrumented);
+        assert(O == mat(0.0));
+
+        MatrixBase<double, 3, 4> block(0.0);
+        assert(copied([&]() { GetBlockInto<2, 4, 5, 8>(block, A); }) == 0 || !Instrumented);
+        assert(block == (GetBlock<2, 4, 5, 8>(A)));
+    }
+}
+
+void MatrixViewTest() {
+    constexpr std::size_t N{ 8 };
+    using mat = MatrixBase<double, N, N>;
+    const auto Equal = [](const double a, const double b) { return std::abs(a - b) < 1e-10; };
+
+    mat A(0.0);
+    for (std::size_t c{}; c < N; ++c) {
+        for (std::size_t r{}; r < N; ++r) {
+            A(c, r) = 1.0 / static_cast<double>(1 + c + r) + (c == r ? 2.0 : 0.0);
+        }
+    }
+
+    // read & write through vector views
+    {
+        mat B(A);
+        auto col{ ViewColumn(B, 2) };
+        auto row{ ViewRow(B, 3) };
+        auto diag{ ViewDiagonal(B) };
+        static_assert(is_VectorView_v<decltype(col)>, "");
+        static_assert(Length_v<decltype(row)> == N, "");
+
+        for (std::size_t i{}; i < N; ++i) {
+            assert(col[i] == A(2, i));
+            assert(row[i] == A(i, 3));
+            assert(diag[i] == A(i, i));
+        }
+
+        assert(MatrixBytesCopied([&]() {
+            col *= 2.0;
+            row += 1.0;
+            diag = 0.0;
+        }) == 0 || !Instrumented);
+        for (std::size_t i{}; i < N; ++i) {
+            const double expected{ (i == 2 ? 2.0 : 1.0) * A(i, 3) + 1.0 };
+            assert((i == 3) ? (B(i, 3) == 0.0) : Equal(B(i, 3), expected));
+            assert(B(i, i) == 0.0);
+        }
+
+        // assignment from vectors and (overlapping) views
+        VectorBase<double, N> v;
+        for (std::size_t i{}; i < N; ++i) v[i] = static_cast<double>(i);
+        col = v;
+        for (std::size_t i{}; i < N; ++i) assert(B(2, i) == v[i]);
+        const VectorBase<double, N> row2{ ViewRow(B, 2).eval() };
+        ViewColumn(B, 5) = ViewRow(B, 2);
+        for (std::size_t i{}; i < N; ++i) assert(B(5, i) == row2[i]);
+        ViewColumn(B, 0) = col;
+        for (std::size_t i{}; i < N; ++i) assert(B(0, i) == v[i]);
+        ViewRow(B, 0) = ViewColumn(B, 0);
+        for (std::size_t i{}; i < N; ++i) assert(B(i, 0) == v[i]);
+        col = v;
+
+        // arithmetic yields values
+        const VectorBase<double, N> sum{ col + v }, scaled{ 2.0 * col }, diff{ v - col };
+        for (std::size_t i{}; i < N; ++i) {
+            assert(sum[i] == 2.0 * v[i]);
+            assert(scaled[i] == 2.0 * v[i]);
+            assert(diff[i] == 0.0);
+        }
+
+        // read only views
+        const mat& Aconst{ A };
+        auto ccol{ ViewColumn(Aconst, 1) };
+        static_assert(std::is_same_v<decltype(ccol), VectorView<const double, N>>, "");
+        VectorView<const double, N> crow{ ViewRow(B, 1) };
+        assert(crow[4] == B(4, 1));
+    }
+
+    // dot, length, normalize
+    {
+        VectorBase<double, N> c1;
+        for (std::size_t i{}; i < N; ++i) c1[i] = A(1, i);
+        const auto v1{ ViewColumn(A, 1) };
+        const auto v2{ ViewColumn(A, 4) };
+        assert(MatrixBytesCopied([&]() {
+            assert(Equal(dot(v1, v1), dot(c1, c1)));
+            assert(Equal(dot(v1, v2), dot(v1.eval(), v2.eval())));
+            assert(Equal(dot(v1, c1), dot(c1, c1)));
+            assert(Equal(dot(ViewRow(A, 1), v1), dot(c1, c1)));
+            assert(Equal(length(v1), length(c1)));
+        }) == 0 || !Instrumented);
+
+        const VectorBase<double, N> n{ Normalize(v1) };
+        assert(Equal(length(n), 1.0));
+        assert(n == Normalize(c1));
+    }
+
+    // block views
+    {
+        mat B(A);
+        auto block{ ViewBlock<2, 4, 1, 6>(B) };
+        static_assert(std::is_same_v<decltype(block), BlockView<double, 3, 6>>, "");
+        assert(block.eval() == (GetBlock<2, 4, 1, 6>(A)));
+        assert(block(1, 2) == A(3, 3));
+
+        assert(MatrixBytesCopied([&]() {
+            block *= 3.0;
+            block.column(0) = 1.0;
+            block.row(5) -= 2.0;
+        }) == 0 || !Instrumented);
+        assert(B(2, 1) == 1.0);
+        assert(Equal(B(3, 3), 3.0 * A(3, 3)));
+        assert(Equal(B(4, 6), 3.0 * A(4, 6) - 2.0));
+        assert(B(5, 3) == A(5, 3));
+
+        auto square{ ViewBlock<0, 2, 0, 2>(B) };
+        square.diagonal() = 7.0;
+        for (std::size_t i{}; i < 3; ++i) assert(B(i, i) == 7.0);
+
+        MatrixBase<double, 3, 6> M(1.0);
+        block = M;
+        block += M;
+        assert(block.eval() == M + M);
+        ViewBlock<5, 7, 2, 7>(B) = block;
+        assert((GetBlock<5, 7, 2, 7>(B)) == M + M);
+    }
+
+    // block update and Schur complement
+    {
+        constexpr std::size_t K{ 3 };
+        mat B(A);
+
+        // general update against explicit product
+        MatrixBase<double, 3, 4> C(0.0), C0(0.0);
+        const MatrixBase<double, 2, 4> X{ GetBlock<0, 1, 0, 3>(A) };
+        const MatrixBase<double, 3, 2> Y{ GetBlock<4, 6, 5, 6>(A) };
+        for (std::size_t i{}; i < 12; ++i) C.m_data[i] = C0.m_data[i] = static_cast<double>(i);
+        SubtractProduct(C, ViewBlock<0, 1, 0, 3>(A), ViewBlock<4, 6, 5, 6>(A));
+        for (std::size_t c{}; c < 3; ++c) {
+            for (std::size_t r{}; r < 4; ++r) {
+                double expected{ C0(c, r) };
+                for (std::size_t k{}; k < 2; ++k) expected -= X(k, r) * Y(c, k);
+                assert(Equal(C(c, r), expected));
+            }
+        }
+
+        // S = A22 - A21 * inv(A11) * A12, evaluated in place (det(A) = det(A11) * det(S))
+        const MatrixBase<double, K, K> A11{ GetBlock<0, K - 1, 0, K - 1>(B) };
+        const MatrixBase<double, N - K, K> A12{ GetBlock<K, N - 1, 0, K - 1>(B) };
+        const LUFactor<MatrixBase<double, K, K>> lu(A11);
+        const MatrixBase<double, N - K, K> W{ lu.solve(A12) };
+
+        assert(MatrixBytesCopied([&]() { SubtractProduct(ViewBlock<K, N - 1, K, N - 1>(B), ViewBlock<0, K - 1, K, N - 1>(B), W); }) == 0 || !Instrumented);
+
+        const MatrixBase<double, N - K, N - K> S{ GetBlock<K, N - 1, K, N - 1>(B) };
+        assert(std::abs(Determinant(A) - Determinant(A11) * Determinant(S)) < 1e-10);
+
+        // solvers accept views
+        const LUFactor<mat> luA(A);
+        const CholeskyFactor<mat> cholA(A);
+        const QRFactor<mat> qrA(A);
+        const VectorBase<double, N> b{ ViewColumn(B, 7).eval() };
+        assert(luA.solve(ViewColumn(B, 7)) == luA.solve(b));
+        assert(cholA.solve(ViewColumn(B, 7)) == cholA.solve(b));
+        assert(qrA.solve(ViewColumn(B, 7)) == qrA.solve(b));
+    }
+}
+
+void PackedMatrixTest() {
+    constexpr std::size_t N{ 7 };
+    using mat = MatrixBase<double, N, N>;
+    const auto Equal = [](const double a, const double b) { return std::abs(a - b) < 1e-9; };
+
+    // symmetric positive definite matrix
+    mat A(0.0);
+    for (std::size_t c{}; c < N; ++c) {
+        for (std::size_t r{}; r < N; ++r) {
+            A(c, r) = 1.0 / static_cast<double>(1 + c + r) + (c == r ? 2.0 : 0.0);
+        }
+    }
+    VectorBase<double, N> x;
+    for (std::size_t i{}; i < N; ++i) x[i] = std::sin(static_cast<double>(i) + 0.5);
+
+    // dense reference for A * x
+    const auto multiply = [](const mat& M, const VectorBase<double, N>& v) {
+        VectorBase<double, N> xo(0.0);
+        for (std::size_t c{}; c < N; ++c) {
+            for (std::size_t r{}; r < N; ++r) {
+                xo[r] += M(c, r) * v[c];
+            }
+        }
+        return xo;
+    };
+
+    // symmetric matrix
+    {
+        static_assert(sizeof(SymmetricMatrix<double, N>) == sizeof(double) * N * (N + 1) / 2, "");
+
+        SymmetricMatrix<double, N> S(A);
+        assert(S.dense() == A);
+        assert(IsSymmetric(S));
+        for (std::size_t c{}; c < N; ++c) {
+            for (std::size_t r{}; r < N; ++r) {
+                assert(S(c, r) == S(r, c));
+            }
+        }
+
+        S(1, 4) = 9.0;
+        assert(S(4, 1) == 9.0);
+        S(1, 4) = A(1, 4);
+
+        const VectorBase<double, N> y{ S * x }, yRef{ multiply(A, x) };
+        for (std::size_t i{}; i < N; ++i) assert(Equal(y[i], yRef[i]));
+
+        MatrixBase<double, 3, N> B(0.0);
+        for (std::size_t i{}; i < 3 * N; ++i) B.m_data[i] = static_cast<double>(i % 5);
+        const MatrixBase<double, 3, N> SB{ S * B };
+        for (std::size_t k{}; k < 3; ++k) {
+            const VectorBase<double, N> col{ multiply(A, B[k]) };
+            for (std::size_t i{}; i < N; ++i) assert(Equal(SB(k, i), col[i]));
+        }
+
+        SymmetricMatrix<double, N> S2(S);
+        S2 += S;
+        S2 *= 0.5;
+        assert(S2.dense() == A);
+
+        const SymmetricMatrix<double, N> I;
+        assert(I.dense() == mat());
+    }
+
+    // triangular matrices
+    {
+        static_assert(sizeof(TriangularMatrix<double, N, Triangle::Upper>) == sizeof(double) * N * (N + 1) / 2, "");
+
+        const TriangularMatrix<double, N, Triangle::Lower> L(A);
+        const TriangularMatrix<double, N, Triangle::Upper> U(A);
+        const mat Ld{ GetLowerTriangular(A) }, Ud{ GetUpperTriangular(A) };
+        assert(L.dense() == Ld);
+        assert(U.dense() == Ud);
+        assert(L(3, 0) == 0.0);
+        assert(U(0, 3) == 0.0);
+        assert(U(3, 0) == A(3, 0));
+
+        const VectorBase<double, N> lx{ L * x }, ux{ U * x }, lxRef{ multiply(Ld, x) }, uxRef{ multiply(Ud, x) };
+        for (std::size_t i{}; i < N; ++i) {
+            assert(Equal(lx[i], lxRef[i]));
+            assert(Equal(ux[i], uxRef[i]));
+        }
+
+        // solvers
+        const VectorBase<double, N> lSol{ Solve(L, lx) }, uSol{ Solve(U, ux) },
+                                    ltSol{ SolveTransposed(L, multiply(Transpose(Ld), x)) },
+                                    utSol{ SolveTransposed(U, multiply(Transpose(Ud), x)) };
+        for (std::size_t i{}; i < N; ++i) {
+            assert(Equal(lSol[i], x[i]));
+            assert(Equal(uSol[i], x[i]));
+            assert(Equal(ltSol[i], x[i]));
+            assert(Equal(utSol[i], x[i]));
+        }
+
+        MatrixBase<double, 2, N> B(0.0);
+        B[0] = lx;
+        B[1] = lx * 2.0;
+        const MatrixBase<double, 2, N> X{ Solve(L, B) };
+        for (std::size_t i{}; i < N; ++i) {
+            assert(Equal(X(0, i), x[i]));
+            assert(Equal(X(1, i), 2.0 * x[i]));
+        }
+    }
+
+    // cholesky decomposition and solver
+    {
+        const SymmetricMatrix<double, N> S(A);
+        const TriangularMatrix<double, N, Triangle::Lower> L{ Cholesky(S) };
+        const mat Ldense{ Cholesky(A) };
+        for (std::size_t c{}; c < N; ++c) {
+            for (std::size_t r{}; r < N; ++r) {
+                assert(Equal(L(c, r), Ldense(c, r)));
+            }
+        }
+
+        const VectorBase<double, N> b{ S * x }, sol{ SolveCubicCholesky(S, b) };
+        for (std::size_t i{}; i < N; ++i) assert(Equal(sol[i], x[i]));
+    }
+
+    // cholesky decomposition skips columns with zero pivot (unrolled and general variant alike)
+    {
+        const TriangularMatrix<double, 2, Triangle::Lower> L{ Cholesky(SymmetricMatrix<double, 2>(MatrixBase<double, 2, 2>(0.0, 1.0,
+                                                                                                                          1.0, 1.0))) };
+        assert(Equal(L(0, 0), 0.0));
+        assert(Equal(L(0, 1), 1.0));
+        assert(Equal(L(1, 1), 1.0));
+    }
+
+    // eigen decomposition
+    {
+        const SymmetricMatrix<double, N> S(A);
+        VectorBase<double, N> values;
+        mat vectors(0.0);
+        assert(EigenSolverSymmetric(S, values, vectors));
+
+        for (std::size_t i{}; i < N; ++i) {
+            if (i > 0) assert(values[i - 1] >= values[i]);
+            const VectorBase<double, N> v{ vectors[i] }, Sv{ S * v };
+            assert(Equal(dot(v, v), 1.0));
+            for (std::size_t k{}; k < N; ++k) assert(Equal(Sv[k], values[i] * v[k]));
+        }
+
+        // determinant is the product of eigenvalues
+        assert(Equal(prod(values), Determinant(A)));
+
+        // small matrices
+        mat3 a3(4.0, 1.0, 2.0,
+                1.0, 5.0, 3.0,
+                2.0, 3.0, 6.0), vec3Dense, vec3Packed;
+        vec3 val3Dense, val3Packed;
+        EigenSolverSymmetric3x3(a3, val3Dense, vec3Dense);
+        EigenSolverSymmetric3x3(SymmetricMatrix<float, 3>(a3), val3Packed, vec3Packed);
+        assert(val3Dense == val3Packed);
+        assert(vec3Dense == vec3Packed);
+
+        mat2 a2(2.0, 1.0,
+                1.0, 3.0), u2Dense, u2Packed;
+        vec2 w2Dense, w2Packed;
+        SVDsymmetric2x2(a2, u2Dense, w2Dense);
+        SVDsymmetric2x2(SymmetricMatrix<float, 2>(a2), u2Packed, w2Packed);
+        assert(w2Dense == w2Packed);
+        assert(u2Dense == u2Packed);
+    }
+}
+
+void SparseMatrixTest() {
+    // CSR: 1D laplacian (with duplicate entries, given in arbitrary order)
+    {
+        constexpr std::size_t N{ 50 };
+        std::vector<Triplet<double>> entries;
+        for (std::size_t i{ N }; i-- > 0;) {
+            entries.push_back({ i, i, 1.0 });
+            entries.push_back({ i, i, 1.0 });
+            if (i > 0) entries.push_back({ i, i - 1, -1.0 });
+            if (i + 1 < N) entries.push_back({ i, i + 1, -1.0 });
+        }
+        const SparseMatrix<double> A(N, N, entries);
+        assert(A.rows() == N);
+        assert(A.nonZeros() == 3 * N - 2);
+        assert(A(3, 3) == 2.0);
+        assert(A(3, 4) == -1.0);
+        assert(A(3, 7) == 0.0);
+
+        std::vector<double> x(N), y;
+        for (std::size_t i{}; i < N; ++i) x[i] = std::sin(static_cast<double>(i));
+        A.multiply(x, y);
+        for (std::size_t i{}; i < N; ++i) {
+            const double expected{ 2.0 * x[i] - (i > 0 ? x[i - 1] : 0.0) - (i + 1 < N ? x[i + 1] : 0.0) };
+            assert(std::abs(y[i] - expected) < 1e-12);
+        }
+
+        // conjugate gradient converges in (at most) N iterations
+        std::vector<double> sol;
+        const IterativeSolution<double> cg{ ConjugateGradient(A, y, sol, 1e-10, 200) };
+        assert(cg.converged);
+        assert(cg.iterations <= N);
+        for (std::size_t i{}; i < N; ++i) assert(std::abs(sol[i] - x[i]) < 1e-7);
+
+        // zero right hand side
+        std::vector<double> zero(N, 0.0), x0(N, 1.0);
+        assert(ConjugateGradient(A, zero, x0).converged);
+        assert(x0[5] == 0.0);
+
+        // empty rows
+        const SparseMatrix<double> E(4, 4, { { 2, 1, 3.0 } });
+        assert(E.rowStart()[0] == 0 && E.rowStart()[2] == 0 && E.rowStart()[3] == 1 && E.rowStart()[4] == 1);
+        std::vector<double> ex(4, 1.0), ey;
+        E.multiply(ex, ey);
+        assert(ey[0] == 0.0 && ey[2] == 3.0 && ey[3] == 0.0);
+    }
+
+    // BSR: 'mat3' blocks over 'vec3' unknowns (badly scaled, so block jacobi preconditioning pays)
+    {
+        constexpr std::size_t N{ 40 };
+        std::vector<Triplet<mat3>> entries;
+        for (std::size_t i{}; i < N; ++i) {
+            const float s{ 1.0f + static_cast<float>(i % 7) * 10.0f };
+            const mat3 diag(4.0f * s, 1.0f, 0.0f,
+                            1.0f, 3.0f * s, 0.5f,
+                            0.0f, 0.5f, 5.0f * s);
+            entries.push_back({ i, i, diag });
+            if (i + 1 < N) {
+                const mat3 off(-1.0f, 0.2f, 0.0f,
+                               0.2f, -1.0f, 0.0f,
+                               0.0f, 0.0f, -1.0f);
+                entries.push_back({ i, i + 1, off });
+                entries.push_back({ i + 1, i, off });
+            }
+        }
+        const SparseMatrix<mat3> A(N, N, entries);
+        assert(A.nonZeros() == 3 * N - 2);
+        assert(A(0, 5) == mat3(0.0f));
+
+        std::vector<vec3> x(N), b;
+        for (std::size_t i{}; i < N; ++i) x[i] = vec3(std::sin(static_cast<float>(i)), std::cos(static_cast<float>(i)), 1.0f);
+        A.multiply(x, b);
+
+        // compare with dense block multiplication
+        for (std::size_t i{}; i < N; ++i) {
+            VectorBase<float, 3> expected(0.0f);
+            for (std::size_t j{ i > 0 ? i - 1 : 0 }; j < std::min(N, i + 2); ++j) {
+                expected += A(i, j) * VectorBase<float, 3>(x[j][0], x[j][1], x[j][2]);
+            }
+            for (std::size_t k{}; k < 3; ++k) assert(std::abs(b[i][k] - expected[k]) < 1e-4f);
+        }
+
+        std::vector<vec3> xcg, xpcg;
+        const IterativeSolution<float> cg{ ConjugateGradient(A, b, xcg, 1e-5f, 500) },
+                                       pcg{ PreconditionedConjugateGradient(A, b, xpcg, 1e-5f, 500) };
+        assert(cg.converged);
+        assert(pcg.converged);
+        assert(pcg.iterations < cg.iterations);
+        for (std::size_t i{}; i < N; ++i) {
+            for (std::size_t k{}; k < 3; ++k) {
+                assert(std::abs(xcg[i][k] - x[i][k]) < 1e-3f);
+                assert(std::abs(xpcg[i][k] - x[i][k]) < 1e-3f);
+            }
+        }
+    }
+}
+
+void InstrumentationTest() {
+    using namespace instrumentation;
+    const auto Calls = [](const Counters& xi_counters, const Entry xi_entry) { return xi_counters[static_cast<std::size_t>(xi_entry)].calls; };
+    const auto Flops = [](const Counters& xi_counters, const Entry xi_entry) { return xi_counters[static_cast<std::size_t>(xi_entry)].flops; };
+    const auto Bytes = [](const Counters& xi_counters, const Entry xi_entry) { return xi_counters[static_cast<std::size_t>(xi_entry)].bytes; };
+
+    Reset();
+    for (const Counter& c : Snapshot()) assert((c.calls == 0) && (c.flops == 0) && (c.bytes == 0));
+
+    // dot
+    const VectorBase<double, 8> a(1.0), b(2.0);
+    assert(dot(a, b) == 16.0);
+    assert(dot(a) == 8.0);
+    Counters counters{ Snapshot() };
+    assert(Calls(counters, Entry::Dot) == 2);
+    assert(Flops(counters, Entry::Dot) == 2 * 8 + 2 * 8);
+    assert(Bytes(counters, Entry::Dot) == 3 * 8 * sizeof(double));
+
+    // inverse, LU and SVD
+    Reset();
+    mat3 m3(4.0f, 1.0f, 2.0f,
+            1.0f, 5.0f, 3.0f,
+            2.0f, 3.0f, 6.0f);
+    const mat3 m3inv{ Inv(m3) };
+    MatrixBase<double, 12, 12> A;
+    for (std::size_t i{}; i < 144; ++i) A.m_data[i] += std::sin(static_cast<double>(i));
+    const MatrixBase<double, 12, 12> Ainv{ Inv(A) };
+    counters = Snapshot();
+    assert(Calls(counters, Entry::Inv) == 2);
+    assert(Flops(counters, Entry::Inv) == 2 * 27 + 2 * 1728);
+    assert(Calls(counters, Entry::LU) == 1);    // large inverse is LU based
+    assert(Bytes(counters, Entry::Inv) == 2 * sizeof(mat3) + 2 * sizeof(A));
+
+    Reset();
+    MatrixBase<double, 4, 6> S(0.0), U(0.0);
+    for (std::size_t i{}; i < 24; ++i) S.m_data[i] = std::cos(static_cast<double>(i));
+    VectorBase<double, 4> W;
+    MatrixBase<double, 4, 4> V;
+    SVD(S, U, W, V);
+    SVDjacobi(S, U, W, V);
+    counters = Snapshot();
+    assert(Calls(counters, Entry::SVD) == 2);
+    assert(Calls(counters, Entry::Inv) == 0);
+
+    // matrix products and swizzle conversion
+    Reset();
+    const mat3 p3{ m3 * m3inv };
+    const VectorBase<float, 3> v3{ m3 * VectorBase<float, 3>(1.0f) };
+    const MatrixBase<double, 3, 5> r{ MatrixBase<double, 2, 5>(1.0) * MatrixBase<double, 3, 2>(1.0) };
+    vec4 v4(1.0f, 2.0f, 3.0f, 4.0f);
+    const vec3 sw = v4.wzy;
+    counters = Snapshot();
+    assert(Calls(counters, Entry::MatrixMultiply) == 2);
+    assert(Flops(counters, Entry::MatrixMultiply) == 2 * 27 + 2 * 3 * 5 * 2);
+    assert(Calls(counters, Entry::MatrixVectorMultiply) == 1);
+    assert(Calls(counters, Entry::SwizzleConversion) == 1);
+    assert(sw[0] == 4.0f);
+
+    // counters are per thread
+    std::thread([&]() {
+        assert(Snapshot()[static_cast<std::size_t>(Entry::MatrixMultiply)].calls == 0);
+        dot(a, b);
+    }).join();
+    assert(Calls(Snapshot(), Entry::Dot) == Calls(counters, Entry::Dot));
+
+    // report lists called entry points (and leaves stream formatting as it was)
+    std::ostringstream report;
+    report << std::scientific << std::setprecision(7);
+    const std::ios_base::fmtflags flags{ report.flags() };
+    Report(report);
+    assert(report.str().find("matrix * matrix") != std::string::npos);
+    assert(report.str().find("SVD") == std::string::npos);
+    assert((report.flags() == flags) && (report.precision() == 7));
+
+    (void)p3; (void)v3; (void)r; (void)m3inv; (void)Ainv;
+    Reset();
+}
+
+void TrackingTest() {
+    using namespace tracking;
+    const auto Expect = [](const Counter& xi_counter, const std::uint64_t xi_constructions, const std::uint64_t xi_copies, const std::uint64_t xi_moves) {
+        return (xi_counter.constructions == xi_constructions) && (xi_counter.copies == xi_copies) && (xi_counter.moves == xi_moves);
+    };
+
+    vec3 a(1.0f, 2.0f, 3.0f), b(4.0f, 5.0f, 6.0f), c;
+    const vec2 v2(7.0f, 8.0f);
+    mat3 m, n(2.0f);
+    Reset();
+    for (const Counter& counter : Snapshot()) assert(Expect(counter, 0, 0, 0));
+
+    // copy, move and assignment
+    {
+        Site site("vec3 copy");
+        vec3 x(a);
+        vec3 y(std::move(x));
+        c = y;
+        assert(Expect(site.counter(Type::VectorBase), 0, 2, 1));
+        assert(Expect(site.counter(Type::MatrixBase), 0, 0, 0));
+        assert(site.counter(Type::VectorBase).bytes == 3 * sizeof(VectorBase<float, 3>));
+    }
+    {
+        Site site("mat3 copy");
+        mat3 x(m);
+        x = n;
+        assert(Expect(site.counter(Type::MatrixBase), 0, 2, 0));
+        assert(Expect(site.counter(Type::VectorBase), 0, 2, 0));    // matrix storage
+        assert(site.counter(Type::MatrixBase).bytes == 2 * sizeof(mat3));
+    }
+
+    // swizzles
+    {
+        Site site("swizzle");
+        const vec2 x = a.xy;
+        a.yx = v2;
+        assert(Expect(site.counter(Type::VectorBase), 1, 0, 0));
+        assert(Expect(site.counter(Type::Swizzle), 0, 0, 0));
+        assert(x[1] == 2.0f);
+        assert(a[0] == 8.0f);
+    }
+
+    // vector expressions
+    {
+        Site site("a += b");
+        a += b;
+        assert(Expect(site.counter(Type::VectorBase), 0, 3, 0));    // operand captured by value
+    }
+    {
+        Site site("c = a + b");
+        c = a + b;
+        assert(Expect(site.counter(Type::VectorBase), 1, 5, 1));    // operands taken by value
+    }
+    {
+        Site site("c = a * 2");
+        c = a * 2.0f;
+        assert(Expect(site.counter(Type::VectorBase), 1, 1, 1));
+    }
+    {
+        Site site("dot(a, b)");
+        const float d{ dot(a, b) };
+        assert(Expect(site.counter(Type::VectorBase), 0, 0, 0));
+        assert(d == dot(b, a));
+    }
+
+    // matrix expressions
+    {
+        Site site("m + n");
+        const mat3 x{ m + n };
+        assert(Expect(site.counter(Type::MatrixBase), 0, 2, 1));
+        assert(x(0, 0) == 3.0f);
+    }
+    {
+        Site site("m * n");
+        const mat3 x{ m * n };
+        assert(Expect(site.counter(Type::MatrixBase), 1, 1, 2));
+        assert(x(0, 0) == 2.0f);
+    }
+    {
+        Site site("m *= n");
+        m *= n;
+        assert(Expect(site.counter(Type::MatrixBase), 1, 0, 1));
+    }
+    {
+        Site site("m * v");
+        const VectorBase<float, 3> x{ n * b.m_data };
+        assert(Expect(site.counter(Type::MatrixBase), 0, 0, 0));
+        assert(Expect(site.counter(Type::VectorBase), 1, 0, 0));
+        assert(x[0] == 30.0f);
+    }
+    {
+        Site site("Inv");
+        const mat3 x{ Inv(mat3()) };
+        assert(Expect(site.counter(Type::MatrixBase), 2, 0, 0));
+        assert(x(1, 1) == 1.0f);
+    }
+
+    // sites nest (inner counts are included in the outer site) and accumulate by name
+    {
+        Site outer("outer");
+        {
+            Site inner("inner");
+            vec3 x(a);
+            (void)x;
+        }
+        vec3 y(b);
+        (void)y;
+        assert(Expect(outer.counter(Type::VectorBase), 0, 2, 0));
+    }
+    {
+        Site inner("inner");
+        vec3 x(a);
+        (void)x;
+    }
+    const std::map<std::string, Counters> sites{ Sites() };
+    assert(Expect(sites.at("inner")[static_cast<std::size_t>(Type::VectorBase)], 0, 2, 0));
+    assert(Expect(sites.at("outer")[static_cast<std::size_t>(Type::VectorBase)], 0, 2, 0));
+    assert(sites.count("m * n") == 1);
+
+    // thread counters include events outside of any site
+    const std::uint64_t copies{ Snapshot()[static_cast<std::size_t>(Type::VectorBase)].copies };
+    vec3 z(a);
+    (void)z;
+    assert(Snapshot()[static_cast<std::size_t>(Type::VectorBase)].copies == copies + 1);
+    assert(Sites().at("inner")[static_cast<std::size_t>(Type::VectorBase)].copies == 2);
+
+    // counters are per thread
+    std::thread([&]() {
+        assert(Expect(Snapshot()[static_cast<std::size_t>(Type::VectorBase)], 0, 0, 0));
+        assert(Sites().empty());
+    }).join();
+
+    // report (leaves stream formatting as it was)
+    std::ostringstream report;
+    report << std::left;
+    const std::ios_base::fmtflags flags{ report.flags() };
+    Report(report, sites);
+    assert(report.flags() == flags);
+    assert(report.str().find("m * n:") != std::string::npos);
+    assert(report.str().find("MatrixBase") != std::string::npos);
+    assert(report.str().find("Swizzle") == std::string::npos);
+
+    Reset();
+    assert(Sites().empty());
+}
+
+void SummationTest() {
+    // cancellation - naive float accumulation loses the small terms
+    VectorBase<float, 16> x(0.0f), ones(1.0f);
+    x[0] = 1e8f;
+    x[5] = 1.0f;
+    x[9] = -1e8f;
+    x[13] = 1.0f;
+    assert(sum<Summation::Naive>(x) == sum(x));
+    assert(sum<Summation::Compensated>(x) == 2.0f);
+    assert(dot<Summation::Compensated>(x, ones) == 2.0f);
+
+    // Dot2 - products which cancel exactly in twice the working precision
+    const vec4 a(1e4f, 1.0f, -1e4f, 1e-3f),
+               b(1e4f, 3.0f,  1e4f, 1.0f);
+    assert(dot<Summation::Compensated>(a, b) == 3.001f);
+    const dvec4 da(1e8, 1.0, -1e8, 1e-3),
+                db(1e8, 3.0,  1e8, 1.0);
+    assert(dot<Summation::Compensated>(da, db) == 3.001);
+
+    // error free product (fused multiply add or Dekker's product, depending on target)
+    {
+        double p, e;
+        kernels::TwoProduct(1.0 + std::ldexp(1.0, -30), 1.0 - std::ldexp(1.0, -30), p, e);
+        assert(p == 1.0 && e == -std::ldexp(1.0, -60));
+        float pf, ef;
+        kernels::TwoProduct(3.0f + std::ldexp(1.0f, -20), 7.0f - std::ldexp(1.0f, -21), pf, ef);
+        assert(static_cast<double>(pf) + static_cast<double>(ef) == (3.0 + std::ldexp(1.0, -20)) * (7.0 - std::ldexp(1.0, -21)));
+    }
+
+    // long collections - compare against a double reference
+    constexpr std::size_t N{ 4099 };
+    auto u = std::make_unique<VectorBase<float, N>>(0.0f);
+    auto v = std::make_unique<VectorBase<float, N>>(0.0f);
+    double refSum{},
+           refDot{};
+    for (std::size_t i{}; i < N; ++i) {
+        (*u)[i] = static_cast<float>(std::sin(static_cast<double>(i) * 0.37) * 1e3 + 1e-2);
+        (*v)[i] = static_cast<float>(std::cos(static_cast<double>(i) * 0.11));
+        refSum += static_cast<double>((*u)[i]);
+        refDot += static_cast<double>((*u)[i]) * static_cast<double>((*v)[i]);
+    }
+    const double naiveSum{ std::abs(sum(*u) - refSum) },
+                 pairwiseSum{ std::abs(sum<Summation::Pairwise>(*u) - refSum) },
+                 compensatedSum{ std::abs(sum<Summation::Compensated>(*u) - refSum) };
+    assert(pairwiseSum <= naiveSum);
+    assert(compensatedSum <= std::abs(refSum) * 1e-7);
+    const double pairwiseDot{ std::abs(dot<Summation::Pairwise>(*u, *v) - refDot) },
+                 compensatedDot{ std::abs(dot<Summation::Compensated>(*u, *v) - refDot) };
+    assert(pairwiseDot <= std::abs(refDot) * 1e-4);
+    assert(compensatedDot <= std::abs(refDot) * 1e-7);
+    assert(dot<Summation::Naive>(*u, *v) == dot(*u, *v));
+
+    // products
+    VectorBase<double, 37> p;
+    double refProd{ 1.0 };
+    for (std::size_t i{}; i < 37; ++i) {
+        p[i] = 1.0 + static_cast<double>(i) * 1e-3;
+        refProd *= p[i];
+    }
+    assert(std::abs(prod<Summation::Pairwise>(p) - refProd) < 1e-13 * refProd);
+    assert(std::abs(prod<Summation::Compensated>(p) - refProd) < 1e-13 * refProd);
+    assert(prod<Summation::Naive>(p) == prod(p));
+
+    // matrices and short vectors
+    const mat3 m(1.0f, 2.0f, 3.0f,
+                 4.0f, 5.0f, 6.0f,
+                 7.0f, 8.0f, 9.0f);
+    assert(sum<Summation::Pairwise>(m) == 45.0f);
+    assert(sum<Summation::Compensated>(vec3(1.0f, 2.0f, 3.0f)) == 6.0f);
+}
+
+void LayoutTest() {
+    // row major matrix is filled row by row, and accessed by (column, row) just like a column major one
+    using RowMajor2x3 = MatrixBase<std::int32_t, 2, 3, Layout::RowMajor>;
+    using ColumnMajor2x3 = MatrixBase<std::int32_t, 2, 3>;
+    static_assert(is_RowMajor_v<RowMajor2x3> && !is_RowMajor_v<ColumnMajor2x3>);
+    static_assert((Columns_v<RowMajor2x3> == 2) && (Rows_v<RowMajor2x3> == 3));
+    const RowMajor2x3 r(1, 2,
+                        3, 4,
+                        5, 6);
+    const ColumnMajor2x3 c(1, 3, 5,
+                           2, 4, 6);
+    assert(r(1, 0) == 2);
+    assert(r(0, 2) == 5);
+    assert(r[1] == ivec3(2, 4, 6));
+    assert(GetRow(r, 1) == ivec2(3, 4));
+    assert(ColumnMajor2x3(r) == c);
+    assert(RowMajor2x3(c) == r);
+
+    // reinterpretation as a transpose does not touch storage
+    const MatrixBase<std::int32_t, 3, 2>& t{ AsTransposed(r) };
+    assert(static_cast<const void*>(&t) == static_cast<const void*>(&r));
+    for (std::size_t i{}; i < 2; ++i) {
+        for (std::size_t j{}; j < 3; ++j) {
+            assert(t(j, i) == r(i, j));
+        }
+    }
+
+    // products (same layout, mixed layout, matrix-vector)
+    constexpr std::size_t N{ 12 };
+    MatrixBase<double, N, N> A(0.0),
+                             S(0.0);
+    VectorBase<double, N> b;
+    for (std::size_t i{}; i < N; ++i) {
+        for (std::size_t j{}; j < N; ++j) {
+            A(i, j) = std::sin(1.0 + 7.0 * i + 3.0 * j) + (i == j ? 3.0 : 0.0);
+            S(i, j) = 1.0 / static_cast<double>(1 + i + j) + (i == j ? 2.0 : 0.0);
+        }
+        b[i] = static_cast<double>(i) - 4.0;
+    }
+    const MatrixBase<double, N, N, Layout::RowMajor> a(A),
+                                                     s(S);
+    const auto close = [](const auto& x, const auto& y, const double tol) {
+        for (std::size_t i{}; i < Columns_v<std::decay_t<decltype(x)>>; ++i) {
+            for (std::size_t j{}; j < Rows_v<std::decay_t<decltype(x)>>; ++j) {
+                if (std::abs(x(i, j) - y(i, j)) > tol) return false;
+            }
+        }
+        return true;
+    };
+    const auto closeVector = [](const VectorBase<double, N>& x, const VectorBase<double, N>& y, const double tol) {
+        return max(abs(x - y)) <= tol;
+    };
+    assert(close(a * s, A * S, 1e-12));
+    assert(close(a * S, A * S, 1e-12));
+    assert(close(A * s, A * S, 1e-12));
+    assert(closeVector(a * b, A * b, 1e-12));
+    assert(closeVector(b * a, b * A, 1e-12));
+    MatrixBase<double, N, N, Layout::RowMajor> m(a);
+    m *= s;
+    assert(close(m, A * S, 1e-12));
+
+    // transpose, determinant & inverse
+    assert(close(Transpose(a), Transpose(A), 0.0));
+    assert(std::abs(Determinant(a) - Determinant(A)) < 1e-10 * std::abs(Determinant(A)));
+    assert(close(Inv(a), Inv(A), 1e-12));
+    m = a;
+    InvInto(m, m);
+    assert(close(m, Inv(A), 1e-12));
+    const MatrixBase<double, 3, 3, Layout::RowMajor> a3(2.0, 1.0, 0.0,
+                                                        0.0, 3.0, 1.0,
+                                                        1.0, 0.0, 4.0);
+    assert(close(Inv(a3) * a3, MatrixBase<double, 3, 3>(), 1e-14));
+
+    // decompositions & solvers
+    {
+        MatrixBase<double, N, N> lu;
+        MatrixBase<double, N, N, Layout::RowMajor> lu1;
+        VectorBase<std::size_t, N> p, p1;
+        std::int32_t sign{}, sign1{};
+        LU(A, lu, p, sign);
+        LU(a, lu1, p1, sign1);
+        assert(close(lu1, lu, 0.0) && (p1 == p) && (sign1 == sign));
+    }
+    assert(closeVector(SolveSquareLU(a, b), SolveSquareLU(A, b), 1e-12));
+    assert(closeVector(SolveCubicCholesky(s, b), SolveCubicCholesky(S, b), 1e-12));
+    assert(closeVector(SolveLeastSquares(a, b), SolveLeastSquares(A, b), 1e-12));
+    assert(closeVector(LUFactor<std::decay_t<decltype(a)>>(a).solve(b), LUFactor<std::decay_t<decltype(A)>>(A).solve(b), 1e-12));
+    assert(closeVector(CholeskyFactor<std::decay_t<decltype(s)>>(s).solve(b), CholeskyFactor<std::decay_t<decltype(S)>>(S).solve(b), 1e-12));
+    assert(closeVector(QRFactor<std::decay_t<decltype(a)>>(a).solve(b), QRFactor<std::decay_t<decltype(A)>>(A).solve(b), 1e-12));
+    assert(close(LUFactor<std::decay_t<decltype(a)>>(a).inverse(), Inv(A), 1e-12));
+    {
+        MatrixBase<double, N, N, Layout::RowMajor> u, v;
+        VectorBase<double, N> w;
+        assert(SVDjacobi(a, u, w, v));
+        MatrixBase<double, N, N, Layout::RowMajor> W(0.0);
+        SetDiagonal(W, w);
+        assert(close(u * W * Transpose(v), A, 1e-12));
+    }
+    {
+        MatrixBase<double, N, N, Layout::RowMajor> q, r;
+        QRgivensRotations(a, q, r);
+        assert(IsUpperTriangular(r));
+        assert(close(q * r, A, 1e-12));
+    }
+
+    // swaps and views address elements by (column, row) in either layout
+    {
+        MatrixBase<double, 5, 4> C(0.0);
+        for (std::size_t i{}; i < 5; ++i) {
+            for (std::size_t j{}; j < 4; ++j) {
+                C(i, j) = static_cast<double>(10 * i + j);
+            }
+        }
+        MatrixBase<double, 5, 4, Layout::RowMajor> R(C);
+        const MatrixBase<double, 5, 4, Layout::RowMajor>& Rc{ R };
+        assert(close(SwapRows(R, 0, 3), SwapRows(C, 0, 3), 0.0));
+        assert(close(SwapColumns(R, 1, 4), SwapColumns(C, 1, 4), 0.0));
+
+        for (std::size_t j{}; j < 4; ++j) assert(ViewColumn(R, 2)[j] == C(2, j));
+        for (std::size_t i{}; i < 5; ++i) assert(ViewRow(Rc, 1)[i] == C(i, 1));
+        for (std::size_t i{}; i < N; ++i) assert(ViewDiagonal(a)[i] == A(i, i));
+
+        const auto block = ViewBlock<1, 3, 0, 2>(Rc);
+        assert(close(block.eval(), ViewBlock<1, 3, 0, 2>(C).eval(), 0.0));
+        for (std::size_t j{}; j < 3; ++j) assert(block.column(1)[j] == C(2, j));
+        for (std::size_t i{}; i < 3; ++i) assert(block.row(2)[i] == C(1 + i, 2));
+
+        ViewBlock<1, 3, 0, 2>(R) += 1.0;
+        ViewBlock<1, 3, 0, 2>(C) += 1.0;
+        ViewColumn(R, 4) *= 2.0;
+        ViewColumn(C, 4) *= 2.0;
+        assert(close(R, C, 0.0));
+
+        // block update of row major matrices
+        MatrixBase<double, N, N> D(A);
+        MatrixBase<double, N, N, Layout::RowMajor> d(a);
+        SubtractProduct(ViewBlock<0, 3, 0, 3>(D), ViewBlock<4, 8, 0, 3>(A), ViewBlock<0, 3, 4, 8>(S));
+        SubtractProduct(ViewBlock<0, 3, 0, 3>(d), ViewBlock<4, 8, 0, 3>(a), ViewBlock<0, 3, 4, 8>(s));
+        assert(close(d, D, 1e-12));
+    }
+}
+
+template<Layout L> void RankUpdateTestOfLayout() {
+    constexpr std::size_t COL{ 5 },
+                          ROW{ 4 },
+                          N{ 6 },
+                          K{ 11 };
+    using rect = MatrixBase<double, COL, ROW, L>;
+    using cubic = MatrixBase<double, N, N, L>;
+    const auto Equal = [](const double a, const double b) { return std::abs(a - b) < 1e-12; };
+
+    // general rank-1 update (A(c, r) += alpha * x[r] * y[c])
+    rect A(0.0), Aref(0.0);
+    for (std::size_t c{}; c < COL; ++c) {
+        for (std::size_t r{}; r < ROW; ++r) {
+            A(c, r) = Aref(c, r) = std::sin(static_cast<double>(c * ROW + r));
+        }
+    }
+    const VectorBase<double, ROW> x(1.0, -2.0, 0.5, 3.0);
+    const VectorBase<double, COL> y(2.0, 1.0, -1.0, 0.25, 4.0);
+    RankOneUpdate(A, 0.5, x, y);
+    for (std::size_t c{}; c < COL; ++c) {
+        for (std::size_t r{}; r < ROW; ++r) {
+            Aref(c, r) += 0.5 * x[r] * y[c];
+            assert(Equal(A(c, r), Aref(c, r)));
+        }
+    }
+
+    // general rank-k update from a stream of vector pairs (more than one packed block)
+    std::vector<VectorBase<double, ROW>> xs(K);
+    std::vector<VectorBase<double, COL>> ys(K);
+    for (std::size_t k{}; k < K; ++k) {
+        for (std::size_t r{}; r < ROW; ++r) xs[k][r] = std::cos(static_cast<double>(k + 3 * r));
+        for (std::size_t c{}; c < COL; ++c) ys[k][c] = std::sin(static_cast<double>(2 * k + c));
+    }
+    RankKUpdate(A, -1.5, xs.begin(), xs.end(), ys.begin());
+    for (std::size_t k{}; k < K; ++k) {
+        RankOneUpdate(Aref, -1.5, xs[k], ys[k]);
+    }
+    for (std::size_t i{}; i < COL * ROW; ++i) {
+        assert(Equal(A.m_data[i], Aref.m_data[i]));
+    }
+
+    // symmetric updates touch only the lower triangle
+    cubic S(0.0), Sref(0.0);
+    for (std::size_t c{}; c < N; ++c) {
+        for (std::size_t r{ c + 1 }; r < N; ++r) {
+            S(r, c) = -7.0;
+        }
+    }
+    const VectorBase<double, N> v(1.0, 2.0, 3.0, -1.0, 0.5, 2.5);
+    SymmetricRankOneUpdate(S, 2.0, v);
+    RankOneUpdate(Sref, 2.0, v, v);
+
+    std::vector<VectorBase<double, N>> vs(K);
+    for (std::size_t k{}; k < K; ++k) {
+        for (std::size_t i{}; i < N; ++i) vs[k][i] = std::cos(static_cast<double>(k * N + i));
+        RankOneUpdate(Sref, 0.25, vs[k], vs[k]);
+    }
+    SymmetricRankKUpdate(S, 0.25, vs.begin(), vs.end());
+    for (std::size_t c{}; c < N; ++c) {
+        for (std::size_t r{}; r < N; ++r) {
+            assert((r < c) ? (S(c, r) == -7.0) : Equal(S(c, r), Sref(c, r)));
+        }
+    }
+
+    SymmetrizeFromLower(S);
+    assert(IsSymmetric(S));
+    for (std::size_t i{}; i < N * N; ++i) {
+        assert(Equal(S.m_data[i], Sref.m_data[i]));
+    }
+}
+
+void RankUpdateTest() {
+    RankUpdateTestOfLayout<Layout::ColumnMajor>();
+    RankUpdateTestOfLayout<Layout::RowMajor>();
+
+    // replaces 'A += OuterProduct(x, y)'
+    const VectorBase<double, 3> x(1.0, 2.0, 3.0),
+                                y(-1.0, 0.5, 2.0);
+    MatrixBase<double, 3, 3> A(OuterProduct(x, y));
+    RankOneUpdate(A, 1.0, y, x);
+    assert(A == OuterProduct(x, y) * 2.0);
+
+    // symmetric update feeds cholesky directly (only the lower triangle is read)
+    MatrixBase<double, 3, 3> C;
+    SymmetricRankOneUpdate(C, 1.0, x);
+    MatrixBase<double, 3, 3> Cfull(C);
+    SymmetrizeFromLower(Cfull);
+    const MatrixBase<double, 3, 3> L(Cholesky(C)),
+                                   Lfull(Cholesky(Cfull));
+    for (std::size_t i{}; i < 9; ++i) {
+        assert(std::abs(L.m_data[i] - Lfull.m_data[i]) < 1e-12);
+    }
+
+    // householder reflection is built with a rank-1 update
+    const VectorBase<double, 6> v(Normalize(VectorBase<double, 6>(1.0, -2.0, 0.5, 3.0, 1.0, -1.0)));
+    const MatrixBase<double, 6, 6> H(Householder(v));
+    for (std::size_t c{}; c < 6; ++c) {
+        for (std::size_t r{}; r < 6; ++r) {
+            assert(std::abs(H(c, r) - ((c == r ? 1.0 : 0.0) - 2.0 * v[c] * v[r])) < 1e-14);
+        }
+    }
+}
+
+void StructuredSolverTest() {
+    constexpr std::size_t N{ 8 };
+    using vec = VectorBase<double, N>;
+    const auto Close = [](const vec& a, const vec& b, const double tolerance) {
+        for (std::size_t i{}; i < N; ++i) {
+            if (std::abs(a[i] - b[i]) > tolerance) return false;
+        }
+        return true;
+    };
+
+    vec b;
+    for (std::size_t i{}; i < N; ++i) {
+        b[i] = std::sin(static_cast<double>(i) + 0.5);
+    }
+
+    // symmetric positive definite Toeplitz (autocorrelation like)
+    vec t;
+    for (std::size_t i{}; i < N; ++i) {
+        t[i] = std::pow(0.6, static_cast<double>(i));
+    }
+    const vec xt(SolveToeplitz(t, b));
+    assert(Close(xt, SolveSquareLU(Toeplitz(t), b), 1e-10));
+    assert(Close(Toeplitz(t) * xt, b, 1e-12));
+
+    // small Toeplitz systems
+    const dvec2 t2(2.0, 1.0);
+    assert(std::abs(SolveToeplitz(t2, dvec2(3.0, 3.0)).x - 1.0) < 1e-14);
+    assert(std::abs(SolveToeplitz(t2, dvec2(3.0, 3.0)).y - 1.0) < 1e-14);
+    assert(SolveToeplitz(VectorBase<double, 1>(4.0), VectorBase<double, 1>(2.0))[0] == 0.5);
+
+    // van-der-monde system and polynomial interpolation
+    vec v;
+    for (std::size_t i{}; i < N; ++i) {
+        v[i] = -1.0 + 2.0 * static_cast<double>(i) / static_cast<double>(N - 1);
+    }
+    const vec xv(SolveVanDerMonde(v, b));
+    assert(Close(xv, SolveSquareLU(VanDerMonde(v), b), 1e-8));
+    assert(Close(VanDerMonde(v) * xv, b, 1e-10));
+
+    const vec coefficients(SolveVanDerMondeTransposed(v, b));
+    assert(Close(coefficients, SolveSquareLU(Transpose(VanDerMonde(v)), b), 1e-8));
+    for (std::size_t i{}; i < N; ++i) {
+        // horner evaluation of interpolating polynomial
+        double p{};
+        for (std::size_t j{}; j < N; ++j) {
+            p = p * v[i] + coefficients[j];
+        }
+        assert(std::abs(p - b[i]) < 1e-12);
+    }
+
+    // parabola through three points: y = 2x^2 - 3x + 1
+    const dvec3 parabola(SolveVanDerMondeTransposed(dvec3(0.0, 1.0, 2.0), dvec3(1.0, 0.0, 3.0)));
+    assert(std::abs(parabola.x - 2.0) < 1e-14);
+    assert(std::abs(parabola.y + 3.0) < 1e-14);
+    assert(std::abs(parabola.z - 1.0) < 1e-14);
+}
+
+template<Layout L> void EigenSolverTestOfLayout() {
+    constexpr std::size_t N{ 6 };
+    using mat = MatrixBase<double, N, N, L>;
+
+    // symmetric (stiffness like) matrix
+    mat A(0.0);
+    for (std::size_t c{}; c < N; ++c) {
+        for (std::size_t r{}; r <= c; ++r) {
+            A(c, r) = A(r, c) = std::sin(1.0 + static_cast<double>(7 * c + 3 * r)) + ((c == r) ? 4.0 : 0.0);
+        }
+    }
+
+    VectorBase<double, N> values, onlyValues;
+    mat vectors;
+    assert(EigenSolverSymmetric(A, values, vectors));
+    assert(EigenValuesSymmetric(A, onlyValues));
+    for (std::size_t i{}; i < N; ++i) {
+        assert(std::abs(values[i] - onlyValues[i]) < 1e-12);
+        if (i > 0) assert(values[i - 1] >= values[i]);
+
+        // A * v = lambda * v, eigenvectors are orthonormal
+        VectorBase<double, N> v;
+        for (std::size_t k{}; k < N; ++k) v[k] = vectors(i, k);
+        const VectorBase<double, N> Av(A * v);
+        for (std::size_t k{}; k < N; ++k) {
+            assert(std::abs(Av[k] - values[i] * v[k]) < 1e-12);
+        }
+        for (std::size_t j{}; j < N; ++j) {
+            double d{};
+            for (std::size_t k{}; k < N; ++k) d += vectors(i, k) * vectors(j, k);
+            assert(std::abs(d - ((i == j) ? 1.0 : 0.0)) < 1e-12);
+        }
+    }
+
+    // identical to cyclic jacobi
+    VectorBase<double, N> jacobiValues;
+    MatrixBase<double, N, N> jacobiVectors;
+    assert(EigenSolverSymmetric(SymmetricMatrix<double, N>(ColumnMajor(A)), jacobiValues, jacobiVectors));
+    for (std::size_t i{}; i < N; ++i) {
+        assert(std::abs(values[i] - jacobiValues[i]) < 1e-12);
+    }
+}
+
+void EigenSolverTest() {
+    EigenSolverTestOfLayout<Layout::ColumnMajor>();
+    EigenSolverTestOfLayout<Layout::RowMajor>();
+
+    // general matrix with known spectrum: A = S * D * S^-1, where D has eigenvalues 1..N-2 and a rotation block (0.5 +- 2i)
+    constexpr std::size_t N{ 8 };
+    MatrixBase<double, N, N> S(0.0),
+                             D(0.0);
+    for (std::size_t c{}; c < N; ++c) {
+        for (std::size_t r{}; r < N; ++r) {
+            S(c, r) = std::fmod(std::sin(static_cast<double>(c) * 12.9898 + static_cast<double>(r) * 78.233 + 1.0) * 43758.5453, 1.0);
+        }
+        D(c, c) = static_cast<double>(c) - 1.0;
+    }
+    D(0, 0) = D(1, 1) = 0.5;
+    D(1, 0) = 2.0;
+    D(0, 1) = -2.0;
+    const MatrixBase<double, N, N> A(S * D * Inv(S));
+
+    VectorBase<double, N> real, imaginary;
+    assert(EigenValues(A, real, imaginary));
+    for (std::size_t i{}; i < N - 2; ++i) {
+        assert(std::abs(real[i] - static_cast<double>(N - 2 - i)) < 1e-9);
+        assert(std::abs(imaginary[i]) < 1e-9);
+    }
+    assert(std::abs(real[N - 2] - 0.5) < 1e-9);
+    assert(std::abs(real[N - 1] - 0.5) < 1e-9);
+    assert(std::abs(imaginary[N - 2] - 2.0) < 1e-9);
+    assert(std::abs(imaginary[N - 1] + 2.0) < 1e-9);
+
+    // symmetric matrix through the general solver
+    const dmat3 B(2.0, 1.0, 0.0,
+                  1.0, 2.0, 1.0,
+                  0.0, 1.0, 2.0);
+    dvec3 re, im, sym;
+    assert(EigenValues(B, re, im));
+    assert(EigenValuesSymmetric(B, sym));
+    assert(std::abs(sym[0] - (2.0 + std::sqrt(2.0))) < 1e-14);
+    assert(std::abs(sym[1] - 2.0) < 1e-14);
+    assert(std::abs(sym[2] - (2.0 - std::sqrt(2.0))) < 1e-14);
+    for (std::size_t i{}; i < 3; ++i) {
+        assert(std::abs(re[i] - sym[i]) < 1e-14);
+        assert(im[i] == 0.0);
+    }
+}
+
+void LanczosTest() {
+    // covariance like matrix: few dominant directions on top of a decaying spectrum
+    constexpr std::size_t N{ 64 },
+                          K{ 4 };
+    MatrixBase<double, N, N> A(0.0);
+    for (std::size_t p{}; p < 2 * N; ++p) {
+        VectorBase<double, N> x;
+        for (std::size_t i{}; i < N; ++i) {
+            x[i] = std::fmod(std::sin(static_cast<double>(p) * 12.9898 + static_cast<double>(i) * 78.233 + 1.0) * 43758.5453, 1.0) * (i < 3 ? 4.0 / (1.0 + i) : 1.0 / (1.0 + i));
+        }
+        RankOneUpdate(A, 1.0 / static_cast<double>(2 * N), x, x);
+    }
+
+    VectorBase<double, N> values;
+    MatrixBase<double, N, N> vectors;
+    assert(EigenSolverSymmetric(A, values, vectors));
+
+    const auto check = [&](const VectorBase<double, K>& lambda, const MatrixBase<double, K, N>& x) {
+        for (std::size_t i{}; i < K; ++i) {
+            assert(std::abs(lambda[i] - values[i]) < 1e-10 * values[0]);
+            assert(std::abs(std::abs(dot(x[i], vectors[i])) - 1.0) < 1e-8);
+        }
+    };
+
+    // matrix form
+    VectorBase<double, K> lambda;
+    MatrixBase<double, K, N> x(0.0);
+    assert(EigenSolverLanczos(A, lambda, x));
+    check(lambda, x);
+
+    // operator form with explicit Krylov subspace dimension
+    std::size_t products{};
+    const auto product = [&A, &products](const VectorBase<double, N>& v) {
+        ++products;
+        return A * v;
+    };
+    lambda = 0.0;
+    x = 0.0;
+    assert(EigenSolverLanczos<16>(product, lambda, x, 1e-10));
+    assert(products < N);
+    check(lambda, x);
+
+    // row major output
+    MatrixBase<double, K, N, Layout::RowMajor> xr(0.0);
+    assert(EigenSolverLanczos(A, lambda, xr));
+    check(lambda, MatrixBase<double, K, N>(xr));
+
+    // failure of projected operator eigen decomposition is reported at once (no restarts)
+    products = 0;
+    const auto invalid = [&products](const VectorBase<double, N>&) {
+        ++products;
+        return VectorBase<double, N>(std::numeric_limits<double>::quiet_NaN());
+    };
+    assert(!EigenSolverLanczos<16>(invalid, lambda, x));
+    assert(products == 16);
+}
+
+void PolarDecompositionTest() {
+    // properties of a decomposition A = R * S
+    const auto check = [](const dmat3& A, const dmat3& R, const dmat3& S, const double tol) {
+        const dmat3 I;
+        const dmat3 RtR(Transpose(R) * R),
+                    RS(R * S);
+        for (std::size_t c{}; c < 3; ++c) {
+            for (std::size_t r{}; r < 3; ++r) {
+                assert(std::abs(RtR(c, r) - I(c, r)) < tol);
+                assert(std::abs(S(c, r) - S(r, c)) < tol);
+                assert(std::abs(RS(c, r) - A(c, r)) < tol * (1.0 + std::abs(A(c, r))));
+            }
+        }
+        assert(std::abs(Determinant(R) - 1.0) < tol);
+    };
+
+    // known decomposition - rotation around z times a stretch
+    {
+        const double angle{ 0.7 };
+        const dmat3 Rz(std::cos(angle), std::sin(angle), 0.0,
+                       -std::sin(angle), std::cos(angle), 0.0,
+                       0.0, 0.0, 1.0),
+                    Sd(2.0, 0.3, 0.1,
+                       0.3, 1.5, 0.2,
+                       0.1, 0.2, 0.8);
+        dmat3 R, S;
+        PolarDecomposition3x3(Rz * Sd, R, S);
+        check(Rz * Sd, R, S, 1e-12);
+        for (std::size_t i{}; i < 9; ++i) {
+            assert(std::abs(R.m_data[i] - Rz.m_data[i]) < 1e-12);
+            assert(std::abs(S.m_data[i] - Sd.m_data[i]) < 1e-12);
+        }
+    }
+
+    // rotation does not depend on the scale of the decomposed matrix (scalar and batch forms)
+    const auto scaled = [](const auto xi_zero) {
+        using T = std::remove_const_t<decltype(xi_zero)>;
+        const T tol{ static_cast<T>(64) * std::numeric_limits<T>::epsilon() };
+        const double values[9]{ 1.2, 0.9, 0.1, -0.8, 1.4, 0.2, 0.1, 0.2, 0.8 };
+        MatrixBase<T, 3, 3> A, R0, S0;
+        for (std::size_t i{}; i < 9; ++i) {
+            A.m_data[i] = static_cast<T>(values[i]);
+        }
+        PolarDecomposition3x3(A, R0, S0);
+
+        for (const T scale : { static_cast<T>(1e-3), static_cast<T>(1e3) }) {
+            const MatrixBase<T, 3, 3> As(A * scale);
+            MatrixBase<T, 3, 3> R, S;
+            PolarDecomposition3x3(As, R, S);
+
+            std::array<T, 9> batch;
+            std::array<const T*, 9> Ap;
+            std::array<T*, 9> Rp;
+            for (std::size_t j{}; j < 9; ++j) {
+                Ap[j] = &As.m_data.m_data[j];
+                Rp[j] = &batch[j];
+            }
+            PolarRotation3x3(Ap, Rp, 1);
+
+            const MatrixBase<T, 3, 3> RtR(Transpose(R) * R);
+            for (std::size_t c{}; c < 3; ++c) {
+                for (std::size_t r{}; r < 3; ++r) {
+                    assert(std::abs(RtR(c, r) - static_cast<T>(c == r)) < tol);
+                    assert(std::abs(R(c, r) - R0(c, r)) < tol);
+                    assert(std::abs(batch[c * 3 + r] - R0(c, r)) < tol);
+                }
+            }
+        }
+    };
+    scaled(0.0f);
+    scaled(0.0);
+
+    // batch of general, ill conditioned, inverted, singular and zero matrices
+    constexpr std::size_t count{ 67 };
+    std::vector<double> a(9 * count), r(9 * count), s(9 * count), rotation(9 * count);
+    for (std::size_t i{}; i < 9 * count; ++i) {
+        a[i] = std::fmod(std::sin(static_cast<double>(i) * 12.9898 + 1.0) * 43758.5453, 1.0);
+    }
+    for (std::size_t j{}; j < 9; ++j) {
+        a[j * count + 1] *= (j % 3 == 0) ? 1e-7 : 1.0;   // condition number ~1e7
+        a[j * count + 2] = (j % 3 == 2) ? a[(j - 1) * count + 2] : a[j * count + 2];  // singular (two equal rows)
+        a[j * count + 3] = 0.0;                         // zero
+        a[j * count + 4] = (j == 0 || j == 4) ? 1.0 : ((j == 8) ? -1.0 : 0.0);  // reflection
+    }
+
+    std::array<const double*, 9> A;
+    std::array<double*, 9> R, S, Q;
+    for (std::size_t j{}; j < 9; ++j) {
+        A[j] = a.data() + j * count;
+        R[j] = r.data() + j * count;
+        S[j] = s.data() + j * count;
+        Q[j] = rotation.data() + j * count;
+    }
+    PolarDecomposition3x3(A, R, S, count);
+    PolarRotation3x3(A, Q, count);
+
+    std::size_t inverted{};
+    for (std::size_t i{}; i < count; ++i) {
+        dmat3 Ai, Ri, Si, Rs, Ss;
+        for (std::size_t j{}; j < 9; ++j) {
+            Ai.m_data[j] = A[j][i];
+            Ri.m_data[j] = R[j][i];
+            Si.m_data[j] = S[j][i];
+            assert(Q[j][i] == R[j][i]);
+        }
+        check(Ai, Ri, Si, 1e-9);
+        inverted += (Determinant(Ai) < 0.0);
+
+        // same as scalar form
+        PolarDecomposition3x3(Ai, Rs, Ss);
+        for (std::size_t j{}; j < 9; ++j) {
+            assert(std::abs(Rs.m_data[j] - Ri.m_data[j]) < 1e-9);
+            assert(std::abs(Ss.m_data[j] - Si.m_data[j]) < 1e-9);
+        }
+    }
+    assert(inverted > 0);
+}
+
+void AffineTest() {
+    // rotation * scale + translation, and a rigid transformation
+    const double angle{ 0.6 };
+    const dmat3 rotation(std::cos(angle), std::sin(angle), 0.0,
+                         -std::sin(angle), std::cos(angle), 0.0,
+                         0.0, 0.0, 1.0),
+                scale(2.0, 0.0, 0.0,
+                      0.0, 0.5, 0.0,
+                      0.1, 0.0, 3.0);
+    const Affine3<double> A(rotation * scale, dvec3(1.0, -2.0, 0.5)),
+                          B(Transpose(rotation), dvec3(-0.5, 4.0, 2.0));
+    const dmat4 a(A.dense()),
+                b(B.dense());
+    const auto same = [](const dmat4& x, const dmat4& y) {
+        for (std::size_t i{}; i < 16; ++i) {
+            assert(std::abs(x.m_data[i] - y.m_data[i]) < 1e-12);
+        }
+    };
+
+    // conversion
+    assert(a(0, 3) == 0.0 && a(1, 3) == 0.0 && a(2, 3) == 0.0 && a(3, 3) == 1.0);
+    assert(a(3, 0) == 1.0 && a(3, 1) == -2.0 && a(3, 2) == 0.5);
+    same(Affine3<double>(a).dense(), a);
+    same(static_cast<dmat4>(Affine3<double>(MatrixBase<double, 4, 4, Layout::RowMajor>(a))), a);
+    same(Affine3<double>().dense(), dmat4());
+
+    // composition
+    same((A * B).dense(), a * b);
+    Affine3<double> C(A);
+    C *= B;
+    same(C.dense(), a * b);
+
+    // transformation
+    const dvec3 p(0.3, -1.2, 2.5);
+    const VectorBase<double, 4> ph(a * VectorBase<double, 4>(p.x, p.y, p.z, 1.0)),
+                                vh(a * VectorBase<double, 4>(p.x, p.y, p.z, 0.0));
+    const dvec3 q(TransformPoint(A, p)),
+                v(TransformVector(A, p));
+    for (std::size_t i{}; i < 3; ++i) {
+        assert(std::abs(q[i] - ph[i]) < 1e-12);
+        assert(std::abs(v[i] - vh[i]) < 1e-12);
+    }
+
+    // inversion
+    same(Inv(A).dense(), Inv(a));
+    same(InvRigid(B).dense(), Inv(b));
+    same((A * Inv(A)).dense(), dmat4());
+    same((InvRigid(B) * B).dense(), dmat4());
+    const dvec3 back(TransformPoint(Inv(A), q));
+    for (std::size_t i{}; i < 3; ++i) {
+        assert(std::abs(back[i] - p[i]) < 1e-12);
+    }
+}
+
+void TrackedMatrixTest() {
+    using tracked = TrackedMatrix<dmat4>;
+    const auto same = [](const dmat4& x, const dmat4& y) {
+        for (std::size_t i{}; i < 16; ++i) {
+            assert(std::abs(x.m_data[i] - y.m_data[i]) < 1e-12);
+        }
+    };
+
+    // property closure
+    const tracked I;
+    assert(I.is(MatrixProperty::Identity | MatrixProperty::Diagonal | MatrixProperty::Orthonormal | MatrixProperty::Affine |
+                MatrixProperty::LowerTriangular | MatrixProperty::UpperTriangular | MatrixProperty::Symmetric));
+
+    // test matrices: rotation, rigid transformation, diagonal, lower triangular, symmetric and general
+    const double angle{ 0.4 };
+    dmat4 rotation;
+    rotation(0, 0) = rotation(2, 2) = std::cos(angle);
+    rotation(0, 2) = -std::sin(angle);
+    rotation(2, 0) = std::sin(angle);
+    dmat4 rigid(rotation);
+    rigid(3, 0) = 1.5;
+    rigid(3, 1) = -2.0;
+    dmat4 lower(0.0),
+          symmetric(0.0),
+          general(0.0);
+    for (std::size_t c{}; c < 4; ++c) {
+        for (std::size_t r{}; r < 4; ++r) {
+            general(c, r) = std::sin(static_cast<double>(c * 4 + r) * 0.71 + 0.3) + ((c == r) ? 3.0 : 0.0);
+            symmetric(c, r) = symmetric(r, c) = general(std::min(c, r), std::max(c, r));
+            lower(c, r) = (r >= c) ? general(c, r) : 0.0;
+        }
+    }
+
+    const tracked R(rotation, MatrixProperty::Orthonormal),
+                  T(rigid, MatrixProperty::Affine),
+                  D(TrackDiagonal(dvec4(2.0, -1.0, 0.5, 4.0))),
+                  L(lower, MatrixProperty::LowerTriangular),
+                  S(Track(symmetric)),
+                  G(Track(general));
+    assert(R.is(MatrixProperty::Affine) == false);
+    assert(Track(rotation).is(MatrixProperty::Orthonormal | MatrixProperty::Affine));
+    assert(Track(rigid).is(MatrixProperty::Affine) && !Track(rigid).is(MatrixProperty::Orthonormal));
+    assert(D.is(MatrixProperty::Symmetric | MatrixProperty::LowerTriangular | MatrixProperty::UpperTriangular));
+    assert(Track(lower).is(MatrixProperty::LowerTriangular) && !Track(lower).is(MatrixProperty::UpperTriangular));
+    assert(S.is(MatrixProperty::Symmetric) && !S.is(MatrixProperty::LowerTriangular));
+    assert(G.properties() == MatrixProperty::None);
+    assert(tracked(Affine3<double>(rigid)).is(MatrixProperty::Affine));
+
+    // detection tolerance is relative to matrix magnitude (tiny matrices are not mistaken for zero ones)
+    assert(Track(general * 1e-15).properties() == MatrixProperty::None);
+    assert(Track(lower * 1e-15).is(MatrixProperty::LowerTriangular) && !Track(lower * 1e-15).is(MatrixProperty::UpperTriangular));
+    {
+        dmat4 large(symmetric * 1e12);
+        large(0, 1) += 1e-6;
+        assert(Track(large).is(MatrixProperty::Symmetric));
+    }
+    assert(std::abs(Inv(TrackDiagonal(dvec4(2e-15, 1e-15, 4e-15, 5e-16))).matrix()(3, 3) - 2e15) < 1.0);
+
+    // products and their properties
+    const std::array<const tracked*, 6> all{ &R, &T, &D, &L, &S, &G };
+    for (const tracked* a : all) {
+        for (const tracked* b : all) {
+            const tracked ab((*a) * (*b));
+            same(ab.matrix(), a->matrix() * b->matrix());
+            assert(HasProperty(DetectProperties(ab.matrix()), ab.properties()));
+        }
+        same(((*a) * I).matrix(), a->matrix());
+        same((I * (*a)).matrix(), a->matrix());
+    }
+    assert((R * R).is(MatrixProperty::Orthonormal));
+    assert((T * T).is(MatrixProperty::Affine));
+    assert((L * L).is(MatrixProperty::LowerTriangular));
+    assert((D * L).is(MatrixProperty::LowerTriangular));
+    assert((D * D).is(MatrixProperty::Diagonal));
+    assert(!(S * S).is(MatrixProperty::Symmetric));
+    assert((S + D).is(MatrixProperty::Symmetric));
+    assert((L * 2.0).is(MatrixProperty::LowerTriangular));
+    assert(!(R * 2.0).is(MatrixProperty::Orthonormal));
+
+    // transpose swaps triangles
+    const tracked U(Transpose(L));
+    assert(U.is(MatrixProperty::UpperTriangular) && !U.is(MatrixProperty::LowerTriangular));
+    same((U * U).matrix(), U.matrix() * U.matrix());
+    assert((U * U).is(MatrixProperty::UpperTriangular));
+
+    // inverse, determinant and solve match their general counterparts
+    const dvec4 b(1.0, -2.0, 3.0, 0.5);
+    for (const tracked* a : { &R, &T, &D, &L, &U, &S, &G }) {
+        const tracked inv(Inv(*a));
+        same(inv.matrix(), Inv(a->matrix()));
+        assert(inv.properties() == a->properties());
+        assert(std::abs(Determinant(*a) - Determinant(a->matrix())) < 1e-12);
+
+        const VectorBase<double, 4> x(Solve(*a, b)),
+                                    y(SolveSquareLU(a->matrix(), VectorBase<double, 4>(b))),
+                                    ax((*a) * x);
+        for (std::size_t i{}; i < 4; ++i) {
+            assert(std::abs(x[i] - y[i]) < 1e-12);
+            assert(std::abs(ax[i] - b[i]) < 1e-12);
+        }
+    }
+
+    // larger triangular matrices
+    using tracked8 = TrackedMatrix<MatrixBase<double, 8, 8>>;
+    MatrixBase<double, 8, 8> lower8(0.0);
+    for (std::size_t c{}; c < 8; ++c) {
+        for (std::size_t r{ c }; r < 8; ++r) {
+            lower8(c, r) = std::cos(static_cast<double>(c * 8 + r)) + ((c == r) ? 2.0 : 0.0);
+        }
+    }
+    const tracked8 L8(lower8, MatrixProperty::LowerTriangular);
+    const MatrixBase<double, 8, 8> product((L8 * L8).matrix()),
+                                   reference(lower8 * lower8),
+                                   inverse(Inv(L8).matrix()),
+                                   inverseReference(Inv(lower8));
+    for (std::size_t i{}; i < 64; ++i) {
+        assert(std::abs(product.m_data[i] - reference.m_data[i]) < 1e-12);
+        assert(std::abs(inverse.m_data[i] - inverseReference.m_data[i]) < 1e-12);
+    }
+}
+
+void TransformHierarchyTest() {
+    using hierarchy = TransformHierarchy<double>;
+    const auto transform = [](const std::size_t i) {
+        const double angle{ 0.1 * static_cast<double>(i % 17) };
+        dmat4 m;
+        m(0, 0) = m(2, 2) = std::cos(angle);
+        m(0, 2) = std::sin(angle);
+        m(2, 0) = -m(0, 2);
+        m(3, 0) = 0.01 * static_cast<double>(i % 5);
+        m(3, 1) = 1.0;
+        m(1, 1) = 1.0 + 0.001 * static_cast<double>(i % 3);
+        return m;
+    };
+
+    // two trees: an 8-ary tree (wide levels are distributed among threads) and a chain
+    constexpr std::size_t wide{ 5000 },
+                          chain{ 40 };
+    hierarchy h;
+    std::vector<std::size_t> parents;
+    for (std::size_t i{}; i < wide; ++i) {
+        parents.push_back((i == 0) ? hierarchy::npos : (i - 1) / 8);
+        assert(h.add(transform(i), parents.back()) == i);
+    }
+    for (std::size_t i{}; i < chain; ++i) {
+        parents.push_back((i == 0) ? hierarchy::npos : wide + i - 1);
+        h.add(transform(wide + i), parents.back());
+    }
+    assert(h.size() == wide + chain);
+    assert(h.depth(0) == 0 && h.depth(8) == 1 && h.depth(9) == 2 && h.depth(wide + chain - 1) == chain - 1);
+    assert(h.parent(wide + 3) == wide + 2 && h.parent(wide) == hierarchy::npos);
+
+    // reference world transformations (nodes are given in topological order)
+    std::vector<dmat4> locals(h.size()), worlds(h.size());
+    for (std::size_t i{}; i < h.size(); ++i) {
+        locals[i] = transform(i);
+    }
+    const auto reference = [&]() {
+        for (std::size_t i{}; i < h.size(); ++i) {
+            worlds[i] = (parents[i] == hierarchy::npos) ? locals[i] : worlds[parents[i]] * locals[i];
+        }
+    };
+    const auto same = [&]() {
+        for (std::size_t i{}; i < h.size(); ++i) {
+            for (std::size_t k{}; k < 16; ++k) {
+                assert(std::abs(h.world(i).m_data[k] - worlds[i].m_data[k]) < 1e-10);
+            }
+        }
+    };
+    reference();
+
+    assert(h.update() == h.size());
+    same();
+    assert(h.update() == 0);
+
+    // only dirty subtrees are updated: node 1 subtree ({1}, 8 children, 64 grand children, ...)
+    const auto subtree = [&parents](const std::size_t xi_node) {
+        std::size_t count{};
+        for (std::size_t i{}; i < parents.size(); ++i) {
+            std::size_t n{ i };
+            while ((n != hierarchy::npos) && (n != xi_node)) n = parents[n];
+            count += (n == xi_node) ? 1 : 0;
+        }
+        return count;
+    };
+    locals[1] = transform(3);
+    h.setLocal(1, locals[1]);
+    assert(h.update() == subtree(1));
+    reference();
+    same();
+
+    // overlapping dirty subtrees are updated once
+    locals[17] = transform(7);
+    locals[2] = transform(11);
+    locals[wide + chain - 1] = transform(2);
+    h.setLocal(17, locals[17]);
+    h.setLocal(2, locals[2]);
+    h.setLocal(wide + chain - 1, locals[wide + chain - 1]);
+    assert(h.update() == subtree(2) + 1);
+    reference();
+    same();
+
+    // nodes added after an update (a deep node and a new root)
+    parents.push_back(wide + chain - 1);
+    locals.push_back(transform(5));
+    worlds.push_back(dmat4());
+    assert(h.add(locals.back(), parents.back()) == wide + chain);
+    parents.push_back(hierarchy::npos);
+    locals.push_back(transform(6));
+    worlds.push_back(dmat4());
+    h.add(locals.back());
+    assert(h.depth(wide + chain) == chain);
+    assert(h.update() == 2);
+    reference();
+    same();
+    assert(h.local(wide + chain) == locals[wide + chain]);
+
+    // single precision
+    TransformHierarchy<float> f;
+    const std::size_t root{ f.add(mat4(2.0f)) },
+                      child{ f.add(mat4(3.0f), root) };
+    f.update();
+    assert(f.world(child) == mat4(2.0f) * mat4(3.0f));
+}
 
 int main() {
     ScalarTest();
@@ -2275,6 +4562,27 @@ int main() {
     Vector3Test();
     Vector4Test();
     MatrixBaseTest();
+    NoiseTest();
+    TextureTest();
+    FactorizationTest();
+    InPlaceTest();
+    MatrixViewTest();
+    PackedMatrixTest();
+    SparseMatrixTest();
+#ifdef GLSLCPP_TEST_INSTRUMENTATION
+    InstrumentationTest();
+    TrackingTest();
+#endif
+    SummationTest();
+    LayoutTest();
+    RankUpdateTest();
+    StructuredSolverTest();
+    EigenSolverTest();
+    LanczosTest();
+    PolarDecompositionTest();
+    AffineTest();
+    TrackedMatrixTest();
+    TransformHierarchyTest();
 
     return 1;
 }